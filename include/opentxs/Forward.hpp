@@ -13,6 +13,9 @@
 #include "opentxs/Shared.hpp"
 #include "opentxs/SharedPimpl.hpp"
 
+#include <cstddef>
+#include <functional>
+
 namespace opentxs
 {
 namespace api
@@ -367,5 +370,10 @@ struct less<opentxs::OTIdentifier> {
         const opentxs::OTIdentifier& lhs,
         const opentxs::OTIdentifier& rhs) const;
 };
+
+template <>
+struct hash<opentxs::OTIdentifier> {
+    std::size_t operator()(const opentxs::OTIdentifier& id) const noexcept;
+};
 }  // namespace std
 #endif
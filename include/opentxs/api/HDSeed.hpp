@@ -26,6 +26,10 @@ public:
         const proto::HDPath& path,
         const BIP44Chain internal,
         const std::uint32_t index) const = 0;
+    /** Returns the extended public key of the account node at path, or an
+     *  empty value if the seed is not available */
+    EXPORT virtual OTData AccountPublicNode(
+        const proto::HDPath& path) const = 0;
     EXPORT virtual std::string Bip32Root(
         const std::string& fingerprint = "") const = 0;
     EXPORT virtual std::string DefaultSeed() const = 0;
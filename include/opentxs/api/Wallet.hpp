@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <ctime>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -47,6 +48,16 @@ class Wallet
 public:
     using AccountCallback = std::function<void(const Account&)>;
 
+    /** Size and effectiveness of one of the wallet's in-memory caches */
+    struct CacheStats {
+        std::size_t size_{0};
+        /** Zero means unbounded */
+        std::size_t capacity_{0};
+        std::uint64_t hits_{0};
+        std::uint64_t misses_{0};
+        std::uint64_t evictions_{0};
+    };
+
     EXPORT virtual SharedAccount Account(const Identifier& accountID) const = 0;
     EXPORT virtual OTIdentifier AccountPartialMatch(
         const std::string& hint) const = 0;
@@ -75,6 +86,18 @@ public:
     [[deprecated]] virtual bool ImportAccount(
         std::unique_ptr<opentxs::Account>& imported) const = 0;
 
+    /**   Report the state of each in-memory cache
+     *
+     *    Capacities are read from the [wallet] section of the configuration
+     *    file when the wallet is constructed.
+     *
+     *    eturns Statistics indexed by cache name ("account", "context",
+     *             "issuer", "nym", "nymfile_lock", "peer_lock", "server",
+     *             "unit")
+     */
+    EXPORT virtual std::map<std::string, CacheStats> CacheStatistics()
+        const = 0;
+
     /**   Load a read-only copy of a Context object
      *
      *    This method should only be called if the specific client or server
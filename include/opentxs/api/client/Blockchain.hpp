@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace opentxs
 {
@@ -35,6 +36,13 @@ public:
         const Identifier& accountID,
         const std::string& label = "",
         const BIP44Chain chain = EXTERNAL_CHAIN) const = 0;
+    /** Allocates the next count addresses on a chain and saves the account
+     *  once. Returns an empty vector on failure. */
+    virtual std::vector<proto::Bip44Address> AllocateAddresses(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::uint32_t count,
+        const BIP44Chain chain = EXTERNAL_CHAIN) const = 0;
     virtual bool AssignAddress(
         const Identifier& nymID,
         const Identifier& accountID,
@@ -10,7 +10,10 @@
 
 #include "opentxs/Proto.hpp"
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace opentxs
@@ -92,17 +95,31 @@ public:
         pair<proto::PaymentWorkflowState, std::unique_ptr<opentxs::Cheque>>;
     using Transfer =
         std::pair<proto::PaymentWorkflowState, std::unique_ptr<opentxs::Item>>;
+    /** The time of an event, and the event itself as stored in its workflow */
+    using ActivityEvent = std::
+        pair<std::chrono::system_clock::time_point, const proto::PaymentEvent*>;
+    using ActivityRow = std::pair<proto::PaymentEventType, ActivityEvent>;
 
     static bool ContainsCheque(const proto::PaymentWorkflow& workflow);
     static bool ContainsTransfer(const proto::PaymentWorkflow& workflow);
     static std::string ExtractCheque(const proto::PaymentWorkflow& workflow);
     static std::string ExtractTransfer(const proto::PaymentWorkflow& workflow);
+    /** List the events of a workflow which are shown as account activity
+     *
+     *  The events point into the workflow, which must outlive the output.
+     */
+    static std::vector<ActivityRow> ExtractActivity(
+        const proto::PaymentWorkflow& workflow);
     static Cheque InstantiateCheque(
         const api::Core& core,
         const proto::PaymentWorkflow& workflow);
     static Transfer InstantiateTransfer(
         const api::Core& core,
         const proto::PaymentWorkflow& workflow);
+    /** Identify a payment by its notary and transaction number */
+    static std::string UUID(
+        const Identifier& notary,
+        const TransactionNumber number);
 
     /** Record a failed transfer attempt */
     EXPORT virtual bool AbortTransfer(
@@ -207,6 +224,13 @@ public:
     EXPORT virtual std::vector<OTIdentifier> WorkflowsByAccount(
         const Identifier& nymID,
         const Identifier& accountID) const = 0;
+    /** Get part of the list of workflow IDs relevant to a specified account,
+     *  ordered by most recent activity, newest first */
+    EXPORT virtual std::vector<OTIdentifier> WorkflowsByAccount(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::size_t start,
+        const std::size_t count) const = 0;
     /** Create a new outgoing cheque workflow */
     EXPORT virtual OTIdentifier WriteCheque(
         const opentxs::Cheque& cheque) const = 0;
@@ -217,6 +241,10 @@ protected:
     Workflow() = default;
 
 private:
+    static ActivityEvent extract_event(
+        const proto::PaymentEventType eventType,
+        const proto::PaymentWorkflow& workflow);
+
     Workflow(const Workflow&) = delete;
     Workflow(Workflow&&) = delete;
     Workflow& operator=(const Workflow&) = delete;
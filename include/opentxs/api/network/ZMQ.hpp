@@ -12,6 +12,7 @@
 #include "opentxs/Types.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -24,6 +25,9 @@ namespace network
 class ZMQ
 {
 public:
+    /** Whether legacy notary messages are sent without base64 armoring, for
+     *  notaries which support it */
+    EXPORT virtual bool BinaryFraming() const = 0;
     EXPORT virtual const opentxs::network::zeromq::Context& Context() const = 0;
     EXPORT virtual proto::AddressType DefaultAddressType() const = 0;
     EXPORT virtual std::chrono::seconds KeepAlive() const = 0;
@@ -41,6 +45,9 @@ public:
     EXPORT virtual std::string SocksProxy() const = 0;
     EXPORT virtual bool SocksProxy(std::string& proxy) const = 0;
     EXPORT virtual ConnectionState Status(const std::string& server) const = 0;
+    /** zlib level applied to binary framed messages. 0 disables compression.
+     */
+    EXPORT virtual std::int32_t WireCompression() const = 0;
 
     EXPORT virtual ~ZMQ() = default;
 
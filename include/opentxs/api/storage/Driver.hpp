@@ -11,6 +11,7 @@
 #include <future>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace opentxs
 {
@@ -22,6 +23,39 @@ namespace storage
 class Driver
 {
 public:
+    /** A read-only snapshot of the backend
+     *
+     *  Values returned by a view point directly into the storage of the
+     *  backend when it supports it and remain valid until the view is
+     *  destroyed. Views should be short lived since they may prevent the
+     *  backend from reclaiming space.
+     */
+    class ReadView
+    {
+    public:
+        virtual bool Load(
+            const std::string& key,
+            const bool checking,
+            std::string_view& value) const = 0;
+
+        template <class T>
+        bool LoadProto(
+            const std::string& hash,
+            std::shared_ptr<T>& serialized,
+            const bool checking = false) const;
+
+        virtual ~ReadView() = default;
+
+    protected:
+        ReadView() = default;
+
+    private:
+        ReadView(const ReadView&) = delete;
+        ReadView(ReadView&&) = delete;
+        ReadView& operator=(const ReadView&) = delete;
+        ReadView& operator=(ReadView&&) = delete;
+    };
+
     virtual bool EmptyBucket(const bool bucket) const = 0;
 
     virtual bool Load(
@@ -32,6 +66,7 @@ public:
         const std::string& key,
         std::string& value,
         const bool bucket) const = 0;
+    virtual std::unique_ptr<ReadView> Read() const = 0;
 
     virtual bool Store(
         const bool isTransaction,
@@ -18,6 +18,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -204,6 +205,18 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const = 0;
+    /**   Load part of a thread
+     *
+     *    \param[in] start number of items to skip, counting back from the
+     *                     most recent item
+     *    \param[in] count maximum number of items to load
+     */
+    virtual bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::size_t start,
+        const std::size_t count,
+        std::shared_ptr<proto::StorageThread>& thread) const = 0;
     virtual bool Load(
         const std::string& id,
         std::shared_ptr<proto::UnitDefinition>& contract,
@@ -233,6 +246,16 @@ public:
     virtual std::set<std::string> PaymentWorkflowsByAccount(
         const std::string& nymID,
         const std::string& accountID) const = 0;
+    /**   List part of an account's workflows, most recently active first
+     *
+     *    \param[in] start number of workflows to skip
+     *    \param[in] count maximum number of workflows to return
+     */
+    virtual std::vector<std::string> PaymentWorkflowsByAccount(
+        const std::string& nymID,
+        const std::string& accountID,
+        const std::size_t start,
+        const std::size_t count) const = 0;
     virtual std::set<std::string> PaymentWorkflowsByState(
         const std::string& nymID,
         const proto::PaymentWorkflowType type,
@@ -11,9 +11,11 @@
 #if OT_CASH
 #include "opentxs/core/Contract.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <map>
+#include <vector>
 
 namespace opentxs
 {
@@ -68,6 +70,17 @@ public:
         const Nym& theNotary,
         std::int64_t lDenomination,
         std::int32_t nPrimeLength = 1024) = 0;
+    // Adds every denomination in the list, in order. Subclasses may generate
+    // the keys concurrently, on up to SetGenerationThreads() threads.
+    virtual bool AddDenominations(
+        const Nym& theNotary,
+        const std::vector<std::int64_t>& denominations,
+        std::int32_t nPrimeLength = 1024);
+    // 0 (the default) means one thread per core
+    inline void SetGenerationThreads(std::size_t threads)
+    {
+        m_nGenerationThreads = threads;
+    }
 
     inline std::int32_t GetDenominationCount() const
     {
@@ -176,6 +189,9 @@ protected:
     OTIdentifier m_CashAccountID;  // The Account ID for the cash reserve
                                    // account.
 
+    std::size_t m_nGenerationThreads{0};  // Limit on the threads used by
+                                          // AddDenominations.
+
     Mint(const api::Core& core);
     Mint(
         const api::Core& core,
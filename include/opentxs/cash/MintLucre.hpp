@@ -14,6 +14,7 @@
 #include "opentxs/core/String.hpp"
 
 #include <cstdint>
+#include <vector>
 
 namespace opentxs
 {
@@ -40,6 +41,10 @@ public:
         const Nym& theNotary,
         std::int64_t lDenomination,
         std::int32_t nPrimeLength = 1024) override;
+    bool AddDenominations(
+        const Nym& theNotary,
+        const std::vector<std::int64_t>& denominations,
+        std::int32_t nPrimeLength = 1024) override;
 
     EXPORT bool SignToken(
         const Nym& theNotary,
@@ -58,6 +63,20 @@ private:
 
     typedef Mint ot_super;
 
+    static bool generate_bank(
+        std::int32_t nPrimeLength,
+        String& strPublicBank,
+        String& strPrivateBank);
+
+    bool add_bank(
+        const Nym& theNotary,
+        std::int64_t lDenomination,
+        const String& strPublicBank,
+        const String& strPrivateBank);
+    bool check_denomination(
+        std::int64_t lDenomination,
+        std::int32_t nPrimeLength);
+
     MintLucre(const api::Core& core);
     EXPORT MintLucre(
         const api::Core& core,
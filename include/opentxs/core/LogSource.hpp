@@ -40,6 +40,8 @@ public:
     template <typename T>
     const LogSource& operator()(const T& in) const
     {
+        if (verbosity_.load() < level_) { return *this; }
+
         return this->operator()(std::to_string(in));
     }
 
@@ -50,17 +52,11 @@ public:
     ~LogSource() = default;
 
 private:
-    using Source = std::pair<OTZMQPushSocket, std::stringstream>;
-
     static std::atomic<int> verbosity_;
     static std::atomic<bool> running_;
-    static std::mutex buffer_lock_;
-    static std::map<std::thread::id, Source> buffer_;
 
     const int level_{-1};
 
-    static Source& get_buffer(std::string& id);
-
     LogSource() = delete;
     LogSource(const LogSource&) = delete;
     LogSource(LogSource&&) = delete;
@@ -43,7 +43,8 @@ enum PackType             // PACKING TYPE
 //
 enum StorageType         // STORAGE TYPE
 { STORE_FILESYSTEM = 0,  // Filesystem
-  STORE_TYPE_SUBCLASS    // (Subclass provided by API client via SWIG.)
+  STORE_TYPE_SUBCLASS,   // (Subclass provided by API client via SWIG.)
+  STORE_LMDB             // One LMDB environment per data folder
 };
 
 extern const char* StoredObjectTypeStrings[];
@@ -449,6 +450,14 @@ public:
         const std::string& twoStr,
         const std::string& threeStr) = 0;
 
+    // Groups every write made by the calling thread into one transaction,
+    // until the matching CommitBatch. Calls may nest; only the outermost
+    // CommitBatch commits. Storage types without transactions (such as the
+    // filesystem) write through immediately and treat these as no-ops.
+    virtual bool BeginBatch(const std::string&) { return true; }
+    virtual bool CommitBatch(const std::string&) { return true; }
+    virtual void AbortBatch(const std::string&) {}
+
     virtual ~Storage()
     {
         if (nullptr != m_pPacker) delete m_pPacker;
@@ -551,6 +560,21 @@ EXPORT bool InitDefaultStorage(
     const StorageType eStoreType,
     const PackType ePackType);
 
+// Reads the [otdb] section of the config file ("backend" is "filesystem" or
+// "lmdb") and returns the storage type to pass to InitDefaultStorage.
+EXPORT StorageType ConfiguredStorageType(const api::Settings& config);
+
+// Copies the existing directory tree under dataFolder into the default
+// storage context. Only meaningful for STORE_LMDB, which already does this
+// automatically (once) the first time it opens a data folder. Returns the
+// number of files imported, or -1 on error.
+EXPORT std::int64_t MigrateFromFilesystem(const std::string& dataFolder);
+
+// Batches writes on the default storage context. (See Storage::BeginBatch.)
+EXPORT bool BeginBatch(const std::string& dataFolder);
+EXPORT bool CommitBatch(const std::string& dataFolder);
+EXPORT void AbortBatch(const std::string& dataFolder);
+
 // Default Storage instance:
 EXPORT Storage* GetDefaultStorage();
 
@@ -12,6 +12,15 @@
 #include "opentxs/core/util/StringUtils.hpp"
 #include "opentxs/core/util/Timer.hpp"
 #include "opentxs/core/Contract.hpp"
+#include "opentxs/Types.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -42,6 +51,14 @@ class OTCron : public Contract
 {
 private:
     typedef Contract ot_super;
+    /** Due date, transaction number. */
+    typedef std::pair<time64_t, std::int64_t> Deadline;
+    /** Earliest deadline on top. */
+    typedef std::priority_queue<
+        Deadline,
+        std::vector<Deadline>,
+        std::greater<Deadline>>
+        queueOfDeadlines;
 
 private:
     friend api::implementation::Factory;
@@ -51,6 +68,20 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Position of each item on the multimap, by transaction number.
+    std::map<std::int64_t, multimapOfCronItems::iterator> m_mapDatePositions;
+    // Guards the schedule below, which is read by the thread waiting on it.
+    mutable std::mutex m_lockSchedule;
+    std::condition_variable m_cvSchedule;
+    bool m_bWake{false};
+    // Every item on Cron is on the heap under its next due date. Rescheduling
+    // doesn't search the heap: it records the new date here and pushes another
+    // entry, and entries which don't match this map are discarded as they
+    // reach the top. Items which are being processed are on neither.
+    queueOfDeadlines m_queueSchedule;
+    std::map<std::int64_t, time64_t> m_mapDeadlines;
+    // Set when a round is skipped for lack of transaction numbers.
+    time64_t m_tResumeDate{0};
     // Always store this in any object that's associated with a specific server.
     OTIdentifier m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -63,13 +94,21 @@ private:
     // Number of transaction numbers Cron  will grab for itself, when it gets
     // low, before each round.
     static std::int32_t __trans_refill_amount;
-    // Number of milliseconds (ideally) between each "Cron Process" event.
+    // Maximum number of milliseconds between each "Cron Process" event. Items
+    // are processed as soon as they are due, but the server will check its
+    // supply of transaction numbers at least this often.
     static std::int32_t __cron_ms_between_process;
     // Int. The maximum number of cron items any given Nym can have
     // active at the same time.
     static std::int32_t __cron_max_items_per_nym;
 
-    static Timer tCron;
+    std::int64_t compute_timeout(const Lock& lock);
+    void erase_item(const std::int64_t lTransactionNum);
+    void pop_stale(const Lock& lock);
+    void schedule(
+        const Lock& lock,
+        const std::int64_t lTransactionNum,
+        const time64_t tDueDate);
 
     explicit OTCron(const api::Core& server);
 
@@ -101,9 +140,12 @@ public:
     inline bool IsActivated() const { return m_bIsActivated; }
     inline bool ActivateCron()
     {
-        if (!m_bIsActivated)
-            return m_bIsActivated = true;
-        else
+        if (!m_bIsActivated) {
+            m_bIsActivated = true;
+            Wake();
+
+            return true;
+        } else
             return false;
     }
     // RECURRING TRANSACTIONS
@@ -155,7 +197,16 @@ public:
      * since it will not be replenished again at least until the call has
      * finished.) */
     void ProcessCronItems();
-
+    /** Process the item with this transaction number on the next pass,
+     * regardless of its due date. Does nothing if the item isn't on Cron. */
+    void ScheduleItem(const std::int64_t lTransactionNum);
+    /** Block until the next item is due, Wake() is called, or
+     * GetCronMsBetweenProcess() elapses. */
+    void WaitForNextDeadline();
+    void Wake();
+
+    /** Milliseconds until the next item is due, or zero if ProcessCronItems()
+     * has work to do. */
     std::int64_t computeTimeout();
 
     inline void SetNotaryID(const Identifier& NOTARY_ID)
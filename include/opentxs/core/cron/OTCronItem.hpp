@@ -65,7 +65,9 @@ public:
         std::int64_t newTransactionNo);
 
     inline bool IsFlaggedForRemoval() const { return m_bRemovalFlag; }
-    inline void FlagForRemoval() { m_bRemovalFlag = true; }
+    /** Also asks Cron to process this item on its next pass, so the removal
+     * doesn't wait for the item's process interval. */
+    void FlagForRemoval();
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
 
     EXPORT static std::unique_ptr<OTCronItem> LoadCronReceipt(
@@ -112,6 +114,10 @@ public:
     {
         return m_PROCESS_INTERVAL;
     }
+    /** The earliest time at which ProcessCron() will do anything other than
+     * return true. Cron uses this to schedule the item instead of polling it.
+     * OT_TIME_ZERO means "as soon as possible." */
+    virtual time64_t GetNextDueDate() const;
 
     inline OTCron* GetCron() const { return m_pCron; }
     void setServerNym(ConstNym serverNym) { serverNym_ = serverNym; }
@@ -11,6 +11,9 @@
 #if OT_SCRIPT_CHAI
 #include "opentxs/core/script/OTScript.hpp"
 
+#include <memory>
+#include <string>
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4702)  // warning C4702: unreachable code
@@ -29,9 +32,19 @@ class ChaiScript;
 
 namespace opentxs
 {
+namespace implementation
+{
+class ChaiEngine;
+}  // namespace implementation
 
+/** Each OTScriptChai leases a ChaiScript engine from a shared pool for its
+ * lifetime. Engines keep the OT native calls registered between leases, and
+ * cache the parsed form of every script they have run. */
 class OTScriptChai : public OTScript
 {
+private:
+    std::unique_ptr<implementation::ChaiEngine> engine_;
+
 public:
     OTScriptChai();
     OTScriptChai(const String& strValue);
@@ -42,6 +55,16 @@ public:
     virtual ~OTScriptChai();
 
     bool ExecuteScript(OTVariable* pReturnVar = nullptr) override;
+
+    /** Native calls must be registered only when this returns true, and must
+     * reach their object through Target() instead of binding a pointer, since
+     * the engine outlives the lease. The first call for a given name on each
+     * engine returns true. */
+    bool NeedsNativeCalls(const std::string& name);
+    /** The object the native calls of the current lease are made on. */
+    OTScriptable* const& Target() const;
+    void SetTarget(OTScriptable& target);
+
     chaiscript::ChaiScript* const chai_{nullptr};
 };
 }  // namespace opentxs
@@ -22,8 +22,12 @@
 #include "opentxs/core/OTStorage.hpp"
 
 #include <cstdint>
+#include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -40,11 +44,11 @@ class Factory;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-typedef std::multimap<std::int64_t, OTOffer*> mapOfOffers;
+// Offers at a single price limit, in the order they were added to the market.
+typedef std::list<OTOffer*> listOfOffers;
+// One side of the order book. Price levels are sorted so the best price is at
+// the back, where levels are added and removed most often.
+typedef std::vector<std::pair<std::int64_t, listOfOffers>> vectorOfPriceLevels;
 // The same offers are also mapped (uniquely) to transaction number.
 typedef std::map<std::int64_t, OTOffer*> mapOfOffersTrnsNum;
 
@@ -59,7 +63,9 @@ public:
         OTOffer& theOffer,
         bool bSaveFile = true,
         time64_t tDateAddedToMarket = OT_TIME_ZERO);
-    bool RemoveOffer(const std::int64_t& lTransactionNum);
+    bool RemoveOffer(
+        const std::int64_t& lTransactionNum,
+        bool bSaveFile = true);
     // returns general information about offers on the market
     EXPORT bool GetOfferList(
         Armored& ascOutput,
@@ -94,8 +100,8 @@ public:
     std::int64_t GetHighestBidPrice();
     std::int64_t GetLowestAskPrice();
 
-    mapOfOffers::size_type GetBidCount() { return m_mapBids.size(); }
-    mapOfOffers::size_type GetAskCount() { return m_mapAsks.size(); }
+    std::size_t GetBidCount() const { return m_lBidCount; }
+    std::size_t GetAskCount() const { return m_lAskCount; }
     void SetInstrumentDefinitionID(const Identifier& INSTRUMENT_DEFINITION_ID)
     {
         m_INSTRUMENT_DEFINITION_ID = INSTRUMENT_DEFINITION_ID;
@@ -167,11 +173,21 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    // Where an offer sits in the book, so it can be removed without a search.
+    struct OfferPosition {
+        bool bid_{false};
+        std::int64_t price_{0};
+        listOfOffers::iterator position_{};
+    };
+
+    vectorOfPriceLevels m_Bids;  // The buyers, highest price at the back
+    vectorOfPriceLevels m_Asks;  // The sellers, lowest price at the back
+    std::size_t m_lBidCount{0};
+    std::size_t m_lAskCount{0};
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
+    std::unordered_map<std::int64_t, OfferPosition> m_mapPositions;
 
     OTIdentifier m_NOTARY_ID;  // Always store this in any object that's
                                // associated with a specific server.
@@ -214,6 +230,16 @@ private:
         const Identifier& CURRENCY_TYPE_ID,
         const std::int64_t& lScale);
 
+    static bool is_worse(
+        const bool bid,
+        const std::int64_t lhs,
+        const std::int64_t rhs);
+
+    listOfOffers& get_price_level(const bool bid, const std::int64_t price);
+    vectorOfPriceLevels::iterator find_price_level(
+        const bool bid,
+        const std::int64_t price);
+    void remove_from_book(const OfferPosition& position);
     void rollback_four_accounts(
         Account& p1,
         bool b1,
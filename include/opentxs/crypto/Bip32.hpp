@@ -31,6 +31,22 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const = 0;
+    /** Derives a non-hardened child of an extended public key produced by
+     *  GetPublicNode without access to any private key.
+     *
+     *  An extended public key is the 32 byte chain code followed by the 33
+     *  byte compressed public key. */
+    EXPORT virtual bool GetPublicChild(
+        const EcdsaCurve& curve,
+        const Data& parent,
+        const std::uint32_t index,
+        Data& child) const = 0;
+    /** Derives the extended public key of the node at path */
+    EXPORT virtual bool GetPublicNode(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        const proto::HDPath& path,
+        Data& node) const = 0;
     EXPORT virtual std::string SeedToFingerprint(
         const EcdsaCurve& curve,
         const OTPassword& seed) const = 0;
@@ -11,6 +11,7 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <future>
 #include <string>
 
 namespace opentxs
@@ -32,6 +33,16 @@ public:
     EXPORT virtual NetworkReplyMessage Send(
         const ServerContext& context,
         const Message& message) = 0;
+    /** Sends a request without waiting for the reply
+     *
+     *  Replies are matched to requests by nym ID and request number, so any
+     *  number of requests may be in flight at once. The future is satisfied
+     *  with SendResult::INVALID_REPLY if the notary rejects the request, or
+     *  with SendResult::TIMEOUT if no reply arrives in time.
+     */
+    EXPORT virtual std::future<NetworkReplyMessage> SendAsync(
+        const ServerContext& context,
+        const Message& message) = 0;
     EXPORT virtual bool Status() const = 0;
 
     virtual ~ServerConnection() = default;
@@ -29,6 +29,9 @@ public:
         const = 0;
     EXPORT virtual opentxs::SharedPimpl<opentxs::ui::BalanceItem> Next()
         const = 0;
+    /** Limit the list to the count most recent rows. Older rows are loaded
+     *  from storage when the window is enlarged. */
+    EXPORT virtual void SetWindow(const std::size_t count) const = 0;
 
     EXPORT virtual ~AccountActivity() = default;
 
@@ -45,6 +45,9 @@ public:
         const proto::ContactItemType currency) const = 0;
     EXPORT virtual bool SendDraft() const = 0;
     EXPORT virtual bool SetDraft(const std::string& draft) const = 0;
+    /** Limit the list to the count most recent items. Older items are
+     *  loaded from storage when the window is enlarged. */
+    EXPORT virtual void SetWindow(const std::size_t count) const = 0;
     EXPORT virtual std::string ThreadID() const = 0;
 
     EXPORT virtual ~ActivityThread() = default;
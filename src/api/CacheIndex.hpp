@@ -0,0 +1,144 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/api/Wallet.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+
+namespace opentxs::api::implementation
+{
+// Recency order and counters for one of the wallet's object maps.
+//
+// The index does not own the cached objects. The owner touches a key on
+// every lookup and calls Evict after inserting into its map, passing a
+// predicate which reports whether an entry is still referenced by a caller.
+// Entries which are in use get a second chance and are moved to the front,
+// so the map may temporarily exceed its capacity when every entry is held.
+//
+// Not thread safe: callers must hold the mutex which protects the map.
+template <typename Key>
+class CacheIndex
+{
+public:
+    const std::size_t capacity_;
+
+    void Erase(const Key& key)
+    {
+        auto it = position_.find(key);
+
+        if (position_.end() == it) { return; }
+
+        order_.erase(it->second);
+        position_.erase(it);
+    }
+
+    // Removes least recently used entries from map until its size is within
+    // capacity. The entry for keep is never removed.
+    template <typename Map, typename InUse>
+    void Evict(Map& map, const Key& keep, const InUse& inUse)
+    {
+        if (0 == capacity_) { return; }
+
+        const auto keepIt = position_.find(keep);
+        auto remaining = order_.size();
+
+        while ((map.size() > capacity_) && (0 < remaining--)) {
+            auto last = std::prev(order_.end());
+
+            if ((position_.end() != keepIt) && (keepIt->second == last)) {
+                order_.splice(order_.begin(), order_, last);
+
+                continue;
+            }
+
+            auto item = map.find(*last);
+
+            if (map.end() == item) {
+                position_.erase(*last);
+                order_.erase(last);
+
+                continue;
+            }
+
+            if (inUse(item->second)) {
+                order_.splice(order_.begin(), order_, last);
+
+                continue;
+            }
+
+            map.erase(item);
+            position_.erase(*last);
+            order_.erase(last);
+            ++evictions_;
+        }
+    }
+
+    void Hit(const Key& key)
+    {
+        ++hits_;
+        Touch(key);
+    }
+
+    void Miss() { ++misses_; }
+
+    api::Wallet::CacheStats Stats(const std::size_t size) const
+    {
+        api::Wallet::CacheStats output{};
+        output.size_ = size;
+        output.capacity_ = capacity_;
+        output.hits_ = hits_;
+        output.misses_ = misses_;
+        output.evictions_ = evictions_;
+
+        return output;
+    }
+
+    void Touch(const Key& key)
+    {
+        auto it = position_.find(key);
+
+        if (position_.end() == it) {
+            order_.push_front(key);
+            position_.emplace(key, order_.begin());
+        } else {
+            order_.splice(order_.begin(), order_, it->second);
+        }
+    }
+
+    explicit CacheIndex(const std::size_t capacity)
+        : capacity_(capacity)
+        , order_()
+        , position_()
+        , hits_(0)
+        , misses_(0)
+        , evictions_(0)
+    {
+    }
+
+    ~CacheIndex() = default;
+
+private:
+    using Order = std::list<Key>;
+
+    Order order_;
+    std::map<Key, typename Order::iterator> position_;
+    std::uint64_t hits_;
+    std::uint64_t misses_;
+    std::uint64_t evictions_;
+
+    CacheIndex() = delete;
+    CacheIndex(const CacheIndex&) = delete;
+    CacheIndex(CacheIndex&&) = delete;
+    CacheIndex& operator=(const CacheIndex&) = delete;
+    CacheIndex& operator=(CacheIndex&&) = delete;
+};
+}  // namespace opentxs::api::implementation
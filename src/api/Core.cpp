@@ -15,10 +15,17 @@
 #if OT_CRYPTO_WITH_BIP39
 #include "opentxs/api/HDSeed.hpp"
 #endif
+#include "opentxs/api/Settings.hpp"
 #include "opentxs/api/Wallet.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "core/crypto/CredentialCache.hpp"
 
 #include "Core.hpp"
 
+#define CREDENTIAL_CACHE_FILE "verified_credentials"
+
 //#define OT_METHOD "opentxs::api::implementation::Core::"
 
 namespace opentxs::api::implementation
@@ -61,6 +68,27 @@ Core::Core(
     OT_ASSERT(seeds_);
     OT_ASSERT(factory_);
     OT_ASSERT(dht_)
+
+    bool persist{false};
+    bool notUsed{false};
+    config_.CheckSet_bool(
+        String::Factory("credentials"),
+        String::Factory("persist_verification_cache"),
+        false,
+        persist,
+        notUsed);
+
+    if (persist && (false == data_folder_.empty())) {
+        auto path = String::Factory();
+        const bool havePath = OTPaths::AppendFile(
+            path,
+            String::Factory(data_folder_),
+            String::Factory(CREDENTIAL_CACHE_FILE));
+
+        if (havePath) {
+            opentxs::implementation::CredentialCache::Persist(path->Get());
+        }
+    }
 }
 
 const api::network::Dht& Core::DHT() const
@@ -0,0 +1,274 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+
+#include "Executor.hpp"
+
+#define OT_METHOD "opentxs::api::implementation::Executor::"
+
+namespace opentxs::api::implementation
+{
+Executor::Executor(const std::size_t threads)
+    : running_(true)
+    , lock_()
+    , state_changed_()
+    , job_available_()
+    , next_id_(0)
+    , registrations_()
+    , jobs_()
+    , timers_()
+    , idle_(0)
+    , progress_(std::chrono::steady_clock::now())
+    , workers_()
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(threads, 1); ++i) {
+        workers_.emplace_back(&Executor::work, this);
+    }
+}
+
+int Executor::Add(Task&& task) const
+{
+    OT_ASSERT(task);
+
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return -1; }
+
+    const auto id = ++next_id_;
+    registrations_[id].task_ = std::move(task);
+
+    return id;
+}
+
+bool Executor::Grow(const std::chrono::milliseconds stall) const
+{
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return false; }
+    if (jobs_.empty()) { return false; }
+    if (0 < idle_) { return false; }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    if ((now - progress_) < stall) { return false; }
+
+    workers_.emplace_back(&Executor::work, this);
+    progress_ = now;
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Every worker is busy. Now using ")(
+        workers_.size())(" workers.")
+        .Flush();
+
+    return true;
+}
+
+void Executor::promote(const Lock& lock) const
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto now = std::chrono::steady_clock::now();
+
+    while ((false == timers_.empty()) && (timers_.top().first <= now)) {
+        const auto [due, id] = timers_.top();
+        timers_.pop();
+        auto it = registrations_.find(id);
+
+        if (registrations_.end() == it) { continue; }
+
+        auto& registration = it->second;
+
+        // Superseded by an earlier deadline or cleared by a run
+        if (false == registration.scheduled_) { continue; }
+        if (due != registration.due_) { continue; }
+
+        registration.scheduled_ = false;
+        queue(lock, id, registration);
+    }
+}
+
+void Executor::queue(const Lock& lock, const int id, Registration& registration)
+    const
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (registration.removed_) { return; }
+
+    switch (registration.state_) {
+        case State::Armed: {
+            if (jobs_.empty()) {
+                progress_ = std::chrono::steady_clock::now();
+            }
+
+            registration.state_ = State::Queued;
+            jobs_.push_back(id);
+        } break;
+        case State::Running: {
+            registration.pending_ = true;
+        } break;
+        case State::Queued:
+        default: {
+        }
+    }
+}
+
+void Executor::Remove(const int id) const
+{
+    Lock lock(lock_);
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return; }
+
+    auto& registration = it->second;
+    registration.removed_ = true;
+
+    if ((State::Running == registration.state_) &&
+        (std::this_thread::get_id() == registration.runner_)) {
+        // Called from inside the task. The worker will clean up once the task
+        // returns.
+        registration.orphaned_ = true;
+
+        return;
+    }
+
+    state_changed_.wait(lock, [&]() -> bool {
+        return State::Running != registration.state_;
+    });
+    registrations_.erase(id);
+}
+
+bool Executor::Schedule(const int id, const std::chrono::milliseconds delay)
+    const
+{
+    if (std::chrono::milliseconds(0) >= delay) { return Wake(id); }
+
+    const auto due = std::chrono::steady_clock::now() + delay;
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return false; }
+
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return false; }
+
+    auto& registration = it->second;
+
+    if (registration.removed_) { return false; }
+
+    if (registration.scheduled_ && (registration.due_ <= due)) { return true; }
+
+    registration.scheduled_ = true;
+    registration.due_ = due;
+    timers_.push({due, id});
+    lock.unlock();
+    job_available_.notify_one();
+
+    return true;
+}
+
+void Executor::Stop()
+{
+    Lock lock(lock_);
+    running_.store(false);
+    lock.unlock();
+    job_available_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+    state_changed_.notify_all();
+}
+
+bool Executor::Wake(const int id) const
+{
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return false; }
+
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return false; }
+
+    auto& registration = it->second;
+
+    if (registration.removed_) { return false; }
+
+    queue(lock, id, registration);
+    lock.unlock();
+    job_available_.notify_one();
+
+    return true;
+}
+
+void Executor::work() const
+{
+    Lock lock(lock_);
+
+    while (running_.load()) {
+        promote(lock);
+
+        if (jobs_.empty()) {
+            ++idle_;
+
+            if (timers_.empty()) {
+                job_available_.wait(lock);
+            } else {
+                job_available_.wait_until(lock, timers_.top().first);
+            }
+
+            --idle_;
+
+            continue;
+        }
+
+        const auto id = jobs_.front();
+        jobs_.pop_front();
+        progress_ = std::chrono::steady_clock::now();
+        auto it = registrations_.find(id);
+
+        if (registrations_.end() == it) { continue; }
+
+        auto& registration = it->second;
+
+        if (registration.removed_) {
+            registration.state_ = State::Armed;
+            state_changed_.notify_all();
+
+            continue;
+        }
+
+        registration.state_ = State::Running;
+        registration.pending_ = false;
+        registration.scheduled_ = false;
+        registration.runner_ = std::this_thread::get_id();
+        lock.unlock();
+        registration.task_();
+        lock.lock();
+        registration.runner_ = std::thread::id{};
+
+        if (registration.orphaned_) {
+            registrations_.erase(id);
+        } else if (registration.pending_ && (false == registration.removed_)) {
+            if (jobs_.empty()) {
+                progress_ = std::chrono::steady_clock::now();
+            }
+
+            registration.pending_ = false;
+            registration.state_ = State::Queued;
+            jobs_.push_back(id);
+        } else {
+            registration.state_ = State::Armed;
+        }
+
+        state_changed_.notify_all();
+    }
+}
+
+Executor::~Executor() { Stop(); }
+}  // namespace opentxs::api::implementation
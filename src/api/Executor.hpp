@@ -0,0 +1,109 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace opentxs::api::implementation
+{
+// Runs registered tasks on a fixed pool of worker threads.
+//
+// A task is registered once and may then be run any number of times, either
+// as soon as a worker is free (Wake) or once a delay has elapsed (Schedule).
+// A task never runs on more than one thread at a time. Waking a task which is
+// already running makes it run again as soon as the current run returns.
+// Scheduling a task which already has a deadline keeps the earlier one, and
+// starting a run clears the deadline, so periodic tasks reschedule themselves
+// at the end of each run.
+//
+// Owners whose tasks may block on each other call Grow periodically, which
+// adds a worker whenever queued tasks are stuck behind busy workers.
+class Executor
+{
+public:
+    using Task = std::function<void()>;
+
+    /** Returns a registration id, or -1 if the executor has been stopped */
+    int Add(Task&& task) const;
+    /** Adds a worker if queued tasks have waited for longer than stall while
+     *  every worker was busy. Added workers are kept until Stop. Returns true
+     *  if a worker was added. */
+    bool Grow(const std::chrono::milliseconds stall) const;
+    /** Blocks until the task is no longer running, unless called from the
+     *  task itself */
+    void Remove(const int id) const;
+    bool Schedule(const int id, const std::chrono::milliseconds delay) const;
+    /** Waits for running tasks to return and joins the workers. Must not be
+     *  called from a task. */
+    void Stop();
+    bool Wake(const int id) const;
+
+    explicit Executor(const std::size_t threads);
+
+    ~Executor();
+
+private:
+    using Deadline = std::chrono::steady_clock::time_point;
+    using Timer = std::pair<Deadline, int>;
+    using TimerQueue =
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>>;
+
+    enum class State : std::uint8_t {
+        Armed = 0,
+        Queued = 1,
+        Running = 2,
+    };
+
+    struct Registration {
+        Task task_{};
+        State state_{State::Armed};
+        bool pending_{false};
+        bool removed_{false};
+        bool orphaned_{false};
+        bool scheduled_{false};
+        Deadline due_{};
+        std::thread::id runner_{};
+    };
+
+    std::atomic<bool> running_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable state_changed_;
+    mutable std::condition_variable job_available_;
+    mutable int next_id_{0};
+    mutable std::map<int, Registration> registrations_;
+    mutable std::deque<int> jobs_;
+    mutable TimerQueue timers_;
+    // Workers waiting for a job or a deadline
+    mutable std::size_t idle_{0};
+    // Last time a worker took a job, or the queue stopped being empty
+    mutable Deadline progress_{};
+    mutable std::vector<std::thread> workers_;
+
+    void promote(const Lock& lock) const;
+    void queue(const Lock& lock, const int id, Registration& registration)
+        const;
+    void work() const;
+
+    Executor() = delete;
+    Executor(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    Executor& operator=(const Executor&) = delete;
+    Executor& operator=(Executor&&) = delete;
+};
+}  // namespace opentxs::api::implementation
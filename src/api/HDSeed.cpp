@@ -85,6 +85,23 @@ std::shared_ptr<proto::AsymmetricKey> HDSeed::AccountChildKey(
     return bip32_.GetHDKey(EcdsaCurve::SECP256K1, *seed, path);
 }
 
+OTData HDSeed::AccountPublicNode(const proto::HDPath& path) const
+{
+    auto output = Data::Factory();
+    auto fingerprint = path.root();
+    std::uint32_t notUsed = 0;
+    auto seed = Seed(fingerprint, notUsed);
+
+    if (false == bool(seed)) { return output; }
+
+    if (false ==
+        bip32_.GetPublicNode(EcdsaCurve::SECP256K1, *seed, path, output)) {
+        output->Release();
+    }
+
+    return output;
+}
+
 std::string HDSeed::Bip32Root(const std::string& fingerprint) const
 {
     // TODO: make fingerprint non-const
@@ -14,6 +14,7 @@ public:
         const proto::HDPath& path,
         const BIP44Chain internal,
         const std::uint32_t index) const override;
+    OTData AccountPublicNode(const proto::HDPath& path) const override;
     std::string Bip32Root(const std::string& fingerprint = "") const override;
     std::string DefaultSeed() const override;
     std::shared_ptr<proto::AsymmetricKey> GetPaymentCode(
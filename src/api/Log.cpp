@@ -5,7 +5,6 @@
 
 #include "stdafx.hpp"
 
-#include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
@@ -20,6 +19,9 @@
 #include <android/log.h>
 #endif
 
+#include <cstdlib>
+#include <iostream>
+
 #include "Log.hpp"
 
 #define LOG_SINK "inproc://opentxs/logsink/1"
@@ -58,31 +60,43 @@ Log::Log(const zmq::Context& zmq, const std::string& endpoint)
 
 void Log::callback(zmq::Message& message)
 {
-    if (3 != message.Body().size()) { return; }
-
-    int level{-1};
-    const auto& levelFrame = message.Body_at(0);
-    const auto& messageFrame = message.Body_at(1);
-    const auto& id = message.Body_at(2);
-    OTPassword::safe_memcpy(
-        &level, sizeof(level), levelFrame.data(), levelFrame.size());
+    // Each message carries a batch of lines as (level, text, thread) triples
+    const auto frames = message.Body().size();
+
+    if ((0 == frames) || (0 != (frames % 3))) { return; }
+
+    for (std::size_t i = 0; i < frames; i += 3) {
+        const std::string levelFrame(message.Body_at(i));
+        const std::string text(message.Body_at(i + 1));
+        const std::string id(message.Body_at(i + 2));
+        const int level = std::atoi(levelFrame.c_str());
 #ifdef ANDROID
-    print_android(level, messageFrame, id);
+        print_android(level, text, id);
 #else
-    print(level, messageFrame, id);
+        print(level, text, id);
 #endif
-    if (publish_) { publish_socket_->Publish(message); }
+
+        if (publish_) {
+            auto line = zmq::Message::Factory();
+            line->AddFrame();
+            line->AddFrame(levelFrame);
+            line->AddFrame(text);
+            line->AddFrame(id);
+            publish_socket_->Publish(line);
+        }
+    }
+
+    std::cerr.flush();
 }
 
 void Log::print(
-    const int level,
+    const int,
     const std::string& text,
     const std::string& thread)
 {
     if (false == text.empty()) {
         std::cerr << "(" << thread << ") ";
-        std::cerr << text << std::endl;
-        std::cerr.flush();
+        std::cerr << text << '\n';
     }
 }
 
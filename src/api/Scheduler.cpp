@@ -10,12 +10,19 @@
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Nym.hpp"
 
+#include <algorithm>
 #include <ctime>
 #include <functional>
 #include <limits>
 
 #include "Scheduler.hpp"
 
+#define SCHEDULER_THREADS 2
+// Storage garbage collection has its own interval checking
+#define SCHEDULER_GC_CHECK_MILLISECONDS 1000
+// Tasks with a long interval are rechecked at least this often
+#define SCHEDULER_MAX_SLEEP_SECONDS 3600
+
 //#define OT_METHOD "opentxs::api::implementation::Scheduler::"
 
 namespace opentxs::api::implementation
@@ -31,8 +38,46 @@ Scheduler::Scheduler(const Flag& running)
     , running_p_{Flag::Factory(running)}
     , running_{running_p_.get()}
     , periodic_task_list_{}
-    , periodic_{nullptr}
+    , executor_(SCHEDULER_THREADS)
+    , gc_task_(-1)
+{
+}
+
+time64_t Scheduler::add(const time64_t time, const time64_t interval)
 {
+    const auto max = std::numeric_limits<time64_t>::max();
+
+    if ((0 < interval) && (time > (max - interval))) { return max; }
+
+    return time + interval;
+}
+
+void Scheduler::gc()
+{
+    if (false == running_) { return; }
+
+    storage_gc_hook();
+    executor_.Schedule(
+        gc_task_, std::chrono::milliseconds(SCHEDULER_GC_CHECK_MILLISECONDS));
+}
+
+void Scheduler::run(TaskItem& item) const
+{
+    if (false == running_) { return; }
+
+    auto now = std::time(nullptr);
+
+    if (now > item.due_) {
+        item.task_();
+        now = std::time(nullptr);
+        item.due_ = add(now, item.interval_);
+    }
+
+    if (false == running_) { return; }
+
+    const auto wait = std::min<time64_t>(
+        add(item.due_ - now, 1), SCHEDULER_MAX_SLEEP_SECONDS);
+    executor_.Schedule(item.id_, std::chrono::seconds(wait));
 }
 
 void Scheduler::Schedule(
@@ -42,7 +87,11 @@ void Scheduler::Schedule(
 {
     Lock lock(lock_);
     periodic_task_list_.push_back(
-        TaskItem{last.count(), interval.count(), task});
+        TaskItem{task, interval.count(), add(last.count(), interval.count())});
+    auto& item = periodic_task_list_.back();
+    lock.unlock();
+    item.id_ = executor_.Add([this, &item]() -> void { run(item); });
+    executor_.Wake(item.id_);
 }
 
 void Scheduler::Start(
@@ -120,35 +169,9 @@ void Scheduler::Start(
         },
         (now - std::chrono::seconds(unit_refresh_interval_) / 2));
 
-    periodic_.reset(new std::thread(&Scheduler::thread, this));
-}
-
-void Scheduler::thread()
-{
-    while (running_) {
-        std::time_t now = std::time(nullptr);
-
-        Lock lock(lock_);
-
-        for (auto& [last, interval, task] : periodic_task_list_) {
-            if ((now - last) > interval) {
-                last = now;
-                std::thread taskThread{task};
-                taskThread.detach();
-            }
-        }
-
-        lock.unlock();
-
-        // Storage has its own interval checking.
-        storage_gc_hook();
-
-        Log::Sleep(std::chrono::milliseconds(100));
-    }
+    gc_task_ = executor_.Add([this]() -> void { gc(); });
+    executor_.Wake(gc_task_);
 }
 
-Scheduler::~Scheduler()
-{
-    if (periodic_) { periodic_->join(); }
-}
+Scheduler::~Scheduler() { executor_.Stop(); }
 }  // namespace opentxs::api::implementation
@@ -10,14 +10,19 @@
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/Lockable.hpp"
 
+#include "api/Executor.hpp"
+
+#include <chrono>
 #include <cstdint>
 #include <list>
-#include <memory>
-#include <tuple>
-#include <thread>
 
 namespace opentxs::api::implementation
 {
+// Runs periodic tasks on a small fixed pool of threads.
+//
+// Each task is registered with the executor once and sleeps on its deadline
+// between runs, so a task never overlaps with itself and no threads are
+// created after startup.
 class Scheduler : public Lockable
 {
 public:
@@ -45,21 +50,30 @@ protected:
     Scheduler(const Flag& running);
 
 private:
-    /** Last performed, Interval, Task */
-    using TaskItem = std::tuple<time64_t, time64_t, PeriodicTask>;
+    struct TaskItem {
+        PeriodicTask task_{};
+        time64_t interval_{0};
+        /** The task runs once the current time is later than this */
+        time64_t due_{0};
+        int id_{-1};
+    };
     using TaskList = std::list<TaskItem>;
 
     mutable TaskList periodic_task_list_;
-    std::unique_ptr<std::thread> periodic_;
+    mutable Executor executor_;
+    int gc_task_;
+
+    static time64_t add(const time64_t time, const time64_t interval);
 
+    void run(TaskItem& item) const;
     virtual void storage_gc_hook() = 0;
 
+    void gc();
+
     Scheduler() = delete;
     Scheduler(const Scheduler&) = delete;
     Scheduler(Scheduler&&) = delete;
     Scheduler& operator=(const Scheduler&) = delete;
     Scheduler& operator=(Scheduler&&) = delete;
-
-    void thread();
 };
 }  // namespace opentxs::api::implementation
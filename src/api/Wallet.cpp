@@ -15,6 +15,7 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/Identity.hpp"
+#include "opentxs/api/Settings.hpp"
 #include "opentxs/client/NymData.hpp"
 #include "opentxs/client/OT_API.hpp"
 #include "opentxs/client/OTWallet.hpp"
@@ -52,6 +53,16 @@ template class opentxs::Pimpl<opentxs::network::zeromq::Message>;
 
 #define OT_METHOD "opentxs::api::implementation::Wallet::"
 
+#define WALLET_CONFIG_SECTION "wallet"
+#define DEFAULT_ACCOUNT_CACHE 10000
+#define DEFAULT_CONTEXT_CACHE 10000
+#define DEFAULT_ISSUER_CACHE 1000
+#define DEFAULT_NYM_CACHE 10000
+#define DEFAULT_NYMFILE_LOCK_CACHE 10000
+#define DEFAULT_PEER_LOCK_CACHE 10000
+#define DEFAULT_SERVER_CACHE 1000
+#define DEFAULT_UNIT_CACHE 1000
+
 namespace opentxs::api::implementation
 {
 const std::map<std::string, proto::ContactItemType> Wallet::unit_of_account_{
@@ -81,6 +92,8 @@ Wallet::Wallet(const api::Core& core)
     : api_(core)
     , context_map_()
     , context_map_lock_()
+    , context_index_(
+          cache_capacity(core, "context_cache", DEFAULT_CONTEXT_CACHE))
     , account_map_()
     , nym_map_()
     , server_map_()
@@ -95,6 +108,19 @@ Wallet::Wallet(const api::Core& core)
     , peer_lock_()
     , nymfile_map_lock_()
     , nymfile_lock_()
+    , account_index_(
+          cache_capacity(core, "account_cache", DEFAULT_ACCOUNT_CACHE))
+    , nym_index_(cache_capacity(core, "nym_cache", DEFAULT_NYM_CACHE))
+    , server_index_(cache_capacity(core, "server_cache", DEFAULT_SERVER_CACHE))
+    , unit_index_(cache_capacity(core, "unit_cache", DEFAULT_UNIT_CACHE))
+    , issuer_index_(
+          cache_capacity(core, "issuer_cache", DEFAULT_ISSUER_CACHE))
+    , peer_index_(
+          cache_capacity(core, "peer_lock_cache", DEFAULT_PEER_LOCK_CACHE))
+    , nymfile_index_(cache_capacity(
+          core,
+          "nymfile_lock_cache",
+          DEFAULT_NYMFILE_LOCK_CACHE))
     , account_publisher_(api_.ZeroMQ().PublishSocket())
     , issuer_publisher_(api_.ZeroMQ().PublishSocket())
     , nym_publisher_(api_.ZeroMQ().PublishSocket())
@@ -129,10 +155,27 @@ Wallet::AccountLock& Wallet::account(
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Account ")(account)(
             " already exists in map.")
             .Flush();
+        account_index_.Hit(account);
 
         return row;
     }
 
+    account_index_.Miss();
+    account_index_.Touch(account);
+    // A row is in use for as long as any SharedAccount or ExclusiveAccount
+    // holds its mutex. Those are only constructed while the map lock is held,
+    // so a successful try_lock here can not race with a new holder.
+    account_index_.Evict(
+        account_map_, account, [](AccountLock& candidate) -> bool {
+            auto& candidateMutex = std::get<0>(candidate);
+
+            if (false == candidateMutex.try_lock()) { return true; }
+
+            candidateMutex.unlock();
+
+            return false;
+        });
+
     eLock rowLock(rowMutex);
     // What if more than one thread tries to create the same row at the same
     // time? One thread will construct the Account object and the other(s) will
@@ -284,6 +327,122 @@ OTIdentifier Wallet::AccountPartialMatch(const std::string& hint) const
     return Identifier::Factory();
 }
 
+std::size_t Wallet::cache_capacity(
+    const api::Core& api,
+    const std::string& key,
+    const std::int64_t defaultValue)
+{
+    std::int64_t output{0};
+    bool notUsed{false};
+    api.Config().CheckSet_long(
+        String::Factory(WALLET_CONFIG_SECTION),
+        String::Factory(key.c_str()),
+        defaultValue,
+        output,
+        notUsed,
+        String::Factory("; 0 means unbounded"));
+
+    return (0 > output) ? 0 : static_cast<std::size_t>(output);
+}
+
+void Wallet::cache_context(const Lock& lock, const ContextID& id) const
+{
+    OT_ASSERT(verify_lock(lock, context_map_lock_))
+
+    context_index_.Touch(id);
+    // Editors and read-only copies both hold a reference to the context
+    context_index_.Evict(
+        context_map_,
+        id,
+        [](const std::shared_ptr<opentxs::Context>& candidate) -> bool {
+            return 1 < candidate.use_count();
+        });
+}
+
+void Wallet::cache_nym(const Lock& lock, const std::string& id) const
+{
+    OT_ASSERT(verify_lock(lock, nym_map_lock_))
+
+    nym_index_.Touch(id);
+    // NymData holds the row mutex and a reference to the nym
+    nym_index_.Evict(nym_map_, id, [](NymLock& candidate) -> bool {
+        auto& [candidateMutex, pCandidate] = candidate;
+
+        if (1 < pCandidate.use_count()) { return true; }
+
+        if (false == candidateMutex.try_lock()) { return true; }
+
+        candidateMutex.unlock();
+
+        return false;
+    });
+}
+
+void Wallet::cache_server(const Lock& lock, const std::string& id) const
+{
+    OT_ASSERT(verify_lock(lock, server_map_lock_))
+
+    server_index_.Touch(id);
+    server_index_.Evict(
+        server_map_,
+        id,
+        [](const std::shared_ptr<opentxs::ServerContract>& candidate) -> bool {
+            return 1 < candidate.use_count();
+        });
+}
+
+void Wallet::cache_unit(const Lock& lock, const std::string& id) const
+{
+    OT_ASSERT(verify_lock(lock, unit_map_lock_))
+
+    unit_index_.Touch(id);
+    unit_index_.Evict(
+        unit_map_,
+        id,
+        [](const std::shared_ptr<opentxs::UnitDefinition>& candidate) -> bool {
+            return 1 < candidate.use_count();
+        });
+}
+
+std::map<std::string, Wallet::CacheStats> Wallet::CacheStatistics() const
+{
+    std::map<std::string, CacheStats> output{};
+    {
+        Lock lock(account_map_lock_);
+        output["account"] = account_index_.Stats(account_map_.size());
+    }
+    {
+        Lock lock(context_map_lock_);
+        output["context"] = context_index_.Stats(context_map_.size());
+    }
+    {
+        Lock lock(issuer_map_lock_);
+        output["issuer"] = issuer_index_.Stats(issuer_map_.size());
+    }
+    {
+        Lock lock(nym_map_lock_);
+        output["nym"] = nym_index_.Stats(nym_map_.size());
+    }
+    {
+        Lock lock(nymfile_map_lock_);
+        output["nymfile_lock"] = nymfile_index_.Stats(nymfile_lock_.size());
+    }
+    {
+        Lock lock(peer_map_lock_);
+        output["peer_lock"] = peer_index_.Stats(peer_lock_.size());
+    }
+    {
+        Lock lock(server_map_lock_);
+        output["server"] = server_index_.Stats(server_map_.size());
+    }
+    {
+        Lock lock(unit_map_lock_);
+        output["unit"] = unit_index_.Stats(unit_map_.size());
+    }
+
+    return output;
+}
+
 ExclusiveAccount Wallet::CreateAccount(
     const Identifier& ownerNymID,
     const Identifier& notaryID,
@@ -625,16 +784,25 @@ proto::ContactItemType Wallet::extract_unit(
 }
 
 std::shared_ptr<opentxs::Context> Wallet::context(
+    const Lock& lock,
     const Identifier& localNymID,
     const Identifier& remoteNymID) const
 {
+    OT_ASSERT(verify_lock(lock, context_map_lock_))
+
     const std::string local = localNymID.str();
     const std::string remote = remoteNymID.str();
     const ContextID context = {local, remote};
     auto it = context_map_.find(context);
     const bool inMap = (it != context_map_.end());
 
-    if (inMap) { return it->second; }
+    if (inMap) {
+        context_index_.Hit(context);
+
+        return it->second;
+    }
+
+    context_index_.Miss();
 
     // Load from storage, if it exists.
     std::shared_ptr<proto::Context> serialized;
@@ -704,6 +872,8 @@ std::shared_ptr<opentxs::Context> Wallet::context(
         return nullptr;
     }
 
+    cache_context(lock, context);
+
     return entry;
 }
 
@@ -830,7 +1000,8 @@ std::shared_ptr<const api::client::Issuer> Wallet::Issuer(
     const Identifier& nymID,
     const Identifier& issuerID) const
 {
-    auto& [lock, pIssuer] = issuer(nymID, issuerID, false);
+    Lock mapLock(issuer_map_lock_);
+    auto& [lock, pIssuer] = issuer(mapLock, nymID, issuerID, false);
     const auto& notUsed [[maybe_unused]] = lock;
 
     return pIssuer;
@@ -840,29 +1011,57 @@ Editor<api::client::Issuer> Wallet::mutable_Issuer(
     const Identifier& nymID,
     const Identifier& issuerID) const
 {
-    auto& [lock, pIssuer] = issuer(nymID, issuerID, true);
+    Lock mapLock(issuer_map_lock_);
+    auto& [lock, pIssuer] = issuer(mapLock, nymID, issuerID, true);
 
     OT_ASSERT(pIssuer);
 
+    // The editor keeps a reference so the row (and its mutex) can not be
+    // evicted before the editor is destroyed.
+    std::shared_ptr<api::client::Issuer> pin{pIssuer};
+    mapLock.unlock();
     std::function<void(api::client::Issuer*, const Lock&)> callback =
         [=](api::client::Issuer* in, const Lock& lock) -> void {
         this->save(lock, in);
     };
 
-    return Editor<api::client::Issuer>(lock, pIssuer.get(), callback);
+    return Editor<api::client::Issuer>(
+        lock, pin.get(), callback, [pin](const api::client::Issuer&) {});
 }
 
 Wallet::IssuerLock& Wallet::issuer(
+    const Lock& lock,
     const Identifier& nymID,
     const Identifier& issuerID,
     const bool create) const
 {
-    Lock lock(issuer_map_lock_);
-    auto& output = issuer_map_[{nymID, issuerID}];
+    OT_ASSERT(verify_lock(lock, issuer_map_lock_))
+
+    const IssuerID id{nymID, issuerID};
+    auto& output = issuer_map_[id];
     auto& [issuerMutex, pIssuer] = output;
     const auto& notUsed [[maybe_unused]] = issuerMutex;
 
-    if (pIssuer) { return output; }
+    if (pIssuer) {
+        issuer_index_.Hit(id);
+
+        return output;
+    }
+
+    issuer_index_.Miss();
+    issuer_index_.Touch(id);
+    issuer_index_.Evict(
+        issuer_map_, id, [](IssuerLock& candidate) -> bool {
+            auto& [candidateMutex, pCandidate] = candidate;
+
+            if (1 < pCandidate.use_count()) { return true; }
+
+            if (false == candidateMutex.try_lock()) { return true; }
+
+            candidateMutex.unlock();
+
+            return false;
+        });
 
     std::shared_ptr<proto::Issuer> serialized{nullptr};
     const bool loaded =
@@ -925,6 +1124,7 @@ ConstNym Wallet::Nym(
     bool valid = false;
 
     if (!inMap) {
+        nym_index_.Miss();
         std::shared_ptr<proto::CredentialIndex> serialized;
 
         std::string alias;
@@ -940,6 +1140,8 @@ ConstNym Wallet::Nym(
                     pNym->alias_ = alias;
                 }
             }
+
+            cache_nym(mapLock, nym);
         } else {
             dht_nym_requester_->SendRequest(nym);
 
@@ -962,6 +1164,7 @@ ConstNym Wallet::Nym(
             }
         }
     } else {
+        nym_index_.Hit(nym);
         auto& pNym = nym_map_[nym].second;
         if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
@@ -1006,6 +1209,7 @@ ConstNym Wallet::Nym(const proto::CredentialIndex& serialized) const
             auto& mapNym = nym_map_[id].second;
             // TODO update existing nym rather than destroying it
             mapNym.reset(candidate.release());
+            cache_nym(mapLock, id);
             nym_publisher_->Publish(id);
 
             return mapNym;
@@ -1039,8 +1243,10 @@ ConstNym Wallet::Nym(
         SaveCredentialIDs(*pNym);
         auto nymfile = mutable_nymfile(pNym, pNym, pNym->ID(), "");
         Lock mapLock(nym_map_lock_);
-        auto& pMapNym = nym_map_[pNym->ID().str()].second;
+        const auto nymID = pNym->ID().str();
+        auto& pMapNym = nym_map_[nymID].second;
         pMapNym = pNym;
+        cache_nym(mapLock, nymID);
 
         return pNym;
     } else {
@@ -1076,7 +1282,8 @@ std::unique_ptr<const opentxs::NymFile> Wallet::Nymfile(
     const Identifier& id,
     const OTPasswordData& reason) const
 {
-    Lock lock(nymfile_lock(id));
+    const auto nymfileMutex = nymfile_lock(id);
+    Lock lock(*nymfileMutex);
     const auto targetNym = Nym(id);
     const auto signerNym = signer_nym(id);
 
@@ -1125,19 +1332,37 @@ Editor<opentxs::NymFile> Wallet::mutable_nymfile(
     using EditorType = Editor<opentxs::NymFile>;
     EditorType::LockedSave callback =
         [&](opentxs::NymFile* in, Lock& lock) -> void { this->save(in, lock); };
-    EditorType::OptionalCallback deleter = [](const opentxs::NymFile& in) {
-        auto* p = &const_cast<opentxs::NymFile&>(in);
-        delete p;
-    };
+    // The deleter keeps the mutex alive until the editor has unlocked it
+    const auto nymfileMutex = nymfile_lock(id);
+    EditorType::OptionalCallback deleter =
+        [nymfileMutex](const opentxs::NymFile& in) {
+            auto* p = &const_cast<opentxs::NymFile&>(in);
+            delete p;
+        };
 
-    return EditorType(nymfile_lock(id), nymfile.release(), callback, deleter);
+    return EditorType(*nymfileMutex, nymfile.release(), callback, deleter);
 }
 
-std::mutex& Wallet::nymfile_lock(const Identifier& nymID) const
+Wallet::MutexPointer Wallet::nymfile_lock(const Identifier& nymID) const
 {
     Lock map_lock(nymfile_map_lock_);
-    auto& output = nymfile_lock_[Identifier::Factory(nymID)];
-    map_lock.unlock();
+    const auto id = Identifier::Factory(nymID);
+    auto& output = nymfile_lock_[id];
+
+    if (output) {
+        nymfile_index_.Hit(id);
+    } else {
+        nymfile_index_.Miss();
+        output.reset(new std::mutex);
+
+        OT_ASSERT(output)
+
+        nymfile_index_.Touch(id);
+        nymfile_index_.Evict(
+            nymfile_lock_, id, [](const MutexPointer& candidate) -> bool {
+                return 1 < candidate.use_count();
+            });
+    }
 
     return output;
 }
@@ -1192,11 +1417,25 @@ bool Wallet::NymNameByIndex(const std::size_t index, String& name) const
     return false;
 }
 
-std::mutex& Wallet::peer_lock(const std::string& nymID) const
+Wallet::MutexPointer Wallet::peer_lock(const std::string& nymID) const
 {
     Lock map_lock(peer_map_lock_);
     auto& output = peer_lock_[nymID];
-    map_lock.unlock();
+
+    if (output) {
+        peer_index_.Hit(nymID);
+    } else {
+        peer_index_.Miss();
+        output.reset(new std::mutex);
+
+        OT_ASSERT(output)
+
+        peer_index_.Touch(nymID);
+        peer_index_.Evict(
+            peer_lock_, nymID, [](const MutexPointer& candidate) -> bool {
+                return 1 < candidate.use_count();
+            });
+    }
 
     return output;
 }
@@ -1207,7 +1446,8 @@ std::shared_ptr<proto::PeerReply> Wallet::PeerReply(
     const StorageBox& box) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     std::shared_ptr<proto::PeerReply> output;
 
     api_.Storage().Load(nymID, reply.str(), box, output, true);
@@ -1219,7 +1459,8 @@ bool Wallet::PeerReplyComplete(const Identifier& nym, const Identifier& replyID)
     const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     std::shared_ptr<proto::PeerReply> reply;
     const bool haveReply = api_.Storage().Load(
         nymID, replyID.str(), StorageBox::SENTPEERREPLY, reply, false);
@@ -1262,7 +1503,8 @@ bool Wallet::PeerReplyCreate(
     const proto::PeerReply& reply) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     if (reply.cookie() != request.id()) {
         otErr << OT_METHOD << __FUNCTION__
@@ -1316,7 +1558,8 @@ bool Wallet::PeerReplyCreateRollback(
     const Identifier& reply) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     const std::string requestID = request.str();
     const std::string replyID = reply.str();
     std::shared_ptr<proto::PeerRequest> requestItem;
@@ -1369,7 +1612,8 @@ bool Wallet::PeerReplyCreateRollback(
 ObjectList Wallet::PeerReplySent(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(nymID, StorageBox::SENTPEERREPLY);
 }
@@ -1377,7 +1621,8 @@ ObjectList Wallet::PeerReplySent(const Identifier& nym) const
 ObjectList Wallet::PeerReplyIncoming(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(nymID, StorageBox::INCOMINGPEERREPLY);
 }
@@ -1385,7 +1630,8 @@ ObjectList Wallet::PeerReplyIncoming(const Identifier& nym) const
 ObjectList Wallet::PeerReplyFinished(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(nymID, StorageBox::FINISHEDPEERREPLY);
 }
@@ -1393,7 +1639,8 @@ ObjectList Wallet::PeerReplyFinished(const Identifier& nym) const
 ObjectList Wallet::PeerReplyProcessed(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(nymID, StorageBox::PROCESSEDPEERREPLY);
 }
@@ -1421,7 +1668,8 @@ bool Wallet::PeerReplyReceive(const Identifier& nym, const PeerObject& reply)
     }
 
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     auto requestID = reply.Request()->ID();
 
     std::shared_ptr<proto::PeerRequest> request;
@@ -1481,7 +1729,8 @@ std::shared_ptr<proto::PeerRequest> Wallet::PeerRequest(
     std::time_t& time) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     std::shared_ptr<proto::PeerRequest> output;
 
     api_.Storage().Load(nymID, request.str(), box, output, time, true);
@@ -1494,7 +1743,8 @@ bool Wallet::PeerRequestComplete(
     const Identifier& replyID) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
     std::shared_ptr<proto::PeerReply> reply;
     const bool haveReply = api_.Storage().Load(
         nymID, replyID.str(), StorageBox::INCOMINGPEERREPLY, reply, false);
@@ -1536,7 +1786,8 @@ bool Wallet::PeerRequestCreate(
     const proto::PeerRequest& request) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().Store(
         request, nym.str(), StorageBox::SENTPEERREQUEST);
@@ -1547,7 +1798,8 @@ bool Wallet::PeerRequestCreateRollback(
     const Identifier& request) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().RemoveNymBoxItem(
         nym.str(), StorageBox::SENTPEERREQUEST, request.str());
@@ -1575,7 +1827,8 @@ bool Wallet::PeerRequestDelete(
 ObjectList Wallet::PeerRequestSent(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(nym.str(), StorageBox::SENTPEERREQUEST);
 }
@@ -1583,7 +1836,8 @@ ObjectList Wallet::PeerRequestSent(const Identifier& nym) const
 ObjectList Wallet::PeerRequestIncoming(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(
         nym.str(), StorageBox::INCOMINGPEERREQUEST);
@@ -1592,7 +1846,8 @@ ObjectList Wallet::PeerRequestIncoming(const Identifier& nym) const
 ObjectList Wallet::PeerRequestFinished(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(
         nym.str(), StorageBox::FINISHEDPEERREQUEST);
@@ -1601,7 +1856,8 @@ ObjectList Wallet::PeerRequestFinished(const Identifier& nym) const
 ObjectList Wallet::PeerRequestProcessed(const Identifier& nym) const
 {
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().NymBoxList(
         nym.str(), StorageBox::PROCESSEDPEERREQUEST);
@@ -1625,7 +1881,8 @@ bool Wallet::PeerRequestReceive(
     }
 
     const std::string nymID = nym.str();
-    Lock lock(peer_lock(nymID));
+    const auto peerMutex = peer_lock(nymID);
+    Lock lock(*peerMutex);
 
     return api_.Storage().Store(
         request.Request()->Contract(), nymID, StorageBox::INCOMINGPEERREQUEST);
@@ -1655,6 +1912,7 @@ bool Wallet::RemoveServer(const Identifier& id) const
     std::string server(id.str());
     Lock mapLock(server_map_lock_);
     auto deleted = server_map_.erase(server);
+    server_index_.Erase(server);
 
     if (0 != deleted) { return api_.Storage().RemoveServer(server); }
 
@@ -1666,6 +1924,7 @@ bool Wallet::RemoveUnitDefinition(const Identifier& id) const
     std::string unit(id.str());
     Lock mapLock(unit_map_lock_);
     auto deleted = unit_map_.erase(unit);
+    unit_index_.Erase(unit);
 
     if (0 != deleted) { return api_.Storage().RemoveUnitDefinition(unit); }
 
@@ -1815,10 +2074,14 @@ bool Wallet::SaveCredentialIDs(const opentxs::Nym& nym) const
 
 bool Wallet::SetNymAlias(const Identifier& id, const std::string& alias) const
 {
+    // Holding a reference keeps the nym from being evicted
+    const auto loaded = Nym(id);
     Lock mapLock(nym_map_lock_);
-    auto& nym = nym_map_[id.str()].second;
+    auto it = nym_map_.find(id.str());
 
-    nym->SetAlias(alias);
+    if ((nym_map_.end() != it) && bool(it->second.second)) {
+        it->second.second->SetAlias(alias);
+    }
 
     return api_.Storage().SetNymAlias(id.str(), alias);
 }
@@ -1833,6 +2096,7 @@ ConstServerContract Wallet::Server(
     bool valid = false;
 
     if (!inMap) {
+        server_index_.Miss();
         std::shared_ptr<proto::ServerContract> serialized;
 
         std::string alias;
@@ -1848,6 +2112,7 @@ ConstServerContract Wallet::Server(
             if (nym) {
                 auto& pServer = server_map_[server];
                 pServer.reset(ServerContract::Factory(*this, nym, *serialized));
+                cache_server(mapLock, server);
 
                 if (pServer) {
                     valid = true;  // Factory() performs validation
@@ -1878,6 +2143,7 @@ ConstServerContract Wallet::Server(
             }
         }
     } else {
+        server_index_.Hit(server);
         auto& pServer = server_map_[server];
         if (pServer) { valid = pServer->Validate(); }
     }
@@ -1915,6 +2181,7 @@ ConstServerContract Wallet::Server(
     if (api_.Storage().Store(contract->Contract(), contract->Alias())) {
         Lock mapLock(server_map_lock_);
         server_map_[server].reset(contract.release());
+        cache_server(mapLock, server);
         mapLock.unlock();
         publish_server(id);
     } else {
@@ -1969,6 +2236,7 @@ ConstServerContract Wallet::Server(const proto::ServerContract& contract) const
                 if (stored) {
                     Lock mapLock(server_map_lock_);
                     server_map_[server].reset(candidate.release());
+                    cache_server(mapLock, server);
                     mapLock.unlock();
                     publish_server(serverID);
                 }
@@ -2063,6 +2331,7 @@ bool Wallet::SetServerAlias(const Identifier& id, const std::string& alias)
     if (saved) {
         Lock mapLock(server_map_lock_);
         server_map_.erase(server);
+        server_index_.Erase(server);
         publish_server(id);
 
         return true;
@@ -2081,6 +2350,7 @@ bool Wallet::SetUnitDefinitionAlias(
     if (saved) {
         Lock mapLock(unit_map_lock_);
         unit_map_.erase(unit);
+        unit_index_.Erase(unit);
 
         return true;
     }
@@ -2103,6 +2373,7 @@ const ConstUnitDefinition Wallet::UnitDefinition(
     bool valid = false;
 
     if (!inMap) {
+        unit_index_.Miss();
         std::shared_ptr<proto::UnitDefinition> serialized;
 
         std::string alias;
@@ -2118,6 +2389,7 @@ const ConstUnitDefinition Wallet::UnitDefinition(
             if (nym) {
                 auto& pUnit = unit_map_[unit];
                 pUnit.reset(UnitDefinition::Factory(*this, nym, *serialized));
+                cache_unit(mapLock, unit);
 
                 if (pUnit) {
                     valid = true;  // Factory() performs validation
@@ -2147,6 +2419,7 @@ const ConstUnitDefinition Wallet::UnitDefinition(
             }
         }
     } else {
+        unit_index_.Hit(unit);
         auto& pUnit = unit_map_[unit];
         if (pUnit) { valid = pUnit->Validate(); }
     }
@@ -2166,6 +2439,7 @@ ConstUnitDefinition Wallet::UnitDefinition(
             if (api_.Storage().Store(contract->Contract(), contract->Alias())) {
                 Lock mapLock(unit_map_lock_);
                 unit_map_[unit].reset(contract.release());
+                cache_unit(mapLock, unit);
                 mapLock.unlock();
             }
         }
@@ -2192,6 +2466,7 @@ ConstUnitDefinition Wallet::UnitDefinition(
                         candidate->Contract(), candidate->Alias())) {
                     Lock mapLock(unit_map_lock_);
                     unit_map_[unit].reset(candidate.release());
+                    cache_unit(mapLock, unit);
                     mapLock.unlock();
                 }
             }
@@ -13,8 +13,11 @@
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/network/zeromq/RequestSocket.hpp"
 
+#include "api/CacheIndex.hpp"
+
 #include <map>
 #include <tuple>
+#include <unordered_map>
 
 namespace opentxs::api::implementation
 {
@@ -46,6 +49,7 @@ public:
         const std::string& label) const override;
     bool ImportAccount(
         std::unique_ptr<opentxs::Account>& imported) const override;
+    std::map<std::string, CacheStats> CacheStatistics() const override;
     std::shared_ptr<const opentxs::ClientContext> ClientContext(
         const Identifier& localNymID,
         const Identifier& remoteNymID) const override;
@@ -197,8 +201,12 @@ protected:
     const api::Core& api_;
     mutable ContextMap context_map_;
     mutable std::mutex context_map_lock_;
+    mutable CacheIndex<ContextID> context_index_;
 
+    // Call after inserting a new entry into context_map_
+    void cache_context(const Lock& lock, const ContextID& id) const;
     std::shared_ptr<opentxs::Context> context(
+        const Lock& lock,
         const Identifier& localNymID,
         const Identifier& remoteNymID) const;
     proto::ContactItemType extract_unit(const Identifier& contractID) const;
@@ -210,7 +218,8 @@ protected:
     Wallet(const api::Core& core);
 
 private:
-    using AccountMap = std::map<OTIdentifier, AccountLock>;
+    using AccountMap = std::unordered_map<OTIdentifier, AccountLock>;
+    using MutexPointer = std::shared_ptr<std::mutex>;
     using NymLock = std::pair<std::mutex, std::shared_ptr<opentxs::Nym>>;
     using NymMap = std::map<std::string, NymLock>;
     using ServerMap =
@@ -237,9 +246,16 @@ private:
     mutable std::mutex unit_map_lock_;
     mutable std::mutex issuer_map_lock_;
     mutable std::mutex peer_map_lock_;
-    mutable std::map<std::string, std::mutex> peer_lock_;
+    mutable std::map<std::string, MutexPointer> peer_lock_;
     mutable std::mutex nymfile_map_lock_;
-    mutable std::map<OTIdentifier, std::mutex> nymfile_lock_;
+    mutable std::unordered_map<OTIdentifier, MutexPointer> nymfile_lock_;
+    mutable CacheIndex<OTIdentifier> account_index_;
+    mutable CacheIndex<std::string> nym_index_;
+    mutable CacheIndex<std::string> server_index_;
+    mutable CacheIndex<std::string> unit_index_;
+    mutable CacheIndex<IssuerID> issuer_index_;
+    mutable CacheIndex<std::string> peer_index_;
+    mutable CacheIndex<OTIdentifier> nymfile_index_;
     OTZMQPublishSocket account_publisher_;
     OTZMQPublishSocket issuer_publisher_;
     OTZMQPublishSocket nym_publisher_;
@@ -248,6 +264,11 @@ private:
     OTZMQRequestSocket dht_server_requester_;
     OTZMQRequestSocket dht_unit_requester_;
 
+    static std::size_t cache_capacity(
+        const api::Core& api,
+        const std::string& key,
+        const std::int64_t defaultValue);
+
     std::string account_alias(
         const std::string& accountID,
         const std::string& hint) const;
@@ -255,6 +276,10 @@ private:
         const Identifier& accountID,
         const std::string& alias,
         const std::string& serialized) const;
+    // Call after inserting a new entry into the corresponding map
+    void cache_nym(const Lock& lock, const std::string& id) const;
+    void cache_server(const Lock& lock, const std::string& id) const;
+    void cache_unit(const Lock& lock, const std::string& id) const;
     virtual void instantiate_client_context(
         const proto::Context& serialized,
         const std::shared_ptr<const opentxs::Nym>& localNym,
@@ -281,8 +306,9 @@ private:
         const std::shared_ptr<const opentxs::Nym>& signerNym,
         const Identifier& id,
         const OTPasswordData& reason) const;
-    std::mutex& nymfile_lock(const Identifier& nymID) const;
-    std::mutex& peer_lock(const std::string& nymID) const;
+    // The returned pointer must be held for as long as the mutex is locked
+    MutexPointer nymfile_lock(const Identifier& nymID) const;
+    MutexPointer peer_lock(const std::string& nymID) const;
     void publish_server(const Identifier& id) const;
     void save(
         const std::string id,
@@ -302,6 +328,7 @@ private:
         const Identifier& accountID,
         const bool create) const;
     IssuerLock& issuer(
+        const Lock& lock,
         const Identifier& nymID,
         const Identifier& issuerID,
         const bool create) const;
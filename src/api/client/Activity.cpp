@@ -23,6 +23,7 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/Types.hpp"
 
@@ -100,7 +101,7 @@ bool Activity::AddBlockchainTransaction(
     const bool saved = api_.Storage().Store(
         sNymID, sthreadID, transaction.txid(), transaction.time(), {}, {}, box);
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) { publish(nymID, sthreadID, transaction.txid()); }
 
     return saved;
 }
@@ -142,7 +143,7 @@ bool Activity::AddPaymentEvent(
         type,
         workflowID.str());
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) { publish(nymID, sthreadID, itemID.str()); }
 
     return saved;
 }
@@ -421,7 +422,7 @@ std::string Activity::Mail(
             Identifier::Factory(id),
             box);
         preload.detach();
-        publish(nym, threadID);
+        publish(nym, threadID, output);
 
         return output;
     }
@@ -735,11 +736,16 @@ void Activity::PreloadThread(
     preload.detach();
 }
 
-void Activity::publish(const Identifier& nymID, const std::string& threadID)
-    const
+void Activity::publish(
+    const Identifier& nymID,
+    const std::string& threadID,
+    const std::string& itemID) const
 {
     auto& publisher = get_publisher(nymID);
-    publisher.Publish(threadID);
+    auto message = opentxs::network::zeromq::Message::Factory();
+    message->AddFrame(threadID);
+    message->AddFrame(itemID);
+    publisher.Publish(message);
 }
 
 std::shared_ptr<proto::StorageThread> Activity::Thread(
@@ -759,48 +765,59 @@ void Activity::thread_preload_thread(
     const std::size_t start,
     const std::size_t count) const
 {
-    std::shared_ptr<proto::StorageThread> thread{};
-    const bool loaded = api_.Storage().Load(nymID, threadID, thread);
+    std::size_t cached{0};
+    std::size_t offset{start};
 
-    if (false == loaded) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load thread "
-              << threadID << " for nym " << nymID << std::endl;
+    // Only the pages of the thread which contain the requested items are read
+    while (cached < count) {
+        std::shared_ptr<proto::StorageThread> thread{};
+        const bool loaded =
+            api_.Storage().Load(nymID, threadID, offset, count, thread);
 
-        return;
-    }
+        if (false == loaded) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Unable to load thread "
+                  << threadID << " for nym " << nymID << std::endl;
 
-    const std::size_t size = thread->item_size();
-    std::size_t cached{0};
+            return;
+        }
 
-    if (start > size) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Error: start larger than size "
-              << "(" << std::to_string(start) << "/" << std::to_string(size)
-              << ")" << std::endl;
+        const std::size_t size = thread->item_size();
 
-        return;
-    }
+        if (0 == size) {
+            if (start == offset) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Error: start larger than size ("
+                      << std::to_string(start) << ")" << std::endl;
+            }
 
-    for (auto i = (size - start); i > 0; --i) {
-        if (cached >= count) { break; }
-
-        const auto& item = thread->item(i - 1);
-        const auto& box = static_cast<StorageBox>(item.box());
-
-        switch (box) {
-            case StorageBox::MAILINBOX:
-            case StorageBox::MAILOUTBOX: {
-                otErr << OT_METHOD << __FUNCTION__ << ": Preloading item "
-                      << item.id() << " in thread " << threadID << std::endl;
-                MailText(
-                    Identifier::Factory(nymID),
-                    Identifier::Factory(item.id()),
-                    box);
-                ++cached;
-            } break;
-            default: {
-                continue;
+            return;
+        }
+
+        for (auto i = size; i > 0; --i) {
+            if (cached >= count) { break; }
+
+            const auto& item = thread->item(i - 1);
+            const auto& box = static_cast<StorageBox>(item.box());
+
+            switch (box) {
+                case StorageBox::MAILINBOX:
+                case StorageBox::MAILOUTBOX: {
+                    otErr << OT_METHOD << __FUNCTION__ << ": Preloading item "
+                          << item.id() << " in thread " << threadID
+                          << std::endl;
+                    MailText(
+                        Identifier::Factory(nymID),
+                        Identifier::Factory(item.id()),
+                        box);
+                    ++cached;
+                } break;
+                default: {
+                    continue;
+                }
             }
         }
+
+        offset += size;
     }
 }
 
@@ -219,7 +219,10 @@ private:
     const opentxs::network::zeromq::PublishSocket& get_publisher(
         const Identifier& nymID,
         std::string& endpoint) const;
-    void publish(const Identifier& nymID, const std::string& threadID) const;
+    void publish(
+        const Identifier& nymID,
+        const std::string& threadID,
+        const std::string& itemID) const;
 
     Activity(const api::Core& api, const client::Contacts& contact);
     Activity() = delete;
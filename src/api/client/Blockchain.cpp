@@ -21,15 +21,16 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
-#include "opentxs/crypto/key/Asymmetric.hpp"
-#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
-#include "opentxs/crypto/key/Secp256k1.hpp"
-#endif
 #include "opentxs/crypto/Bip32.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <set>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "Blockchain.hpp"
 
@@ -50,6 +51,9 @@
 #define ACCOUNT_VERSION 1
 #define PATH_VERSION 1
 #define COMPRESSED_PUBKEY_SIZE 33
+#define CHAIN_CODE_SIZE 32
+// Smallest share of a bulk allocation worth handing to another thread
+#define MIN_ADDRESSES_PER_THREAD 64
 #define BITCOIN_PUBKEY_HASH 0x0
 #define BITCOIN_TESTNET_HASH 0x6f
 #define LITECOIN_PUBKEY_HASH 0x30
@@ -78,6 +82,7 @@ Blockchain::Blockchain(
     , lock_()
     , nym_lock_()
     , account_lock_()
+    , chain_nodes_()
 {
     // WARNING: do not access api_.Wallet() during construction
 }
@@ -229,6 +234,83 @@ std::unique_ptr<proto::Bip44Address> Blockchain::AllocateAddress(
     return output;
 }
 
+std::vector<proto::Bip44Address> Blockchain::AllocateAddresses(
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const std::uint32_t count,
+    const BIP44Chain chain) const
+{
+    LOCK_ACCOUNT()
+
+    const std::string sNymID = nymID.str();
+    const std::string sAccountID = accountID.str();
+    std::vector<proto::Bip44Address> output{};
+    auto account = load_account(accountLock, sNymID, sAccountID);
+
+    if (false == bool(account)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Account does not exist."
+              << std::endl;
+
+        return output;
+    }
+
+    if (0 == count) { return output; }
+
+    const auto& type = account->type();
+    const auto index =
+        chain ? account->internalindex() : account->externalindex();
+
+    if ((MAX_INDEX - index) < count) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Account is full." << std::endl;
+
+        return output;
+    }
+
+    const auto node = chain_node(*account, chain);
+
+    if (node->empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive chain node."
+              << std::endl;
+
+        return output;
+    }
+
+    std::vector<std::string> addresses(count);
+
+    if (false == derive_addresses(type, node, index, addresses)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive addresses."
+              << std::endl;
+
+        return output;
+    }
+
+    output.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        auto& newAddress = add_address(index + i, *account, chain);
+        newAddress.set_version(BLOCKCHAIN_VERSION);
+        newAddress.set_index(index + i);
+        newAddress.set_address(addresses.at(i));
+        output.emplace_back(newAddress);
+    }
+
+    const auto saved = api_.Storage().Store(sNymID, type, *account);
+
+    if (false == saved) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save account."
+              << std::endl;
+        output.clear();
+
+        return output;
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Allocated ")(count)(
+        " addresses starting at index ")(index)
+        .Flush();
+
+    return output;
+}
+
 bool Blockchain::AssignAddress(
     const Identifier& nymID,
     const Identifier& accountID,
@@ -365,51 +447,43 @@ std::string Blockchain::calculate_address(
     const BIP44Chain chain,
     const std::uint32_t index) const
 {
-    const auto& path = account.path();
-    auto fingerprint = path.root();
-    auto serialized = api_.Seeds().AccountChildKey(path, chain, index);
-
-    if (false == bool(serialized)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive key."
-              << std::endl;
-
-        return {};
-    }
-
-    const auto key{opentxs::crypto::key::Asymmetric::Factory(*serialized)};
-    const opentxs::crypto::key::Secp256k1* ecKey{
-        dynamic_cast<const opentxs::crypto::key::Secp256k1*>(&key.get())};
+    const auto node = chain_node(account, chain);
 
-    if (false == bool(key.get())) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to instantiate key."
+    if (node->empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive chain node."
               << std::endl;
 
         return {};
     }
 
-    if (nullptr == ecKey) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Incorrect key type."
-              << std::endl;
-
-        return {};
-    }
+    return calculate_address(account.type(), node, index);
+}
 
-    auto pubkey = Data::Factory();
+std::string Blockchain::calculate_address(
+    const proto::ContactItemType type,
+    const Data& chainNode,
+    const std::uint32_t index) const
+{
+    auto child = Data::Factory();
 
-    if (false == ecKey->GetPublicKey(pubkey)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to extract public key."
+    if (false == api_.Crypto().BIP32().GetPublicChild(
+                     EcdsaCurve::SECP256K1, chainNode, index, child)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to derive key."
               << std::endl;
 
         return {};
     }
 
-    if (COMPRESSED_PUBKEY_SIZE != pubkey->size()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Incorrect pubkey size ("
-              << pubkey->size() << ")." << std::endl;
+    if ((CHAIN_CODE_SIZE + COMPRESSED_PUBKEY_SIZE) != child->size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Incorrect node size ("
+              << child->size() << ")." << std::endl;
 
         return {};
     }
 
+    const auto pubkey = Data::Factory(
+        static_cast<const std::uint8_t*>(child->data()) + CHAIN_CODE_SIZE,
+        COMPRESSED_PUBKEY_SIZE);
     auto sha256 = Data::Factory();
     auto ripemd160 = Data::Factory();
     auto pubkeyHash = Data::Factory();
@@ -429,7 +503,7 @@ std::string Blockchain::calculate_address(
         return {};
     }
 
-    const auto prefix = address_prefix(account.type());
+    const auto prefix = address_prefix(type);
     auto preimage = Data::Factory(&prefix, sizeof(prefix));
 
     OT_ASSERT(1 == preimage->size());
@@ -441,6 +515,77 @@ std::string Blockchain::calculate_address(
     return api_.Crypto().Encode().IdentifierEncode(preimage);
 }
 
+OTData Blockchain::chain_node(
+    const proto::Bip44Account& account,
+    const BIP44Chain chain) const
+{
+    const auto accountID = Identifier::Factory(account.id());
+    Lock lock(lock_);
+    auto it = chain_nodes_.find(accountID);
+
+    if (chain_nodes_.end() != it) {
+        const auto& [external, internal] = it->second;
+
+        return chain ? internal : external;
+    }
+
+    lock.unlock();
+    const auto accountNode = api_.Seeds().AccountPublicNode(account.path());
+
+    if (accountNode->empty()) { return Data::Factory(); }
+
+    const auto& bip32 = api_.Crypto().BIP32();
+    auto external = Data::Factory();
+    auto internal = Data::Factory();
+    const auto curve = EcdsaCurve::SECP256K1;
+
+    if (false == bip32.GetPublicChild(curve, accountNode, 0, external)) {
+        return Data::Factory();
+    }
+
+    if (false == bip32.GetPublicChild(curve, accountNode, 1, internal)) {
+        return Data::Factory();
+    }
+
+    lock.lock();
+    chain_nodes_.emplace(accountID, ChainNodes{external, internal});
+
+    return chain ? internal : external;
+}
+
+bool Blockchain::derive_addresses(
+    const proto::ContactItemType type,
+    const Data& chainNode,
+    const std::uint32_t first,
+    std::vector<std::string>& addresses) const
+{
+    const std::size_t count = addresses.size();
+    const std::size_t threads = std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(
+            std::thread::hardware_concurrency(),
+            count / MIN_ADDRESSES_PER_THREAD));
+    std::atomic<std::size_t> next{0};
+    auto derive = [&]() -> void {
+        for (auto i = next++; i < count; i = next++) {
+            addresses[i] = calculate_address(
+                type, chainNode, first + static_cast<std::uint32_t>(i));
+        }
+    };
+    std::vector<std::thread> workers{};
+
+    for (std::size_t i = 1; i < threads; ++i) { workers.emplace_back(derive); }
+
+    derive();
+
+    for (auto& worker : workers) { worker.join(); }
+
+    return std::none_of(
+        addresses.begin(), addresses.end(), [](const std::string& address) {
+            return address.empty();
+        });
+}
+
 proto::Bip44Address& Blockchain::find_address(
     const std::uint32_t index,
     const BIP44Chain chain,
@@ -22,6 +22,11 @@ public:
         const Identifier& accountID,
         const std::string& label = "",
         const BIP44Chain chain = EXTERNAL_CHAIN) const override;
+    std::vector<proto::Bip44Address> AllocateAddresses(
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const std::uint32_t count,
+        const BIP44Chain chain = EXTERNAL_CHAIN) const override;
     bool AssignAddress(
         const Identifier& nymID,
         const Identifier& accountID,
@@ -55,6 +60,8 @@ public:
 
 private:
     typedef std::map<OTIdentifier, std::mutex> IDLock;
+    /** Extended public keys of the external and internal chain */
+    typedef std::pair<OTData, OTData> ChainNodes;
 
     friend opentxs::Factory;
 
@@ -63,6 +70,9 @@ private:
     mutable std::mutex lock_;
     mutable IDLock nym_lock_;
     mutable IDLock account_lock_;
+    // Derived once per account from the account's extended public key, so
+    // that allocating an address never requires the seed
+    mutable std::map<OTIdentifier, ChainNodes> chain_nodes_;
     proto::Bip44Address& add_address(
         const std::uint32_t index,
         proto::Bip44Account& account,
@@ -74,6 +84,18 @@ private:
         const proto::Bip44Account& account,
         const BIP44Chain chain,
         const std::uint32_t index) const;
+    std::string calculate_address(
+        const proto::ContactItemType type,
+        const Data& chainNode,
+        const std::uint32_t index) const;
+    OTData chain_node(
+        const proto::Bip44Account& account,
+        const BIP44Chain chain) const;
+    bool derive_addresses(
+        const proto::ContactItemType type,
+        const Data& chainNode,
+        const std::uint32_t first,
+        std::vector<std::string>& addresses) const;
     proto::Bip44Address& find_address(
         const std::uint32_t index,
         const BIP44Chain chain,
@@ -69,6 +69,12 @@
 #define CONTRACT_DOWNLOAD_MILLISECONDS 10000
 #define MAIN_LOOP_MILLISECONDS 5000
 #define NYM_REGISTRATION_MILLISECONDS 10000
+#define SYNC_SERVER_WORKERS 2
+
+#define CHECK_RUNNING()                                                        \
+    {                                                                          \
+        if (!running_) { return; }                                             \
+    }
 
 #define SHUTDOWN()                                                             \
     {                                                                          \
@@ -205,7 +211,7 @@ Sync::Sync(
     , server_nym_fetch_()
     , missing_nyms_()
     , missing_servers_()
-    , state_machines_()
+    , executors_()
     , introduction_server_id_()
     , task_status_()
     , task_message_id_()
@@ -909,6 +915,7 @@ OTIdentifier Sync::DepositPayment(
             const auto taskID(Identifier::Random());
 
             return start_task(
+                queue,
                 taskID,
                 queue.deposit_payment_.Push(taskID, {accountIDHint, payment}));
         } break;
@@ -1114,8 +1121,10 @@ OTIdentifier Sync::FindNym(const Identifier& nymID) const
     CHECK_NYM(nymID)
 
     const auto taskID(Identifier::Random());
+    const auto output = start_task(taskID, missing_nyms_.Push(taskID, nymID));
+    wake_all();
 
-    return start_task(taskID, missing_nyms_.Push(taskID, nymID));
+    return output;
 }
 
 OTIdentifier Sync::FindNym(
@@ -1126,8 +1135,10 @@ OTIdentifier Sync::FindNym(
 
     auto& serverQueue = get_nym_fetch(serverIDHint);
     const auto taskID(Identifier::Random());
+    const auto output = start_task(taskID, serverQueue.Push(taskID, nymID));
+    wake_all();
 
-    return start_task(taskID, serverQueue.Push(taskID, nymID));
+    return output;
 }
 
 OTIdentifier Sync::FindServer(const Identifier& serverID) const
@@ -1135,8 +1146,11 @@ OTIdentifier Sync::FindServer(const Identifier& serverID) const
     CHECK_NYM(serverID)
 
     const auto taskID(Identifier::Random());
+    const auto output =
+        start_task(taskID, missing_servers_.Push(taskID, serverID));
+    wake_all();
 
-    return start_task(taskID, missing_servers_.Push(taskID, serverID));
+    return output;
 }
 
 bool Sync::finish_task(const Identifier& taskID, const bool success) const
@@ -1188,6 +1202,23 @@ bool Sync::get_admin(
     return success;
 }
 
+api::implementation::Executor& Sync::get_executor(
+    const Lock& lock,
+    const Identifier& serverID) const
+{
+    OT_ASSERT(verify_lock(lock))
+
+    auto& executor = executors_[serverID];
+
+    if (false == bool(executor)) {
+        executor.reset(new api::implementation::Executor(SYNC_SERVER_WORKERS));
+    }
+
+    OT_ASSERT(executor)
+
+    return *executor;
+}
+
 OTIdentifier Sync::get_introduction_server(const Lock& lock) const
 {
     OT_ASSERT(verify_lock(lock, introduction_server_lock_))
@@ -1219,11 +1250,12 @@ Sync::OperationQueue& Sync::get_operations(const ContextID& id) const
 {
     Lock lock(lock_);
     auto& queue = operations_[id];
-    auto& thread = state_machines_[id];
 
-    if (false == bool(thread)) {
-        thread.reset(new std::thread(
-            [id, &queue, this]() { state_machine(id, queue); }));
+    if (0 > queue.task_) {
+        queue.executor_ = &get_executor(lock, std::get<1>(id));
+        queue.task_ = queue.executor_->Add(
+            [id, &queue, this]() { state_machine(id, queue); });
+        queue.executor_->Wake(queue.task_);
     }
 
     return queue;
@@ -1463,7 +1495,9 @@ OTIdentifier Sync::MessageContact(
     const auto taskID(Identifier::Random());
 
     return start_task(
-        taskID, queue.send_message_.Push(taskID, {recipientNymID, message}));
+        queue,
+        taskID,
+        queue.send_message_.Push(taskID, {recipientNymID, message}));
 }
 
 std::pair<ThreadStatus, OTIdentifier> Sync::MessageStatus(
@@ -1509,6 +1543,7 @@ OTIdentifier Sync::PayContact(
     const auto taskID(Identifier::Random());
 
     return start_task(
+        queue,
         taskID,
         queue.send_payment_.Push(
             taskID,
@@ -1539,6 +1574,7 @@ OTIdentifier Sync::PayContactCash(
     const auto taskID(Identifier::Random());
 
     return start_task(
+        queue,
         taskID,
         queue.send_cash_.Push(
             taskID,
@@ -1608,6 +1644,7 @@ void Sync::process_notification(const zmq::Message& message) const
     switch (notification->Type()) {
         case proto::SERVERREPLY_PUSH: {
             ot_client_.ProcessNotification(notification, context.It());
+            wake({Identifier::Factory(nymID), Identifier::Factory(serverID)});
         } break;
         default: {
             otErr << OT_METHOD << __FUNCTION__
@@ -1722,6 +1759,7 @@ void Sync::refresh_accounts() const
                 auto& queue = get_operations({nymID, serverID});
                 const auto taskID(Identifier::Random());
                 queue.download_nymbox_.Push(taskID, true);
+                queue.executor_->Wake(queue.task_);
             } else {
                 logStr->Concatenate(" %s ", "is not");
             }
@@ -1744,6 +1782,7 @@ void Sync::refresh_accounts() const
         auto& queue = get_operations({nymID, serverID});
         const auto taskID(Identifier::Random());
         queue.download_account_.Push(taskID, accountID);
+        queue.executor_->Wake(queue.task_);
     }
 
     LogVerbose(OT_METHOD)(__FUNCTION__)(": End").Flush();
@@ -1974,7 +2013,7 @@ OTIdentifier Sync::schedule_download_nymbox(
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(Identifier::Random());
 
-    return start_task(taskID, queue.download_nymbox_.Push(taskID, true));
+    return start_task(queue, taskID, queue.download_nymbox_.Push(taskID, true));
 }
 
 OTIdentifier Sync::schedule_register_account(
@@ -1990,7 +2029,7 @@ OTIdentifier Sync::schedule_register_account(
     const auto taskID(Identifier::Random());
 
     return start_task(
-        taskID, queue.register_account_.Push(taskID, {unitID, label}));
+        queue, taskID, queue.register_account_.Push(taskID, {unitID, label}));
 }
 
 OTIdentifier Sync::ScheduleDownloadAccount(
@@ -2004,7 +2043,8 @@ OTIdentifier Sync::ScheduleDownloadAccount(
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(Identifier::Random());
 
-    return start_task(taskID, queue.download_account_.Push(taskID, accountID));
+    return start_task(
+        queue, taskID, queue.download_account_.Push(taskID, accountID));
 }
 
 OTIdentifier Sync::ScheduleDownloadContract(
@@ -2019,7 +2059,7 @@ OTIdentifier Sync::ScheduleDownloadContract(
     const auto taskID(Identifier::Random());
 
     return start_task(
-        taskID, queue.download_contract_.Push(taskID, contractID));
+        queue, taskID, queue.download_contract_.Push(taskID, contractID));
 }
 
 OTIdentifier Sync::ScheduleDownloadNym(
@@ -2033,7 +2073,8 @@ OTIdentifier Sync::ScheduleDownloadNym(
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(Identifier::Random());
 
-    return start_task(taskID, queue.check_nym_.Push(taskID, targetNymID));
+    return start_task(
+        queue, taskID, queue.check_nym_.Push(taskID, targetNymID));
 }
 
 OTIdentifier Sync::ScheduleDownloadNymbox(
@@ -2056,7 +2097,9 @@ OTIdentifier Sync::ScheduleIssueUnitDefinition(
     const auto taskID(Identifier::Random());
 
     return start_task(
-        taskID, queue.issue_unit_definition_.Push(taskID, {unitID, label}));
+        queue,
+        taskID,
+        queue.issue_unit_definition_.Push(taskID, {unitID, label}));
 }
 
 OTIdentifier Sync::ScheduleProcessInbox(
@@ -2069,7 +2112,8 @@ OTIdentifier Sync::ScheduleProcessInbox(
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(Identifier::Random());
 
-    return start_task(taskID, queue.process_inbox_.Push(taskID, accountID));
+    return start_task(
+        queue, taskID, queue.process_inbox_.Push(taskID, accountID));
 }
 
 OTIdentifier Sync::SchedulePublishServerContract(
@@ -2084,7 +2128,7 @@ OTIdentifier Sync::SchedulePublishServerContract(
     const auto taskID(Identifier::Random());
 
     return start_task(
-        taskID, queue.publish_server_contract_.Push(taskID, contractID));
+        queue, taskID, queue.publish_server_contract_.Push(taskID, contractID));
 }
 
 OTIdentifier Sync::ScheduleRegisterAccount(
@@ -2106,7 +2150,7 @@ OTIdentifier Sync::ScheduleRegisterNym(
     auto& queue = get_operations({localNymID, serverID});
     const auto taskID(Identifier::Random());
 
-    return start_task(taskID, queue.register_nym_.Push(taskID, true));
+    return start_task(queue, taskID, queue.register_nym_.Push(taskID, true));
 }
 
 OTIdentifier Sync::ScheduleSendCheque(
@@ -2136,7 +2180,7 @@ OTIdentifier Sync::ScheduleSendCheque(
     SendChequeTask task{
         sourceAccountID, recipientNymID, value, memo, validFrom, validTo};
 
-    return start_task(taskID, queue.send_cheque_.Push(taskID, task));
+    return start_task(queue, taskID, queue.send_cheque_.Push(taskID, task));
 }
 
 bool Sync::send_transfer(
@@ -2295,6 +2339,7 @@ OTIdentifier Sync::SendExternalTransfer(
     const auto taskID(Identifier::Random());
 
     return start_task(
+        queue,
         taskID,
         queue.send_transfer_.Push(
             taskID, {sourceAccountID, targetAccountID, value, memo}));
@@ -2369,6 +2414,7 @@ OTIdentifier Sync::SendTransfer(
     const auto taskID(Identifier::Random());
 
     return start_task(
+        queue,
         taskID,
         queue.send_transfer_.Push(
             taskID, {sourceAccountID, targetAccountID, value, memo}));
@@ -2420,7 +2466,7 @@ void Sync::start_introduction_server(const Identifier& nymID) const
 
     auto& queue = get_operations({nymID, serverID});
     const auto taskID(Identifier::Random());
-    start_task(taskID, queue.download_nymbox_.Push(taskID, true));
+    start_task(queue, taskID, queue.download_nymbox_.Push(taskID, true));
 }
 
 OTIdentifier Sync::start_task(const Identifier& taskID, bool success) const
@@ -2434,6 +2480,18 @@ OTIdentifier Sync::start_task(const Identifier& taskID, bool success) const
     return taskID;
 }
 
+OTIdentifier Sync::start_task(
+    const OperationQueue& queue,
+    const Identifier& taskID,
+    bool success) const
+{
+    auto output = start_task(taskID, success);
+
+    if (success) { queue.executor_->Wake(queue.task_); }
+
+    return output;
+}
+
 void Sync::StartIntroductionServer(const Identifier& localNymID) const
 {
     start_introduction_server(localNymID);
@@ -2441,44 +2499,52 @@ void Sync::StartIntroductionServer(const Identifier& localNymID) const
 
 void Sync::state_machine(const ContextID id, OperationQueue& queue) const
 {
+    CHECK_RUNNING()
+
     const auto& [nymID, serverID] = id;
 
     // Make sure the server contract is available
-    while (running_) {
-        if (check_server_contract(serverID)) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": Server contract ")(serverID)(
-                " exists.")
-                .Flush();
+    if (false == queue.have_contract_) {
+        if (false == check_server_contract(serverID)) {
+            queue.executor_->Schedule(
+                queue.task_,
+                std::chrono::milliseconds(CONTRACT_DOWNLOAD_MILLISECONDS));
 
-            break;
+            return;
         }
 
-        YIELD(CONTRACT_DOWNLOAD_MILLISECONDS);
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Server contract ")(serverID)(
+            " exists.")
+            .Flush();
+        queue.have_contract_ = true;
     }
 
-    SHUTDOWN()
+    CHECK_RUNNING()
 
-    std::shared_ptr<const ServerContext> context{nullptr};
+    auto& context = queue.context_;
 
     // Make sure the nym has registered for the first time on the server
-    while (running_) {
-        if (check_registration(nymID, serverID, context)) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": Nym ")(nymID)(
-                " has registered on server ")(serverID)(" at least once.")
-                .Flush();
+    if (false == bool(context)) {
+        if (false == check_registration(nymID, serverID, context)) {
+            context.reset();
+            queue.executor_->Schedule(
+                queue.task_,
+                std::chrono::milliseconds(NYM_REGISTRATION_MILLISECONDS));
 
-            break;
+            return;
         }
 
-        YIELD(NYM_REGISTRATION_MILLISECONDS);
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Nym ")(nymID)(
+            " has registered on server ")(serverID)(" at least once.")
+            .Flush();
     }
 
-    SHUTDOWN()
+    CHECK_RUNNING()
     OT_ASSERT(context)
 
     bool queueValue{false};
     bool needAdmin{false};
-    bool registerNym{false};
+    auto& registerNym = queue.retry_registration_;
     bool registerNymQueued{false};
     bool downloadNymbox{false};
     auto taskID = Identifier::Factory();
@@ -2505,446 +2571,429 @@ void Sync::state_machine(const ContextID id, OperationQueue& queue) const
     SendTransferTask transfer{
         Identifier::Factory(), Identifier::Factory(), {}, {}};
 
-    // Primary loop
-    while (running_) {
-        SHUTDOWN()
-
-        // If the local nym has updated since the last registernym operation,
-        // schedule a registernym
-        check_nym_revision(*context, queue);
+    // If the local nym has updated since the last registernym operation,
+    // schedule a registernym
+    check_nym_revision(*context, queue);
 
-        SHUTDOWN()
+    CHECK_RUNNING()
 
-        // Register the nym, if scheduled. Keep trying until success
-        registerNymQueued = queue.register_nym_.Pop(taskID, queueValue);
-        registerNym |= queueValue;
+    // Register the nym, if scheduled. Keep trying until success
+    registerNymQueued = queue.register_nym_.Pop(taskID, queueValue);
+    registerNym |= queueValue;
 
-        if (registerNymQueued || registerNym) {
-            if (register_nym(taskID, nymID, serverID)) {
-                registerNym = false;
-                queueValue = false;
-            } else {
-                registerNym = true;
-            }
+    if (registerNymQueued || registerNym) {
+        if (register_nym(taskID, nymID, serverID)) {
+            registerNym = false;
+            queueValue = false;
+        } else {
+            registerNym = true;
         }
+    }
 
-        SHUTDOWN()
-
-        // If this server was added by a pairing operation that included
-        // a server password then request admin permissions on the server
-        const auto haveAdmin = context->isAdmin();
-        needAdmin = context->HaveAdminPassword() && (false == haveAdmin);
+    CHECK_RUNNING()
 
-        if (needAdmin) {
-            serverPassword.setPassword(context->AdminPassword());
-            get_admin(nymID, serverID, serverPassword);
-        }
+    // If this server was added by a pairing operation that included
+    // a server password then request admin permissions on the server
+    const auto haveAdmin = context->isAdmin();
+    needAdmin = context->HaveAdminPassword() && (false == haveAdmin);
 
-        SHUTDOWN()
+    if (needAdmin) {
+        serverPassword.setPassword(context->AdminPassword());
+        get_admin(nymID, serverID, serverPassword);
+    }
 
-        if (haveAdmin) { check_server_name(*context); }
+    CHECK_RUNNING()
 
-        SHUTDOWN()
+    if (haveAdmin) { check_server_name(*context); }
 
-        if (0 == queue.counter_ % 100) {
-            // download server nym in case it has been renamed
-            queue.check_nym_.Push(
-                Identifier::Random(), context->RemoteNym().ID());
-        }
+    CHECK_RUNNING()
 
-        SHUTDOWN()
+    if (0 == queue.counter_ % 100) {
+        // download server nym in case it has been renamed
+        queue.check_nym_.Push(Identifier::Random(), context->RemoteNym().ID());
+    }
 
-        // This is a list of servers for which we do not have a contract.
-        // We ask all known servers on which we are registered to try to find
-        // the contracts.
-        const auto servers = missing_servers_.Copy();
+    CHECK_RUNNING()
 
-        for (const auto& [targetID, taskID] : servers) {
-            SHUTDOWN()
+    // This is a list of servers for which we do not have a contract.
+    // We ask all known servers on which we are registered to try to find
+    // the contracts.
+    const auto servers = missing_servers_.Copy();
 
-            if (targetID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty serverID get in here?"
-                      << std::endl;
+    for (const auto& [targetID, taskID] : servers) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(
-                    ": Searching for server contract for ")(targetID)
-                    .Flush();
-            }
+        if (targetID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty serverID get in here?" << std::endl;
 
-            const auto& notUsed [[maybe_unused]] = taskID;
-            find_server(nymID, serverID, targetID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Searching for server contract for ")(targetID)
+                .Flush();
         }
 
-        // This is a list of contracts (server and unit definition) which a
-        // user of this class has requested we download from this server.
-        while (queue.download_contract_.Pop(taskID, contractID)) {
-            SHUTDOWN()
+        const auto& notUsed [[maybe_unused]] = taskID;
+        find_server(nymID, serverID, targetID);
+    }
 
-            if (contractID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty contract ID get in here?"
-                      << std::endl;
+    // This is a list of contracts (server and unit definition) which a
+    // user of this class has requested we download from this server.
+    while (queue.download_contract_.Pop(taskID, contractID)) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(
-                    ": Searching for unit definition contract for ")(contractID)
-                    .Flush();
-            }
+        if (contractID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty contract ID get in here?" << std::endl;
 
-            download_contract(taskID, nymID, serverID, contractID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Searching for unit definition contract for ")(contractID)
+                .Flush();
         }
 
-        // This is a list of nyms for which we do not have credentials..
-        // We ask all known servers on which we are registered to try to find
-        // their credentials.
-        const auto nyms = missing_nyms_.Copy();
+        download_contract(taskID, nymID, serverID, contractID);
+    }
 
-        for (const auto& [targetID, taskID] : nyms) {
-            SHUTDOWN()
+    // This is a list of nyms for which we do not have credentials..
+    // We ask all known servers on which we are registered to try to find
+    // their credentials.
+    const auto nyms = missing_nyms_.Copy();
 
-            if (targetID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty nymID get in here?" << std::endl;
+    for (const auto& [targetID, taskID] : nyms) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Searching for nym ")(
-                    targetID)
-                    .Flush();
-            }
+        if (targetID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty nymID get in here?" << std::endl;
 
-            const auto& notUsed [[maybe_unused]] = taskID;
-            find_nym(nymID, serverID, targetID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Searching for nym ")(targetID)
+                .Flush();
         }
 
-        // This is a list of nyms which haven't been updated in a while and
-        // are known or suspected to be available on this server
-        auto& nymQueue = get_nym_fetch(serverID);
+        const auto& notUsed [[maybe_unused]] = taskID;
+        find_nym(nymID, serverID, targetID);
+    }
 
-        while (nymQueue.Pop(taskID, targetNymID)) {
-            SHUTDOWN()
+    // This is a list of nyms which haven't been updated in a while and
+    // are known or suspected to be available on this server
+    auto& nymQueue = get_nym_fetch(serverID);
 
-            if (targetNymID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty nymID get in here?" << std::endl;
+    while (nymQueue.Pop(taskID, targetNymID)) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Refreshing nym ")(
-                    targetNymID)
-                    .Flush();
-            }
+        if (targetNymID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty nymID get in here?" << std::endl;
 
-            download_nym(taskID, nymID, serverID, targetNymID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Refreshing nym ")(targetNymID)
+                .Flush();
         }
 
-        // This is a list of nyms which a user of this class has requested we
-        // download from this server.
-        while (queue.check_nym_.Pop(taskID, targetNymID)) {
-            SHUTDOWN()
+        download_nym(taskID, nymID, serverID, targetNymID);
+    }
 
-            if (targetNymID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty nymID get in here?" << std::endl;
+    // This is a list of nyms which a user of this class has requested we
+    // download from this server.
+    while (queue.check_nym_.Pop(taskID, targetNymID)) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Searching for nym ")(
-                    targetNymID)
-                    .Flush();
-            }
+        if (targetNymID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty nymID get in here?" << std::endl;
 
-            download_nym(taskID, nymID, serverID, targetNymID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Searching for nym ")(
+                targetNymID)
+                .Flush();
         }
 
-        // This is a list of messages which need to be delivered to a nym
-        // on this server
-        while (queue.send_message_.Pop(taskID, message)) {
-            SHUTDOWN()
+        download_nym(taskID, nymID, serverID, targetNymID);
+    }
 
-            const auto& [recipientID, text] = message;
+    // This is a list of messages which need to be delivered to a nym
+    // on this server
+    while (queue.send_message_.Pop(taskID, message)) {
+        CHECK_RUNNING()
 
-            if (recipientID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty recipient nymID get in here?"
-                      << std::endl;
+        const auto& [recipientID, text] = message;
 
-                continue;
-            }
+        if (recipientID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty recipient nymID get in here?"
+                  << std::endl;
 
-            message_nym(taskID, nymID, serverID, recipientID, text);
+            continue;
         }
 
-        // Download the nymbox, if this operation has been scheduled
-        if (queue.download_nymbox_.Pop(taskID, downloadNymbox)) {
-            LogDetail(OT_METHOD)(__FUNCTION__)(": Downloading nymbox for ")(
-                nymID)(" on ")(serverID)
-                .Flush();
-            registerNym |= !download_nymbox(taskID, nymID, serverID);
-        }
+        message_nym(taskID, nymID, serverID, recipientID, text);
+    }
 
-        SHUTDOWN()
+    // Download the nymbox, if this operation has been scheduled
+    if (queue.download_nymbox_.Pop(taskID, downloadNymbox)) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Downloading nymbox for ")(
+            nymID)(" on ")(serverID)
+            .Flush();
+        registerNym |= !download_nymbox(taskID, nymID, serverID);
+    }
 
-        // This is a list of cheques which need to be written and delivered to
-        // a nym on this server
-        while (queue.send_cheque_.Pop(taskID, sendCheque)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            auto& [accountID, recipientID, amount, memo, start, end] =
-                sendCheque;
+    // This is a list of cheques which need to be written and delivered to
+    // a nym on this server
+    while (queue.send_cheque_.Pop(taskID, sendCheque)) {
+        CHECK_RUNNING()
 
-            if (accountID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty account ID get in here?"
-                      << std::endl;
+        auto& [accountID, recipientID, amount, memo, start, end] = sendCheque;
 
-                continue;
-            }
+        if (accountID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty account ID get in here?" << std::endl;
 
-            if (recipientID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty recipient nymID get in here?"
-                      << std::endl;
+            continue;
+        }
 
-                continue;
-            }
+        if (recipientID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty recipient nymID get in here?"
+                  << std::endl;
 
-            write_and_send_cheque(
-                taskID,
-                nymID,
-                serverID,
-                accountID,
-                recipientID,
-                amount,
-                memo,
-                start,
-                end);
+            continue;
         }
 
-        SHUTDOWN()
+        write_and_send_cheque(
+            taskID,
+            nymID,
+            serverID,
+            accountID,
+            recipientID,
+            amount,
+            memo,
+            start,
+            end);
+    }
 
-        // This is a list of payments which need to be delivered to a nym
-        // on this server
-        while (queue.send_payment_.Pop(taskID, payment)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            auto& [recipientID, pPayment] = payment;
+    // This is a list of payments which need to be delivered to a nym
+    // on this server
+    while (queue.send_payment_.Pop(taskID, payment)) {
+        CHECK_RUNNING()
 
-            if (recipientID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty recipient nymID get in here?"
-                      << std::endl;
+        auto& [recipientID, pPayment] = payment;
 
-                continue;
-            }
+        if (recipientID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty recipient nymID get in here?"
+                  << std::endl;
 
-            pay_nym(taskID, nymID, serverID, recipientID, pPayment);
+            continue;
         }
 
-        SHUTDOWN()
+        pay_nym(taskID, nymID, serverID, recipientID, pPayment);
+    }
 
-#if OT_CASH
-        // This is a list of cash payments which need to be delivered to a nym
-        // on this server
-        while (queue.send_cash_.Pop(taskID, cash_payment)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            auto& [recipientID, pRecipientPurse, pSenderPurse] = cash_payment;
+#if OT_CASH
+    // This is a list of cash payments which need to be delivered to a nym
+    // on this server
+    while (queue.send_cash_.Pop(taskID, cash_payment)) {
+        CHECK_RUNNING()
 
-            if (recipientID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty recipient nymID get in here?"
-                      << std::endl;
+        auto& [recipientID, pRecipientPurse, pSenderPurse] = cash_payment;
 
-                continue;
-            }
+        if (recipientID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty recipient nymID get in here?"
+                  << std::endl;
 
-            pay_nym_cash(
-                taskID,
-                nymID,
-                serverID,
-                recipientID,
-                pRecipientPurse,
-                pSenderPurse);
+            continue;
         }
-#endif
 
-        SHUTDOWN()
+        pay_nym_cash(
+            taskID,
+            nymID,
+            serverID,
+            recipientID,
+            pRecipientPurse,
+            pSenderPurse);
+    }
+#endif
 
-        // Download any accounts which have been scheduled for download
-        while (queue.download_account_.Pop(taskID, accountID)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            if (accountID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty account ID get in here?"
-                      << std::endl;
+    // Download any accounts which have been scheduled for download
+    while (queue.download_account_.Pop(taskID, accountID)) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Downloading account ")(
-                    accountID)(" for ")(nymID)(" on ")(serverID)
-                    .Flush();
-            }
+        if (accountID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty account ID get in here?" << std::endl;
 
-            registerNym |=
-                !download_account(taskID, nymID, serverID, accountID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Downloading account ")(
+                accountID)(" for ")(nymID)(" on ")(serverID)
+                .Flush();
         }
 
-        SHUTDOWN()
+        registerNym |= !download_account(taskID, nymID, serverID, accountID);
+    }
 
-        // Register any accounts which have been scheduled for creation
-        while (queue.register_account_.Pop(taskID, registerAccount)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            const auto& [unitID, label] = registerAccount;
+    // Register any accounts which have been scheduled for creation
+    while (queue.register_account_.Pop(taskID, registerAccount)) {
+        CHECK_RUNNING()
 
-            if (unitID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty unit ID get in here?" << std::endl;
+        const auto& [unitID, label] = registerAccount;
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Creating account for ")(
-                    unitID)(" on ")(serverID)
-                    .Flush();
-            }
+        if (unitID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty unit ID get in here?" << std::endl;
 
-            registerNym |=
-                !register_account(taskID, nymID, serverID, unitID, label);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Creating account for ")(
+                unitID)(" on ")(serverID)
+                .Flush();
         }
 
-        SHUTDOWN()
+        registerNym |=
+            !register_account(taskID, nymID, serverID, unitID, label);
+    }
 
-        // Issue unit definitions which have been scheduled
-        while (queue.issue_unit_definition_.Pop(taskID, issueUnit)) {
-            SHUTDOWN()
+    CHECK_RUNNING()
 
-            const auto& [unitID, label] = issueUnit;
+    // Issue unit definitions which have been scheduled
+    while (queue.issue_unit_definition_.Pop(taskID, issueUnit)) {
+        CHECK_RUNNING()
 
-            if (unitID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty unit ID get in here?" << std::endl;
+        const auto& [unitID, label] = issueUnit;
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(
-                    ": Issuing unit definition for ")(unitID)(" on ")(serverID)
-                    .Flush();
-            }
+        if (unitID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty unit ID get in here?" << std::endl;
 
-            registerNym |=
-                !issue_unit_definition(taskID, nymID, serverID, unitID, label);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Issuing unit definition for ")(unitID)(" on ")(serverID)
+                .Flush();
         }
 
-        SHUTDOWN()
+        registerNym |=
+            !issue_unit_definition(taskID, nymID, serverID, unitID, label);
+    }
 
-        // Deposit any queued payments
-        while (queue.deposit_payment_.Pop(taskID, deposit)) {
-            auto& [accountIDHint, payment] = deposit;
+    CHECK_RUNNING()
 
-            SHUTDOWN()
-            OT_ASSERT(payment)
-
-            const auto status =
-                can_deposit(*payment, nymID, accountIDHint, nullID, accountID);
-
-            switch (status) {
-                case Depositability::READY: {
-                    registerNym |= !deposit_cheque(
-                        taskID,
-                        nymID,
-                        serverID,
-                        accountID,
-                        payment,
-                        depositPaymentRetry);
-                } break;
-                case Depositability::NOT_REGISTERED:
-                case Depositability::NO_ACCOUNT: {
-                    LogDetail(OT_METHOD)(__FUNCTION__)(
-                        ": Temporary failure trying to deposit payment")
-                        .Flush();
-                    depositPaymentRetry.Push(taskID, deposit);
-                } break;
-                default: {
-                    otErr << OT_METHOD << __FUNCTION__
-                          << ": Permanent failure trying to deposit payment"
-                          << std::endl;
-                }
-            }
-        }
+    // Deposit any queued payments
+    while (queue.deposit_payment_.Pop(taskID, deposit)) {
+        auto& [accountIDHint, payment] = deposit;
 
-        // Requeue all payments which will be retried
-        while (depositPaymentRetry.Pop(taskID, deposit)) {
-            SHUTDOWN()
+        CHECK_RUNNING()
+        OT_ASSERT(payment)
 
-            queue.deposit_payment_.Push(taskID, deposit);
+        const auto status =
+            can_deposit(*payment, nymID, accountIDHint, nullID, accountID);
+
+        switch (status) {
+            case Depositability::READY: {
+                registerNym |= !deposit_cheque(
+                    taskID,
+                    nymID,
+                    serverID,
+                    accountID,
+                    payment,
+                    depositPaymentRetry);
+            } break;
+            case Depositability::NOT_REGISTERED:
+            case Depositability::NO_ACCOUNT: {
+                LogDetail(OT_METHOD)(__FUNCTION__)(
+                    ": Temporary failure trying to deposit payment")
+                    .Flush();
+                depositPaymentRetry.Push(taskID, deposit);
+            } break;
+            default: {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Permanent failure trying to deposit payment"
+                      << std::endl;
+            }
         }
+    }
 
-        SHUTDOWN()
+    // Requeue all payments which will be retried
+    while (depositPaymentRetry.Pop(taskID, deposit)) {
+        CHECK_RUNNING()
 
-        // This is a list of transfers which need to be delivered to a nym
-        // on this server
-        while (queue.send_transfer_.Pop(taskID, transfer)) {
-            SHUTDOWN()
+        queue.deposit_payment_.Push(taskID, deposit);
+    }
 
-            const auto& [sourceAccountID, targetAccountID, value, memo] =
-                transfer;
+    CHECK_RUNNING()
 
-            send_transfer(
-                taskID,
-                nymID,
-                serverID,
-                sourceAccountID,
-                targetAccountID,
-                value,
-                memo);
-        }
+    // This is a list of transfers which need to be delivered to a nym
+    // on this server
+    while (queue.send_transfer_.Pop(taskID, transfer)) {
+        CHECK_RUNNING()
 
-        while (queue.publish_server_contract_.Pop(taskID, contractID)) {
-            SHUTDOWN()
+        const auto& [sourceAccountID, targetAccountID, value, memo] = transfer;
 
-            if (contractID->empty()) {
-                otErr << OT_METHOD << __FUNCTION__
-                      << ": How did an empty contract ID get in here?"
-                      << std::endl;
+        send_transfer(
+            taskID,
+            nymID,
+            serverID,
+            sourceAccountID,
+            targetAccountID,
+            value,
+            memo);
+    }
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(
-                    ": Uploading server contract ")(contractID)
-                    .Flush();
-            }
+    while (queue.publish_server_contract_.Pop(taskID, contractID)) {
+        CHECK_RUNNING()
+
+        if (contractID->empty()) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": How did an empty contract ID get in here?" << std::endl;
 
-            publish_server_contract(taskID, nymID, serverID, contractID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Uploading server contract ")(contractID)
+                .Flush();
         }
 
-        while (queue.process_inbox_.Pop(taskID, accountID)) {
-            SHUTDOWN()
+        publish_server_contract(taskID, nymID, serverID, contractID);
+    }
 
-            if (accountID->empty()) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": How did an empty account ID get in here?")
-                    .Flush();
+    while (queue.process_inbox_.Pop(taskID, accountID)) {
+        CHECK_RUNNING()
 
-                continue;
-            } else {
-                LogDetail(OT_METHOD)(__FUNCTION__)(": Processing inbox ")(
-                    accountID)
-                    .Flush();
-            }
+        if (accountID->empty()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": How did an empty account ID get in here?")
+                .Flush();
 
-            process_inbox(taskID, nymID, serverID, accountID);
+            continue;
+        } else {
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Processing inbox ")(accountID)
+                .Flush();
         }
 
-        ++queue.counter_;
-
-        YIELD(MAIN_LOOP_MILLISECONDS);
+        process_inbox(taskID, nymID, serverID, accountID);
     }
+
+    ++queue.counter_;
+    queue.executor_->Schedule(
+        queue.task_, std::chrono::milliseconds(MAIN_LOOP_MILLISECONDS));
 }
 
 ThreadStatus Sync::status(const Lock& lock, const Identifier& taskID) const
@@ -3236,14 +3285,32 @@ bool Sync::write_and_send_cheque(
     return finish_task(taskID, false);
 }
 
-Sync::~Sync()
+void Sync::wake(const ContextID& id) const
 {
-    for (auto& [id, thread] : state_machines_) {
-        const auto& notUsed [[maybe_unused]] = id;
+    Lock lock(lock_);
+    const auto it = operations_.find(id);
+
+    if (operations_.end() == it) { return; }
 
-        OT_ASSERT(thread)
+    const auto& queue = it->second;
+    queue.executor_->Wake(queue.task_);
+}
 
-        if (thread->joinable()) { thread->join(); }
+void Sync::wake_all() const
+{
+    Lock lock(lock_);
+
+    for (const auto& [id, queue] : operations_) {
+        const auto& notUsed [[maybe_unused]] = id;
+        queue.executor_->Wake(queue.task_);
+    }
+}
+
+Sync::~Sync()
+{
+    for (auto& [serverID, executor] : executors_) {
+        const auto& notUsed [[maybe_unused]] = serverID;
+        executor->Stop();
     }
 }
 }  // namespace opentxs::api::client::implementation
@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include "api/Executor.hpp"
+
 namespace std
 {
 using PAYMENTTASK =
@@ -213,6 +215,12 @@ private:
 
     struct OperationQueue {
         int counter_{0};
+        // Executor registration for the state machine
+        api::implementation::Executor* executor_{nullptr};
+        int task_{-1};
+        bool have_contract_{false};
+        bool retry_registration_{false};
+        std::shared_ptr<const ServerContext> context_{nullptr};
         UniqueQueue<OTIdentifier> check_nym_;
         UniqueQueue<DepositPaymentTask> deposit_payment_;
         UniqueQueue<OTIdentifier> download_account_;
@@ -244,7 +252,13 @@ private:
     mutable std::map<OTIdentifier, UniqueQueue<OTIdentifier>> server_nym_fetch_;
     UniqueQueue<OTIdentifier> missing_nyms_;
     UniqueQueue<OTIdentifier> missing_servers_;
-    mutable std::map<ContextID, std::unique_ptr<std::thread>> state_machines_;
+    // State machines run on the executor of the server they talk to, so a
+    // server which stops replying only ties up the workers of its own
+    // contexts. Each pass blocks on server round trips.
+    mutable std::map<
+        OTIdentifier,
+        std::unique_ptr<api::implementation::Executor>>
+        executors_;
     mutable std::unique_ptr<OTIdentifier> introduction_server_id_;
     mutable std::map<OTIdentifier, ThreadStatus> task_status_;
     // taskID, messageID
@@ -328,6 +342,9 @@ private:
         const Identifier& nymID,
         const Identifier& serverID,
         const OTPassword& password) const;
+    api::implementation::Executor& get_executor(
+        const Lock& lock,
+        const Identifier& serverID) const;
     OTIdentifier get_introduction_server(const Lock& lock) const;
     UniqueQueue<OTIdentifier>& get_nym_fetch(const Identifier& serverID) const;
     OperationQueue& get_operations(const ContextID& id) const;
@@ -413,9 +430,15 @@ private:
         const Lock& lock,
         const ServerContract& contract) const;
     OTIdentifier start_task(const Identifier& taskID, bool success) const;
+    OTIdentifier start_task(
+        const OperationQueue& queue,
+        const Identifier& taskID,
+        bool success) const;
     void state_machine(const ContextID id, OperationQueue& queue) const;
     ThreadStatus status(const Lock& lock, const Identifier& taskID) const;
     void update_task(const Identifier& taskID, const ThreadStatus status) const;
+    void wake(const ContextID& id) const;
+    void wake_all() const;
     void start_introduction_server(const Identifier& nymID) const;
     Depositability valid_account(
         const OTPayment& payment,
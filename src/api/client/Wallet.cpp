@@ -39,8 +39,9 @@ std::shared_ptr<const opentxs::Context> Wallet::Context(
     const Identifier& clientNymID) const
 {
     auto serverID = Identifier::Factory(notaryID);
+    Lock lock(context_map_lock_);
 
-    return context(clientNymID, server_to_nym(serverID));
+    return context(lock, clientNymID, server_to_nym(serverID));
 }
 
 void Wallet::instantiate_server_context(
@@ -61,13 +62,16 @@ Editor<opentxs::Context> Wallet::mutable_Context(
     const Identifier& clientNymID) const
 {
     auto serverID = Identifier::Factory(notaryID);
-    auto base = context(clientNymID, server_to_nym(serverID));
+    Lock lock(context_map_lock_);
+    auto base = context(lock, clientNymID, server_to_nym(serverID));
+    lock.unlock();
     std::function<void(opentxs::Context*)> callback =
         [&](opentxs::Context* in) -> void { this->save(in); };
 
     OT_ASSERT(base);
 
-    return Editor<opentxs::Context>(base.get(), callback);
+    return Editor<opentxs::Context>(
+        base.get(), callback, [base](const opentxs::Context&) {});
 }
 
 Editor<opentxs::ServerContext> Wallet::mutable_ServerContext(
@@ -79,7 +83,7 @@ Editor<opentxs::ServerContext> Wallet::mutable_ServerContext(
     auto serverID = Identifier::Factory(remoteID);
     auto remoteNymID = Identifier::Factory(server_to_nym(serverID));
 
-    auto base = context(localNymID, remoteNymID);
+    auto base = context(lock, localNymID, remoteNymID);
 
     std::function<void(opentxs::Context*)> callback =
         [&](opentxs::Context* in) -> void { this->save(in); };
@@ -104,6 +108,7 @@ Editor<opentxs::ServerContext> Wallet::mutable_ServerContext(
         entry.reset(new opentxs::ServerContext(
             api_, localNym, remoteNym, serverID, connection));
         base = entry;
+        cache_context(lock, contextID);
     }
 
     OT_ASSERT(base);
@@ -112,7 +117,10 @@ Editor<opentxs::ServerContext> Wallet::mutable_ServerContext(
 
     OT_ASSERT(nullptr != child);
 
-    return Editor<opentxs::ServerContext>(child, callback);
+    // Holding a reference keeps the context from being evicted while the
+    // editor is alive
+    return Editor<opentxs::ServerContext>(
+        child, callback, [base](const opentxs::ServerContext&) {});
 }
 
 std::shared_ptr<const opentxs::ServerContext> Wallet::ServerContext(
@@ -121,7 +129,8 @@ std::shared_ptr<const opentxs::ServerContext> Wallet::ServerContext(
 {
     auto serverID = Identifier::Factory(remoteID);
     auto remoteNymID = server_to_nym(serverID);
-    auto base = context(localNymID, remoteNymID);
+    Lock lock(context_map_lock_);
+    auto base = context(lock, localNymID, remoteNymID);
 
     auto output = std::dynamic_pointer_cast<const opentxs::ServerContext>(base);
 
@@ -13,6 +13,7 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/core/Cheque.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/Log.hpp"
@@ -110,6 +111,241 @@ bool Workflow::ContainsTransfer(const proto::PaymentWorkflow& workflow)
     return false;
 }
 
+std::vector<Workflow::ActivityRow> Workflow::ExtractActivity(
+    const proto::PaymentWorkflow& workflow)
+{
+    std::vector<ActivityRow> output;
+
+    switch (workflow.type()) {
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGCHEQUE: {
+            switch (workflow.state()) {
+                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
+                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
+                case proto::PAYMENTWORKFLOWSTATE_EXPIRED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CREATE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_CANCELLED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CREATE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CANCEL,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CANCEL, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
+                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CREATE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACCEPT,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACCEPT, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ERROR:
+                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
+                default: {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid workflow state (")(workflow.state())(")")
+                        .Flush();
+                }
+            }
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGCHEQUE: {
+            switch (workflow.state()) {
+                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
+                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
+                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CONVEY,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ERROR:
+                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
+                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
+                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
+                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
+                default: {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid workflow state (")(workflow.state())(")")
+                        .Flush();
+                }
+            }
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGTRANSFER: {
+            switch (workflow.state()) {
+                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
+                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_COMPLETE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_COMPLETE, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
+                case proto::PAYMENTWORKFLOWSTATE_ABORTED: {
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ERROR:
+                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
+                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
+                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
+                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
+                default: {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid workflow state (")(workflow.state())(")")
+                        .Flush();
+                }
+            }
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGTRANSFER: {
+            switch (workflow.state()) {
+                case proto::PAYMENTWORKFLOWSTATE_CONVEYED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CONVEY,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_CONVEY,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACCEPT,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACCEPT, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ERROR:
+                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
+                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
+                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
+                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
+                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
+                case proto::PAYMENTWORKFLOWSTATE_ABORTED:
+                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
+                default: {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid workflow state (")(workflow.state())(")")
+                        .Flush();
+                }
+            }
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_INTERNALTRANSFER: {
+            switch (workflow.state()) {
+                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
+                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
+                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
+                    output.emplace_back(
+                        proto::PAYMENTEVENTTYPE_COMPLETE,
+                        extract_event(
+                            proto::PAYMENTEVENTTYPE_COMPLETE, workflow));
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
+                case proto::PAYMENTWORKFLOWSTATE_ABORTED: {
+                } break;
+                case proto::PAYMENTWORKFLOWSTATE_ERROR:
+                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
+                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
+                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
+                default: {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid workflow state (")(workflow.state())(")")
+                        .Flush();
+                }
+            }
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_ERROR:
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGINVOICE:
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGINVOICE:
+        default: {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Unsupported workflow type (")(
+                workflow.type())(")")
+                .Flush();
+        }
+    }
+
+    return output;
+}
+
+Workflow::ActivityEvent Workflow::extract_event(
+    const proto::PaymentEventType eventType,
+    const proto::PaymentWorkflow& workflow)
+{
+    bool success{false};
+    bool found{false};
+    ActivityEvent output{};
+    auto& [time, event_p] = output;
+
+    for (const auto& event : workflow.event()) {
+        const auto eventTime =
+            std::chrono::system_clock::from_time_t(event.time());
+
+        if (eventType != event.type()) { continue; }
+
+        if (eventTime > time) {
+            if (success) {
+                if (event.success()) {
+                    time = eventTime;
+                    event_p = &event;
+                    found = true;
+                }
+            } else {
+                time = eventTime;
+                event_p = &event;
+                success = event.success();
+                found = true;
+            }
+        } else {
+            if (false == success) {
+                if (event.success()) {
+                    // This is a weird case. It probably shouldn't happen
+                    time = eventTime;
+                    event_p = &event;
+                    success = true;
+                    found = true;
+                }
+            }
+        }
+    }
+
+    if (false == found) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Workflow ")(workflow.id())(
+            ", type ")(workflow.type())(", state ")(workflow.state())(
+            " does not contain an event of type ")(eventType)
+            .Flush();
+
+        OT_FAIL;
+    }
+
+    return output;
+}
+
 std::string Workflow::ExtractCheque(const proto::PaymentWorkflow& workflow)
 {
     if (false == ContainsCheque(workflow)) {
@@ -234,6 +470,21 @@ Workflow::Transfer Workflow::InstantiateTransfer(
     return output;
 }
 
+std::string Workflow::UUID(
+    const Identifier& notary,
+    const TransactionNumber number)
+{
+    LogTrace(OT_METHOD)(__FUNCTION__)(": UUID for notary ")(notary)(
+        " and transaction number ")(number)(" is ");
+    OTData preimage{notary};
+    preimage->Concatenate(&number, sizeof(number));
+    auto output = Identifier::Factory();
+    output->CalculateDigest(preimage);
+    LogTrace(output).Flush();
+
+    return output->str();
+}
+
 namespace implementation
 {
 Workflow::Workflow(
@@ -2258,7 +2509,12 @@ bool Workflow::save_workflow(
 
     OT_ASSERT(saved)
 
-    if (false == accountID.empty()) { account_publisher_->Publish(accountID); }
+    if (false == accountID.empty()) {
+        auto message = zmq::Message::Factory();
+        message->AddFrame(accountID);
+        message->AddFrame(workflow.id());
+        account_publisher_->Publish(message);
+    }
 
     return valid && saved;
 }
@@ -2414,6 +2670,26 @@ std::vector<OTIdentifier> Workflow::WorkflowsByAccount(
     return output;
 }
 
+std::vector<OTIdentifier> Workflow::WorkflowsByAccount(
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const std::size_t start,
+    const std::size_t count) const
+{
+    std::vector<OTIdentifier> output{};
+    const auto workflows = api_.Storage().PaymentWorkflowsByAccount(
+        nymID.str(), accountID.str(), start, count);
+    std::transform(
+        workflows.begin(),
+        workflows.end(),
+        std::inserter(output, output.end()),
+        [](const std::string& id) -> OTIdentifier {
+            return Identifier::Factory(id);
+        });
+
+    return output;
+}
+
 OTIdentifier Workflow::WriteCheque(const opentxs::Cheque& cheque) const
 {
     if (false == isCheque(cheque)) {
@@ -32,6 +32,9 @@
 #define CLIENT_SEND_TIMEOUT CLIENT_SEND_TIMEOUT_SECONDS
 #define CLIENT_RECV_TIMEOUT CLIENT_RECV_TIMEOUT_SECONDS
 #define KEEP_ALIVE_SECONDS 30
+#define BINARY_FRAMING true
+// Z_BEST_SPEED
+#define WIRE_COMPRESSION 1
 
 #define OT_METHOD "opentxs::api::ZMQ::"
 
@@ -54,6 +57,8 @@ ZMQ::ZMQ(const api::Core& api, const Flag& running)
     , receive_timeout_(std::chrono::seconds(CLIENT_RECV_TIMEOUT))
     , send_timeout_(std::chrono::seconds(CLIENT_SEND_TIMEOUT))
     , keep_alive_(std::chrono::seconds(0))
+    , binary_framing_(BINARY_FRAMING)
+    , wire_compression_(WIRE_COMPRESSION)
     , lock_()
     , socks_proxy_()
     , server_connections_()
@@ -67,6 +72,8 @@ ZMQ::ZMQ(const api::Core& api, const Flag& running)
     init(lock);
 }
 
+bool ZMQ::BinaryFraming() const { return binary_framing_.load(); }
+
 const opentxs::network::zeromq::Context& ZMQ::Context() const
 {
     return api_.ZeroMQ();
@@ -135,6 +142,22 @@ void ZMQ::init(const Lock& lock) const
         keepAlive,
         notUsed);
     keep_alive_.store(std::chrono::seconds(keepAlive));
+    bool binary{BINARY_FRAMING};
+    api_.Config().CheckSet_bool(
+        String::Factory("Connection"),
+        String::Factory("binary_framing"),
+        BINARY_FRAMING,
+        binary,
+        notUsed);
+    binary_framing_.store(binary);
+    std::int64_t compression{WIRE_COMPRESSION};
+    api_.Config().CheckSet_long(
+        String::Factory("Connection"),
+        String::Factory("wire_compression"),
+        WIRE_COMPRESSION,
+        compression,
+        notUsed);
+    wire_compression_.store(static_cast<std::int32_t>(compression));
 
     if (configChecked && haveSocksConfig && socks->Exists()) {
         socks_proxy_ = socks->Get();
@@ -294,5 +317,10 @@ bool ZMQ::verify_lock(const Lock& lock) const
     return true;
 }
 
+std::int32_t ZMQ::WireCompression() const
+{
+    return wire_compression_.load();
+}
+
 ZMQ::~ZMQ() { server_connections_.clear(); }
 }  // namespace opentxs::api::network::implementation
@@ -10,6 +10,7 @@ namespace opentxs::api::network::implementation
 class ZMQ : virtual public opentxs::api::network::ZMQ
 {
 public:
+    bool BinaryFraming() const override;
     const opentxs::network::zeromq::Context& Context() const override;
     proto::AddressType DefaultAddressType() const override;
     std::chrono::seconds KeepAlive() const override;
@@ -27,6 +28,7 @@ public:
     std::string SocksProxy() const override;
     bool SocksProxy(std::string& proxy) const override;
     ConnectionState Status(const std::string& server) const override;
+    std::int32_t WireCompression() const override;
 
     ~ZMQ();
 
@@ -39,6 +41,8 @@ private:
     mutable std::atomic<std::chrono::seconds> receive_timeout_;
     mutable std::atomic<std::chrono::seconds> send_timeout_;
     mutable std::atomic<std::chrono::seconds> keep_alive_;
+    mutable std::atomic<bool> binary_framing_;
+    mutable std::atomic<std::int32_t> wire_compression_;
     mutable std::mutex lock_;
     mutable std::string socks_proxy_;
     mutable std::map<std::string, OTServerConnection> server_connections_;
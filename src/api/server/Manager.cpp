@@ -31,14 +31,18 @@
 #include "server/Server.hpp"
 #include "server/ServerSettings.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <ctime>
 #include <deque>
+#include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Manager.hpp"
 
@@ -48,7 +52,9 @@
 #define MAX_MINT_SERIES 10000
 #define MINT_EXPIRE_MONTHS 6
 #define MINT_VALID_MONTHS 12
-#define MINT_GENERATE_DAYS 7
+#define MINT_GENERATE_DAYS 30
+#define MINT_MAX_UNIT_THREADS 4
+#define MINT_RETRY_SECONDS 3600
 #endif  // OT_CASH
 
 #define OT_METHOD "opentxs::api::server::implementation::Server::"
@@ -110,12 +116,15 @@ Manager::Manager(
           new opentxs::server::MessageProcessor(server_, context, running_))
     , message_processor_(*message_processor_p_)
 #if OT_CASH
-    , mint_thread_()
+    , mint_threads_()
+    , mint_key_threads_(1)
     , mint_lock_()
     , mint_update_lock_()
     , mint_scan_lock_()
     , mints_()
     , mints_to_check_()
+    , mints_in_progress_()
+    , mint_series_()
 #endif  // OT_CASH
 {
     wallet_.reset(opentxs::Factory::Wallet(*this));
@@ -146,18 +155,20 @@ void Manager::DropOutgoing(const int count) const
 }
 
 #if OT_CASH
-void Manager::generate_mint(
+bool Manager::generate_mint(
     const std::string& serverID,
     const std::string& unitID,
-    const std::uint32_t series) const
+    const std::uint32_t series,
+    std::time_t& expires) const
 {
     auto mint = GetPrivateMint(Identifier::Factory(unitID), series);
 
     if (mint) {
         otErr << OT_METHOD << __FUNCTION__ << ": Mint already exists."
               << std::endl;
+        expires = mint->GetExpiration();
 
-        return;
+        return true;
     }
 
     const std::string nymID{NymID().str()};
@@ -177,16 +188,21 @@ void Manager::generate_mint(
         std::chrono::hours(MINT_EXPIRE_MONTHS * 30 * 24));
     const std::chrono::seconds validInterval(
         std::chrono::hours(MINT_VALID_MONTHS * 30 * 24));
-    const std::time_t expires = now + expireInterval.count();
     const std::time_t validTo = now + validInterval.count();
+    expires = now + expireInterval.count();
 
     if (false == verify_mint_directory(serverID)) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Failed to create mint directory." << std::endl;
 
-        return;
+        return false;
     }
 
+    LogNormal(OT_METHOD)(__FUNCTION__)(": Generating series ")(series)(
+        " of the mint for ")(unitID)
+        .Flush();
+    const auto start = std::chrono::steady_clock::now();
+    mint->SetGenerationThreads(mint_key_threads_);
     mint->GenerateNewMint(
         *wallet_,
         series,
@@ -217,11 +233,18 @@ void Manager::generate_mint(
     mint->SignContract(nym);
     mint->SaveContract();
     mint->SaveMint();
-    mint->SaveMint(seriesID.c_str());
+    const bool saved = mint->SaveMint(seriesID.c_str());
     mint->ReleaseSignatures();
     mint->SignContract(nym);
     mint->SaveContract();
     mint->SaveMint(PUBLIC_SERIES);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - start);
+    LogNormal(OT_METHOD)(__FUNCTION__)(": Generated series ")(series)(
+        " of the mint for ")(unitID)(" in ")(elapsed.count())(" seconds")
+        .Flush();
+
+    return saved;
 }
 #endif  // OT_CASH
 const std::string Manager::get_arg(const std::string& argName) const
@@ -367,7 +390,18 @@ void Manager::Init()
     OT_ASSERT(seeds_);
 
 #if OT_CASH
-    mint_thread_ = std::thread(&Manager::mint, this);
+    // Each unit's keys are generated on several threads, so only a few units
+    // are worked on at once, and the two together are kept to about one
+    // thread per core
+    const std::size_t cores =
+        std::max(1u, std::thread::hardware_concurrency());
+    const auto workers =
+        std::min(cores, static_cast<std::size_t>(MINT_MAX_UNIT_THREADS));
+    mint_key_threads_ = std::max(std::size_t(1), cores / workers);
+
+    for (std::size_t i = 0; i < workers; ++i) {
+        mint_threads_.emplace_back(&Manager::mint, this);
+    }
 #endif  // OT_CASH
 
     Scheduler::Start(storage_.get(), dht_.get());
@@ -375,27 +409,62 @@ void Manager::Init()
     Start();
 }
 
+std::int32_t Manager::LastSeries(
+    const std::function<bool(const std::int32_t)>& exists,
+    const std::int32_t limit)
+{
+    if ((0 >= limit) || (false == exists(0))) { return -1; }
+
+    // Gallop forward to bracket the newest series, then bisect the bracket
+    std::int32_t low{0};
+    std::int32_t high{1};
+
+    while ((high < limit) && exists(high)) {
+        low = high;
+        high = (high > (limit / 2)) ? limit : (2 * high);
+    }
+
+    while (1 < (high - low)) {
+        const auto middle = low + ((high - low) / 2);
+
+        if (exists(middle)) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
 #if OT_CASH
 std::int32_t Manager::last_generated_series(
     const std::string& serverID,
     const std::string& unitID) const
 {
-    std::uint32_t output{0};
+    Lock updateLock(mint_update_lock_);
+    const auto it = mint_series_.find(unitID);
+
+    if (mint_series_.end() != it) { return it->second.last_; }
 
-    for (output = 0; output < MAX_MINT_SERIES; ++output) {
+    updateLock.unlock();
+    auto exists = [&](const std::int32_t series) -> bool {
         const std::string filename =
-            unitID + SERIES_DIVIDER + std::to_string(output);
-        const auto exists = OTDB::Exists(
+            unitID + SERIES_DIVIDER + std::to_string(series);
+
+        return OTDB::Exists(
             data_folder_,
             OTFolders::Mint().Get(),
             serverID.c_str(),
             filename.c_str(),
             "");
+    };
+    const auto output = LastSeries(exists, MAX_MINT_SERIES);
 
-        if (false == exists) { return output - 1; }
-    }
+    updateLock.lock();
+    mint_series_[unitID].last_ = output;
 
-    return -1;
+    return output;
 }
 
 std::shared_ptr<Mint> Manager::load_private_mint(
@@ -445,56 +514,67 @@ void Manager::mint() const
 
     OT_ASSERT(false == serverID.empty());
 
+    bool idle{true};
+
     while (running_) {
-        Log::Sleep(std::chrono::milliseconds(250));
+        if (idle) { Log::Sleep(std::chrono::milliseconds(250)); }
 
         if (false == opentxs::server::ServerSettings::__cmd_get_mint) {
+            idle = true;
+
             continue;
         }
 
-        std::string unitID{""};
         updateLock.lock();
-
-        if (0 < mints_to_check_.size()) {
-            unitID = mints_to_check_.back();
-            mints_to_check_.pop_back();
-        }
-
+        const auto unitID = next_mint(updateLock);
         updateLock.unlock();
+        idle = unitID.empty();
 
-        if (unitID.empty()) { continue; }
+        if (idle) { continue; }
 
-        const auto last = last_generated_series(serverID, unitID);
-        const auto next = last + 1;
-
-        if (0 > last) {
-            generate_mint(serverID, unitID, 0);
+        update_mint(serverID, unitID);
+        updateLock.lock();
+        mints_in_progress_.erase(unitID);
+        updateLock.unlock();
+    }
+}
 
-            continue;
-        }
+std::string Manager::next_mint(const Lock& lock) const
+{
+    OT_ASSERT(verify_lock(lock, mint_update_lock_));
 
-        auto mint = GetPrivateMint(Identifier::Factory(unitID), last);
+    if (mints_to_check_.empty()) {
+        // Units are checked again when their next series is due, whether or
+        // not anything else asks for them
+        const auto now = std::time(nullptr);
 
-        if (false == bool(mint)) {
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Failed to load existing series." << std::endl;
+        for (const auto& [unitID, index] : mint_series_) {
+            const bool due = (0 < index.generate_) && (now >= index.generate_);
 
-            continue;
+            if (due && (0 == mints_in_progress_.count(unitID))) {
+                mints_to_check_.push_front(unitID);
+            }
         }
+    }
 
-        const auto now = std::time(nullptr);
-        const std::time_t expires = mint->GetExpiration();
-        const std::chrono::seconds limit(
-            std::chrono::hours(24 * MINT_GENERATE_DAYS));
-        const bool generate = ((now + limit.count()) > expires);
-
-        if (generate) {
-            generate_mint(serverID, unitID, next);
-        } else {
-            otErr << OT_METHOD << __FUNCTION__ << ": Existing mint file for "
-                  << unitID << " is still valid." << std::endl;
-        }
+    for (auto it = mints_to_check_.rbegin(); it != mints_to_check_.rend();
+         ++it) {
+        if (0 < mints_in_progress_.count(*it)) { continue; }
+
+        const std::string output{*it};
+        mints_to_check_.erase(
+            std::remove(mints_to_check_.begin(), mints_to_check_.end(), output),
+            mints_to_check_.end());
+        mints_in_progress_.emplace(output);
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Checking mint for ")(output)(
+            ". ")(mints_to_check_.size())(" units waiting, ")(
+            mints_in_progress_.size())(" in progress.")
+            .Flush();
+
+        return output;
     }
+
+    return {};
 }
 #endif  // OT_CASH
 
@@ -546,6 +626,54 @@ void Manager::UpdateMint(const Identifier& unitID) const
     Lock updateLock(mint_update_lock_);
     mints_to_check_.push_front(unitID.str());
 }
+
+void Manager::update_mint(
+    const std::string& serverID,
+    const std::string& unitID) const
+{
+    const auto last = last_generated_series(serverID, unitID);
+    const auto now = std::time(nullptr);
+    const std::chrono::seconds limit(
+        std::chrono::hours(24 * MINT_GENERATE_DAYS));
+    auto series{last};
+    std::time_t expires{0};
+    bool generate{0 > last};
+
+    if (false == generate) {
+        auto mint = GetPrivateMint(Identifier::Factory(unitID), last);
+
+        if (mint) {
+            expires = mint->GetExpiration();
+            generate = ((now + limit.count()) > expires);
+        } else {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to load existing series." << std::endl;
+        }
+    }
+
+    if (generate) {
+        if (generate_mint(serverID, unitID, last + 1, expires)) {
+            series = last + 1;
+        } else {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to generate mint "
+                  << "for " << unitID << std::endl;
+            expires = 0;
+        }
+    } else if (0 != expires) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Existing mint file for "
+              << unitID << " is still valid." << std::endl;
+    }
+
+    Lock updateLock(mint_update_lock_);
+    auto& index = mint_series_[unitID];
+    index.last_ = series;
+
+    if (0 == expires) {
+        index.generate_ = now + MINT_RETRY_SECONDS;
+    } else {
+        index.generate_ = expires - limit.count();
+    }
+}
 #endif  // OT_CASH
 
 bool Manager::verify_lock(const Lock& lock, const std::mutex& mutex) const
@@ -619,7 +747,9 @@ Manager::~Manager()
 {
     running_.Off();
 #if OT_CASH
-    if (mint_thread_.joinable()) { mint_thread_.join(); }
+    for (auto& thread : mint_threads_) {
+        if (thread.joinable()) { thread.join(); }
+    }
 #endif  // OT_CASH
 
     Cleanup();
@@ -12,6 +12,13 @@ namespace opentxs::api::server::implementation
 class Manager final : opentxs::api::server::Manager, api::implementation::Core
 {
 public:
+    /** Finds the newest of a set of series numbered consecutively from zero
+     *  with O(log n) calls to exists. Returns -1 if there is no series 0.
+     *  Numbers from limit up are never tested. */
+    static std::int32_t LastSeries(
+        const std::function<bool(const std::int32_t)>& exists,
+        const std::int32_t limit);
+
     void DropIncoming(const int count) const override;
     void DropOutgoing(const int count) const override;
     std::string GetAdminNym() const override;
@@ -50,6 +57,12 @@ private:
 
 #if OT_CASH
     typedef std::map<std::string, std::shared_ptr<Mint>> MintSeries;
+
+    // The newest series of a unit's mint, and when to generate the next one
+    struct SeriesIndex {
+        std::int32_t last_{-1};
+        std::time_t generate_{0};
+    };
 #endif  // OT_CASH
 
     std::unique_ptr<opentxs::server::Server> server_p_;
@@ -57,19 +70,23 @@ private:
     std::unique_ptr<opentxs::server::MessageProcessor> message_processor_p_;
     opentxs::server::MessageProcessor& message_processor_;
 #if OT_CASH
-    std::thread mint_thread_;
+    std::vector<std::thread> mint_threads_;
+    std::size_t mint_key_threads_;
     mutable std::mutex mint_lock_;
     mutable std::mutex mint_update_lock_;
     mutable std::mutex mint_scan_lock_;
     mutable std::map<std::string, MintSeries> mints_;
     mutable std::deque<std::string> mints_to_check_;
+    mutable std::set<std::string> mints_in_progress_;
+    mutable std::map<std::string, SeriesIndex> mint_series_;
 #endif  // OT_CASH
 
 #if OT_CASH
-    void generate_mint(
+    bool generate_mint(
         const std::string& serverID,
         const std::string& unitID,
-        const std::uint32_t series) const;
+        const std::uint32_t series,
+        std::time_t& expires) const;
 #endif  // OT_CASH
     const std::string get_arg(const std::string& argName) const;
 #if OT_CASH
@@ -85,6 +102,9 @@ private:
         const std::string& unitID,
         const std::string seriesID) const;
     void mint() const;
+    std::string next_mint(const Lock& lock) const;
+    void update_mint(const std::string& serverID, const std::string& unitID)
+        const;
 #endif  // OT_CASH
     bool verify_lock(const Lock& lock, const std::mutex& mutex) const;
 #if OT_CASH
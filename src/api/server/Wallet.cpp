@@ -40,7 +40,8 @@ std::shared_ptr<const opentxs::ClientContext> Wallet::ClientContext(
     const Identifier& remoteNymID) const
 {
     const auto& serverNymID = server_.NymID();
-    auto base = context(serverNymID, remoteNymID);
+    Lock lock(context_map_lock_);
+    auto base = context(lock, serverNymID, remoteNymID);
     auto output = std::dynamic_pointer_cast<const opentxs::ClientContext>(base);
 
     return output;
@@ -50,7 +51,9 @@ std::shared_ptr<const opentxs::Context> Wallet::Context(
     [[maybe_unused]] const Identifier& notaryID,
     const Identifier& clientNymID) const
 {
-    return context(server_.NymID(), clientNymID);
+    Lock lock(context_map_lock_);
+
+    return context(lock, server_.NymID(), clientNymID);
 }
 
 void Wallet::instantiate_client_context(
@@ -142,7 +145,7 @@ Editor<opentxs::ClientContext> Wallet::mutable_ClientContext(
     const auto& serverID = server_.ID();
     const auto& serverNymID = server_.NymID();
     Lock lock(context_map_lock_);
-    auto base = context(serverNymID, remoteNymID);
+    auto base = context(lock, serverNymID, remoteNymID);
     std::function<void(opentxs::Context*)> callback =
         [&](opentxs::Context* in) -> void { this->save(in); };
 
@@ -163,6 +166,7 @@ Editor<opentxs::ClientContext> Wallet::mutable_ClientContext(
         auto& entry = context_map_[contextID];
         entry.reset(new opentxs::ClientContext(api_, local, remote, serverID));
         base = entry;
+        cache_context(lock, contextID);
     }
 
     OT_ASSERT(base);
@@ -171,20 +175,26 @@ Editor<opentxs::ClientContext> Wallet::mutable_ClientContext(
 
     OT_ASSERT(nullptr != child);
 
-    return Editor<opentxs::ClientContext>(child, callback);
+    // Holding a reference keeps the context from being evicted while the
+    // editor is alive
+    return Editor<opentxs::ClientContext>(
+        child, callback, [base](const opentxs::ClientContext&) {});
 }
 
 Editor<opentxs::Context> Wallet::mutable_Context(
     const Identifier& notaryID,
     const Identifier& clientNymID) const
 {
-    auto base = context(server_.NymID(), clientNymID);
+    Lock lock(context_map_lock_);
+    auto base = context(lock, server_.NymID(), clientNymID);
+    lock.unlock();
     std::function<void(opentxs::Context*)> callback =
         [&](opentxs::Context* in) -> void { this->save(in); };
 
     OT_ASSERT(base);
 
-    return Editor<opentxs::Context>(base.get(), callback);
+    return Editor<opentxs::Context>(
+        base.get(), callback, [base](const opentxs::Context&) {});
 }
 
 std::shared_ptr<const opentxs::Nym> Wallet::signer_nym(
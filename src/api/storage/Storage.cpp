@@ -12,6 +12,7 @@
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Flag.hpp"
+#include "opentxs/core/Log.hpp"
 #include "opentxs/core/OTStorage.hpp"
 
 #include "storage/tree/Accounts.hpp"
@@ -155,6 +156,30 @@ api::storage::StorageInternal* Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("map_slice_objects"),
+        storageConfig.map_slice_objects_,
+        storageConfig.map_slice_objects_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("map_slice_pause"),
+        storageConfig.map_slice_pause_,
+        storageConfig.map_slice_pause_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("write_batch_window"),
+        storageConfig.write_batch_window_,
+        storageConfig.write_batch_window_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("write_batch_bytes"),
+        storageConfig.write_batch_bytes_,
+        storageConfig.write_batch_bytes_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -228,6 +253,30 @@ api::storage::StorageInternal* Factory::Storage(
         String::Factory(storageConfig.sqlite3_db_file_),
         storageConfig.sqlite3_db_file_,
         notUsed);
+    config.CheckSet_str(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_journal_mode"),
+        String::Factory(storageConfig.sqlite3_journal_mode_),
+        storageConfig.sqlite3_journal_mode_,
+        notUsed);
+    config.CheckSet_str(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_synchronous"),
+        String::Factory(storageConfig.sqlite3_synchronous_),
+        storageConfig.sqlite3_synchronous_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_read_connections"),
+        storageConfig.sqlite3_read_connections_,
+        storageConfig.sqlite3_read_connections_,
+        notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("sqlite3_busy_timeout"),
+        storageConfig.sqlite3_busy_timeout_,
+        storageConfig.sqlite3_busy_timeout_,
+        notUsed);
 #endif
 #if OT_STORAGE_LMDB
     config.CheckSet_str(
@@ -324,6 +373,15 @@ Storage::Storage(
           hash,
           random))
     , multiplex_(*multiplex_p_)
+    , map_lock_()
+    , nym_maps_()
+    , server_maps_()
+    , unit_maps_()
+    , map_executor_(1)
+    , nym_map_task_(map_executor_.Add([this]() -> void { run_map_nyms(); }))
+    , server_map_task_(
+          map_executor_.Add([this]() -> void { run_map_servers(); }))
+    , unit_map_task_(map_executor_.Add([this]() -> void { run_map_units(); }))
 {
     OT_ASSERT(multiplex_p_);
 }
@@ -622,6 +680,8 @@ ObjectList Storage::BlockchainTransactionList() const
 
 void Storage::Cleanup_Storage()
 {
+    map_executor_.Stop();
+
     for (auto& thread : background_threads_) {
         if (thread.joinable()) { thread.join(); }
     }
@@ -1079,6 +1139,33 @@ bool Storage::Load(
     return bool(thread);
 }
 
+bool Storage::Load(
+    const std::string& nymId,
+    const std::string& threadId,
+    const std::size_t start,
+    const std::size_t count,
+    std::shared_ptr<proto::StorageThread>& thread) const
+{
+    const bool exists =
+        Root().Tree().NymNode().Nym(nymId).Threads().Exists(threadId);
+
+    if (!exists) { return false; }
+
+    thread.reset(new proto::StorageThread);
+
+    if (!thread) { return false; }
+
+    *thread = Root()
+                  .Tree()
+                  .NymNode()
+                  .Nym(nymId)
+                  .Threads()
+                  .Thread(threadId)
+                  .Items(start, count);
+
+    return bool(thread);
+}
+
 bool Storage::Load(
     const std::string& id,
     std::shared_ptr<proto::UnitDefinition>& contract,
@@ -1103,27 +1190,41 @@ const std::set<std::string> Storage::LocalNyms() const
     return Root().Tree().NymNode().LocalNyms();
 }
 
-// Applies a lambda to all public nyms in the database in a detached thread.
+// Applies a lambda to all public nyms in the database on the map thread.
 void Storage::MapPublicNyms(NymLambda& lambda) const
 {
-    std::thread bgMap(&Storage::RunMapPublicNyms, this, lambda);
-    bgMap.detach();
+    Lock lock(map_lock_);
+    nym_maps_.emplace_back(lambda);
+    lock.unlock();
+    map_executor_.Wake(nym_map_task_);
 }
 
-// Applies a lambda to all server contracts in the database in a detached
-// thread.
+// Applies a lambda to all server contracts in the database on the map thread.
 void Storage::MapServers(ServerLambda& lambda) const
 {
-    std::thread bgMap(&Storage::RunMapServers, this, lambda);
-    bgMap.detach();
+    Lock lock(map_lock_);
+    server_maps_.emplace_back(lambda);
+    lock.unlock();
+    map_executor_.Wake(server_map_task_);
 }
 
-// Applies a lambda to all unit definitions in the database in a detached
+// Applies a lambda to all unit definitions in the database on the map
 // thread.
 void Storage::MapUnitDefinitions(UnitLambda& lambda) const
 {
-    std::thread bgMap(&Storage::RunMapUnits, this, lambda);
-    bgMap.detach();
+    Lock lock(map_lock_);
+    unit_maps_.emplace_back(lambda);
+    lock.unlock();
+    map_executor_.Wake(unit_map_task_);
+}
+
+void Storage::pace(std::int64_t& count) const
+{
+    if (0 >= config_.map_slice_objects_) { return; }
+
+    if (0 == (++count % config_.map_slice_objects_)) {
+        Log::Sleep(std::chrono::milliseconds(config_.map_slice_pause_));
+    }
 }
 
 opentxs::storage::Root* Storage::root() const
@@ -1348,6 +1449,23 @@ std::set<std::string> Storage::PaymentWorkflowsByAccount(
         accountID);
 }
 
+std::vector<std::string> Storage::PaymentWorkflowsByAccount(
+    const std::string& nymID,
+    const std::string& accountID,
+    const std::size_t start,
+    const std::size_t count) const
+{
+    if (false == Root().Tree().NymNode().Exists(nymID)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Nym " << nymID
+              << " doesn't exist." << std::endl;
+
+        return {};
+    }
+
+    return Root().Tree().NymNode().Nym(nymID).PaymentWorkflows().ListByAccount(
+        accountID, start, count);
+}
+
 std::set<std::string> Storage::PaymentWorkflowsByState(
     const std::string& nymID,
     const proto::PaymentWorkflowType type,
@@ -1641,6 +1759,54 @@ void Storage::RunMapUnits(UnitLambda lambda) const
     return Root().Tree().UnitNode().Map(lambda);
 }
 
+void Storage::run_map_nyms() const
+{
+    const auto pending = take_maps(nym_maps_);
+
+    if (pending.empty()) { return; }
+
+    std::int64_t count{0};
+    RunMapPublicNyms([&](const proto::CredentialIndex& nym) -> void {
+        if (!running_) { return; }
+
+        for (const auto& lambda : pending) { lambda(nym); }
+
+        pace(count);
+    });
+}
+
+void Storage::run_map_servers() const
+{
+    const auto pending = take_maps(server_maps_);
+
+    if (pending.empty()) { return; }
+
+    std::int64_t count{0};
+    RunMapServers([&](const proto::ServerContract& server) -> void {
+        if (!running_) { return; }
+
+        for (const auto& lambda : pending) { lambda(server); }
+
+        pace(count);
+    });
+}
+
+void Storage::run_map_units() const
+{
+    const auto pending = take_maps(unit_maps_);
+
+    if (pending.empty()) { return; }
+
+    std::int64_t count{0};
+    RunMapUnits([&](const proto::UnitDefinition& unit) -> void {
+        if (!running_) { return; }
+
+        for (const auto& lambda : pending) { lambda(unit); }
+
+        pace(count);
+    });
+}
+
 void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
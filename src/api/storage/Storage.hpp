@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include "api/Executor.hpp"
+
 namespace opentxs::api::storage::implementation
 {
 // Content-aware storage module for opentxs
@@ -203,6 +205,12 @@ public:
         const std::string& nymId,
         const std::string& threadId,
         std::shared_ptr<proto::StorageThread>& thread) const override;
+    bool Load(
+        const std::string& nymId,
+        const std::string& threadId,
+        const std::size_t start,
+        const std::size_t count,
+        std::shared_ptr<proto::StorageThread>& thread) const override;
     bool Load(
         const std::string& id,
         std::shared_ptr<proto::UnitDefinition>& contract,
@@ -231,6 +239,11 @@ public:
     std::set<std::string> PaymentWorkflowsByAccount(
         const std::string& nymID,
         const std::string& accountID) const override;
+    std::vector<std::string> PaymentWorkflowsByAccount(
+        const std::string& nymID,
+        const std::string& accountID,
+        const std::size_t start,
+        const std::size_t count) const override;
     std::set<std::string> PaymentWorkflowsByState(
         const std::string& nymID,
         const proto::PaymentWorkflowType type,
@@ -365,9 +378,33 @@ private:
     const StorageConfig config_;
     std::unique_ptr<Multiplex> multiplex_p_;
     Multiplex& multiplex_;
+    // Map requests made while a sweep of the same tree is queued or running
+    // are combined into the next sweep
+    mutable std::mutex map_lock_;
+    mutable std::vector<NymLambda> nym_maps_;
+    mutable std::vector<ServerLambda> server_maps_;
+    mutable std::vector<UnitLambda> unit_maps_;
+    api::implementation::Executor map_executor_;
+    const int nym_map_task_;
+    const int server_map_task_;
+    const int unit_map_task_;
+
+    template <typename Lambda>
+    std::vector<Lambda> take_maps(std::vector<Lambda>& pending) const
+    {
+        Lock lock(map_lock_);
+        std::vector<Lambda> output{};
+        output.swap(pending);
+
+        return output;
+    }
 
     opentxs::storage::Root* root() const;
+    void pace(std::int64_t& count) const;
     const opentxs::storage::Root& Root() const;
+    void run_map_nyms() const;
+    void run_map_servers() const;
+    void run_map_units() const;
     bool verify_write_lock(const Lock& lock) const;
 
     void Cleanup();
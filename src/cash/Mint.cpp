@@ -33,6 +33,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::Mint"
 
@@ -119,6 +120,20 @@ Mint::Mint(const api::Core& core)
 // Todo:  Someday...
 #endif  // Magic Money
 
+bool Mint::AddDenominations(
+    const Nym& theNotary,
+    const std::vector<std::int64_t>& denominations,
+    std::int32_t nPrimeLength)
+{
+    bool output{true};
+
+    for (const auto& denomination : denominations) {
+        output &= AddDenomination(theNotary, denomination, nPrimeLength);
+    }
+
+    return output;
+}
+
 // Verify the current date against the VALID FROM / EXPIRATION dates.
 // (As opposed to tokens, which are verified against the valid from/to dates.)
 bool Mint::Expired() const
@@ -697,56 +712,23 @@ void Mint::GenerateNewMint(
 
     account.Release();
 
-    if (nDenom1) {
-        AddDenomination(
-            theNotary,
-            nDenom1);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom2) {
-        AddDenomination(
-            theNotary,
-            nDenom2);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom3) {
-        AddDenomination(
-            theNotary,
-            nDenom3);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom4) {
-        AddDenomination(
-            theNotary,
-            nDenom4);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom5) {
-        AddDenomination(
-            theNotary,
-            nDenom5);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom6) {
-        AddDenomination(
-            theNotary,
-            nDenom6);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom7) {
-        AddDenomination(
-            theNotary,
-            nDenom7);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom8) {
-        AddDenomination(
-            theNotary,
-            nDenom8);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom9) {
-        AddDenomination(
-            theNotary,
-            nDenom9);  // std::int32_t nPrimeLength default = 1024
-    }
-    if (nDenom10) {
-        AddDenomination(
-            theNotary,
-            nDenom10);  // std::int32_t nPrimeLength default = 1024
+    std::vector<std::int64_t> denominations{};
+
+    for (const auto& denomination :
+         {nDenom1,
+          nDenom2,
+          nDenom3,
+          nDenom4,
+          nDenom5,
+          nDenom6,
+          nDenom7,
+          nDenom8,
+          nDenom9,
+          nDenom10}) {
+        if (0 != denomination) { denominations.push_back(denomination); }
     }
+
+    AddDenominations(theNotary, denominations);
 }
 
 Mint::~Mint() { Release_Mint(); }
@@ -27,7 +27,11 @@
 #include <openssl/ossl_typ.h>
 #include <stdio.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <atomic>
 #include <ostream>
+#include <thread>
+#include <vector>
 
 #ifdef __APPLE__
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -62,6 +66,40 @@ MintLucre::MintLucre(
 {
 }
 
+bool MintLucre::add_bank(
+    const Nym& theNotary,
+    std::int64_t lDenomination,
+    const String& strPublicBank,
+    const String& strPrivateBank)
+{
+    auto pPublic = Armored::Factory();
+    auto pPrivate = Armored::Factory();
+
+    // Set the public bank info onto pPublic
+    pPublic->SetString(strPublicBank, true);  // linebreaks = true
+
+    // Seal the private bank info up into an encrypted Envelope
+    // and set it onto pPrivate
+    OTEnvelope theEnvelope;
+    theEnvelope.Seal(theNotary, strPrivateBank);  // Todo check the return
+                                                  // values on these two
+                                                  // functions
+    theEnvelope.GetCiphertext(pPrivate);
+
+    // Add the new key pair to the maps, using denomination as the key
+    m_mapPublic.emplace(lDenomination, std::move(pPublic));
+    m_mapPublic.emplace(lDenomination, std::move(pPrivate));
+
+    // Grab the Server Nym ID and save it with this Mint
+    theNotary.GetIdentifier(m_ServerNymID);
+    m_nDenominationCount++;
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Successfully added denomination: ")(
+        lDenomination)
+        .Flush();
+
+    return true;
+}
+
 // The mint has a different key pair for each denomination.
 // Pass the actual denomination such as 5, 10, 20, 50, 100...
 bool MintLucre::AddDenomination(
@@ -69,8 +107,96 @@ bool MintLucre::AddDenomination(
     std::int64_t lDenomination,
     std::int32_t nPrimeLength)
 {
-    bool bReturnValue = false;
+    auto strPublicBank = String::Factory();
+    auto strPrivateBank = String::Factory();
+
+    if (false == check_denomination(lDenomination, nPrimeLength)) {
+        return false;
+    }
+
+    if (false == generate_bank(nPrimeLength, strPublicBank, strPrivateBank)) {
+        return false;
+    }
+
+    return add_bank(theNotary, lDenomination, strPublicBank, strPrivateBank);
+}
+
+// Generating a bank means finding large primes, which dominates the time it
+// takes to create a mint. Each bank is independent of the others, so they are
+// generated concurrently. Sealing the private halves with the notary's key
+// and adding them to the maps still happens on the calling thread.
+bool MintLucre::AddDenominations(
+    const Nym& theNotary,
+    const std::vector<std::int64_t>& denominations,
+    std::int32_t nPrimeLength)
+{
+    bool output{true};
+    std::vector<std::int64_t> pending{};
+
+    for (const auto& denomination : denominations) {
+        if (check_denomination(denomination, nPrimeLength)) {
+            pending.push_back(denomination);
+        } else {
+            output = false;
+        }
+    }
+
+    const auto count = pending.size();
+
+    if (0 == count) { return output; }
+
+    std::vector<OTString> publicBanks{};
+    std::vector<OTString> privateBanks{};
+    // Not std::vector<bool>, since workers write to neighbouring elements
+    std::vector<std::uint8_t> generated(count, 0);
 
+    for (std::size_t i = 0; i < count; ++i) {
+        publicBanks.emplace_back(String::Factory());
+        privateBanks.emplace_back(String::Factory());
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    auto worker = [&]() {
+        for (auto i = next++; i < count; i = next++) {
+            generated[i] = generate_bank(
+                nPrimeLength, publicBanks.at(i), privateBanks.at(i));
+            LogDetail(OT_METHOD)(__FUNCTION__)(": Generated key ")(++done)(
+                " of ")(count)(" for series ")(m_nSeries)
+                .Flush();
+        }
+    };
+    std::size_t threads = m_nGenerationThreads;
+
+    if (0 == threads) { threads = std::thread::hardware_concurrency(); }
+
+    threads = std::max<std::size_t>(1, std::min(threads, count));
+    std::vector<std::thread> workers{};
+
+    for (std::size_t i = 1; i < threads; ++i) { workers.emplace_back(worker); }
+
+    worker();
+
+    for (auto& thread : workers) { thread.join(); }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (0 == generated.at(i)) {
+            output = false;
+
+            continue;
+        }
+
+        output &= add_bank(
+            theNotary, pending.at(i), publicBanks.at(i), privateBanks.at(i));
+    }
+
+    return output;
+}
+
+bool MintLucre::check_denomination(
+    std::int64_t lDenomination,
+    std::int32_t nPrimeLength)
+{
     // Let's make sure it doesn't already exist
     auto theArmor = Armored::Factory();
     if (GetPublic(theArmor, lDenomination)) {
@@ -95,6 +221,14 @@ bool MintLucre::AddDenomination(
         return false;
     }
 
+    return true;
+}
+
+bool MintLucre::generate_bank(
+    std::int32_t nPrimeLength,
+    String& strPublicBank,
+    String& strPrivateBank)
+{
 #if OT_LUCRE_DEBUG
 #ifdef _WIN32
     BIO* out = BIO_new_file("openssl.dump", "w");
@@ -130,39 +264,13 @@ bool MintLucre::AddDenomination(
     if (privatebankLen && publicbankLen) {
         // With this, we have the Lucre public and private bank info converted
         // to OTStrings
-        auto strPublicBank = String::Factory();
-        strPublicBank->Set(publicBankBuffer, publicbankLen);
-        auto strPrivateBank = String::Factory();
-        strPrivateBank->Set(privateBankBuffer, privatebankLen);
-
-        auto pPublic = Armored::Factory();
-        auto pPrivate = Armored::Factory();
-
-        // Set the public bank info onto pPublic
-        pPublic->SetString(strPublicBank, true);  // linebreaks = true
-
-        // Seal the private bank info up into an encrypted Envelope
-        // and set it onto pPrivate
-        OTEnvelope theEnvelope;
-        theEnvelope.Seal(theNotary, strPrivateBank);  // Todo check the return
-                                                      // values on these two
-                                                      // functions
-        theEnvelope.GetCiphertext(pPrivate);
-
-        // Add the new key pair to the maps, using denomination as the key
-        m_mapPublic.emplace(lDenomination, std::move(pPublic));
-        m_mapPublic.emplace(lDenomination, std::move(pPrivate));
-
-        // Grab the Server Nym ID and save it with this Mint
-        theNotary.GetIdentifier(m_ServerNymID);
-        m_nDenominationCount++;
-        bReturnValue = true;
-        LogDetail(OT_METHOD)(__FUNCTION__)(
-            ": Successfully added denomination: ")(lDenomination)
-            .Flush();
+        strPublicBank.Set(publicBankBuffer, publicbankLen);
+        strPrivateBank.Set(privateBankBuffer, privatebankLen);
+
+        return true;
     }
 
-    return bReturnValue;
+    return false;
 }
 
 #if OT_CRYPTO_USING_OPENSSL
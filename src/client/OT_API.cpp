@@ -333,7 +333,7 @@ bool OT_API::Init()
     // This way, everywhere else I can use the default storage context (for now)
     // and it will work everywhere I put it. (Because it's now set up...)
     m_bDefaultStore = OTDB::InitDefaultStorage(
-        OTDB_DEFAULT_STORAGE,
+        OTDB::ConfiguredStorageType(api_.Config()),
         OTDB_DEFAULT_PACKER);  // We only need to do this once now.
 
     if (m_bDefaultStore) {
@@ -24,8 +24,11 @@
 
 #include "Data.hpp"
 
-#include <set>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <map>
+#include <set>
 
 #include "Identifier.hpp"
 
@@ -41,6 +44,21 @@ bool less<opentxs::Pimpl<opentxs::Identifier>>::operator()(
 {
     return lhs.get() < rhs.get();
 }
+
+std::size_t hash<opentxs::Pimpl<opentxs::Identifier>>::operator()(
+    const opentxs::OTIdentifier& id) const noexcept
+{
+    // Identifiers are already the output of a cryptographic hash function so
+    // the leading bytes of the digest are uniformly distributed.
+    std::size_t output{0};
+    const auto size = id->size();
+
+    if (0 == size) { return output; }
+
+    std::memcpy(&output, id->data(), std::min(size, sizeof(output)));
+
+    return output ^ static_cast<std::size_t>(id->Type());
+}
 }  // namespace std
 
 namespace opentxs
@@ -217,38 +235,32 @@ Identifier::Identifier(
 
 bool Identifier::operator==(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return ots1->Compare(ots2);
+    return 0 == compare(s2);
 }
 
 bool Identifier::operator!=(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return !(ots1->Compare(ots2));
+    return 0 != compare(s2);
 }
 
 bool Identifier::operator>(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return ots1->operator>(ots2);
+    return 0 < compare(s2);
 }
 
 bool Identifier::operator<(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return ots1->operator<(ots2);
+    return 0 > compare(s2);
 }
 
 bool Identifier::operator<=(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return ots1->operator<=(ots2);
+    return 0 >= compare(s2);
 }
 
 bool Identifier::operator>=(const opentxs::Identifier& s2) const
 {
-    const auto ots1 = String::Factory(*this), ots2 = String::Factory(s2);
-    return ots1->operator>=(ots2);
+    return 0 <= compare(s2);
 }
 
 bool Identifier::CalculateDigest(const String& strInput, const ID type)
@@ -272,6 +284,33 @@ Identifier* Identifier::clone() const
     return new Identifier(data_, position_, type_);
 }
 
+// Orders by type byte, then by digest bytes. Empty identifiers have no string
+// form regardless of type, so they are all equal and sort before anything else.
+int Identifier::compare(const opentxs::Identifier& rhs) const
+{
+    const auto lSize = size();
+    const auto rSize = rhs.size();
+
+    if ((0 == lSize) || (0 == rSize)) {
+        if (lSize == rSize) { return 0; }
+
+        return (0 == lSize) ? -1 : 1;
+    }
+
+    const auto lType = static_cast<std::uint8_t>(type_);
+    const auto rType = static_cast<std::uint8_t>(rhs.Type());
+
+    if (lType != rType) { return (lType < rType) ? -1 : 1; }
+
+    const auto result = std::memcmp(data(), rhs.data(), std::min(lSize, rSize));
+
+    if (0 != result) { return result; }
+
+    if (lSize == rSize) { return 0; }
+
+    return (lSize < rSize) ? -1 : 1;
+}
+
 Identifier* Identifier::contract_contents_to_identifier(const Contract& in)
 {
     auto output = new Identifier();
@@ -286,20 +325,38 @@ Identifier* Identifier::contract_contents_to_identifier(const Contract& in)
 // This Identifier is stored in binary form.
 // But what if you want a pretty string version of it?
 // Just call this function.
+//
+// The encoded form is memoized together with the bytes it was calculated
+// from, so repeated calls only pay for a short comparison unless the
+// identifier has been modified in the mean time.
 void Identifier::GetString(String& id) const
 {
-    auto data = Data::Factory();
-    data->Assign(&type_, sizeof(type_));
-
-    OT_ASSERT(1 == data->size());
-
     if (0 == size()) { return; }
 
-    data->Concatenate(this->data(), size());
+    Lock lock(string_lock_);
+    const auto type = static_cast<std::uint8_t>(type_);
+    const bool cached = (false == cached_string_.empty()) &&
+                        (cached_bytes_.size() == (size() + 1)) &&
+                        (cached_bytes_.front() == type) &&
+                        (0 == std::memcmp(
+                                  cached_bytes_.data() + 1, data(), size()));
+
+    if (false == cached) {
+        auto data = Data::Factory();
+        data->Assign(&type_, sizeof(type_));
+
+        OT_ASSERT(1 == data->size());
+
+        data->Concatenate(this->data(), size());
+        cached_bytes_.assign(
+            static_cast<const std::uint8_t*>(data->data()),
+            static_cast<const std::uint8_t*>(data->data()) + data->size());
+        cached_string_ =
+            "ot" + OT::App().Crypto().Encode().IdentifierEncode(data);
+    }
 
-    auto output = String::Factory("ot");
-    output->Concatenate(String::Factory(
-        OT::App().Crypto().Encode().IdentifierEncode(data).c_str()));
+    auto output = String::Factory(cached_string_.c_str());
+    lock.unlock();
     id.swap(output);
 }
 
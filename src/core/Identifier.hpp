@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include <mutex>
+
 namespace opentxs::implementation
 {
 class Identifier final : virtual public opentxs::Identifier, public Data
@@ -46,8 +48,12 @@ private:
     static const std::size_t MinimumSize{10};
 
     ID type_{DefaultType};
+    mutable std::mutex string_lock_;
+    mutable Vector cached_bytes_;
+    mutable std::string cached_string_;
 
     Identifier* clone() const override;
+    int compare(const opentxs::Identifier& rhs) const;
 
     static Identifier* contract_contents_to_identifier(const Contract& in);
     static proto::HashType IDToHashType(const ID type);
@@ -171,6 +171,10 @@ bool Ledger::SaveBoxReceipts()  // For ALL full transactions, save the actual
                                 // box receipt for each to its own place.
 {
     bool bRetVal = true;
+    // All the receipts are committed together (where the storage backend
+    // supports it), instead of one write per receipt.
+    const bool bBatched = OTDB::BeginBatch(api_.DataFolder());
+
     for (auto& it : m_mapTransactions) {
         auto pTransaction = it.second;
         OT_ASSERT(false != bool(pTransaction));
@@ -191,6 +195,15 @@ bool Ledger::SaveBoxReceipts()  // For ALL full transactions, save the actual
             break;
         }
     }
+
+    if (bBatched) {
+        if (bRetVal) {
+            bRetVal = OTDB::CommitBatch(api_.DataFolder());
+        } else {
+            OTDB::AbortBatch(api_.DataFolder());
+        }
+    }
+
     return bRetVal;
 }
 
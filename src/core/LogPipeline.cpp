@@ -0,0 +1,248 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/api/Native.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/PushSocket.hpp"
+#include "opentxs/OT.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+#include "LogPipeline.hpp"
+
+#define LOG_SINK "inproc://opentxs/logsink/1"
+// Maximum number of lines sent to the sink in one message
+#define LOG_BATCH_LINES 64
+// Rings are drained at least this often
+#define LOG_DRAIN_MILLISECONDS 50
+
+namespace zmq = opentxs::network::zeromq;
+
+namespace opentxs::implementation
+{
+LogPipeline::Ring::Ring(const std::string& thread)
+    : line_()
+    , thread_(thread)
+    , slots_()
+    , head_(0)
+    , tail_(0)
+    , dropped_(0)
+{
+}
+
+bool LogPipeline::Ring::Pop(int& level, std::string& text)
+{
+    const auto head = head_.load(std::memory_order_relaxed);
+
+    if (head == tail_.load(std::memory_order_acquire)) { return false; }
+
+    auto& slot = slots_.at(head);
+    level = slot.level_;
+    text.swap(slot.text_);
+    slot.text_.clear();
+    head_.store((head + 1) % LOG_RING_SIZE, std::memory_order_release);
+
+    return true;
+}
+
+bool LogPipeline::Ring::Push(const int level, std::string& text)
+{
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    const auto next = (tail + 1) % LOG_RING_SIZE;
+
+    if (next == head_.load(std::memory_order_acquire)) {
+        ++dropped_;
+        text.clear();
+
+        return false;
+    }
+
+    // Swapping hands the slot's old allocation back to the caller, so a
+    // thread which logs steadily stops allocating once its ring is warm.
+    auto& slot = slots_.at(tail);
+    slot.level_ = level;
+    slot.text_.swap(text);
+    text.clear();
+    tail_.store(next, std::memory_order_release);
+
+    return true;
+}
+
+std::size_t LogPipeline::Ring::Size() const
+{
+    const auto head = head_.load(std::memory_order_acquire);
+    const auto tail = tail_.load(std::memory_order_acquire);
+
+    return (tail + LOG_RING_SIZE - head) % LOG_RING_SIZE;
+}
+
+LogPipeline::LogPipeline()
+    : running_(true)
+    , lock_()
+    , wake_()
+    , notified_(false)
+    , rings_()
+    , drain_(nullptr)
+{
+}
+
+void LogPipeline::collect(OTZMQPushSocket& socket)
+{
+    Lock lock(lock_);
+    auto rings = rings_;
+    lock.unlock();
+    auto message = zmq::Message::Factory();
+    message->AddFrame();
+    std::size_t lines{0};
+    int level{-1};
+    std::string text{};
+    auto send = [&]() -> void {
+        if (0 == lines) { return; }
+
+        socket->Push(message);
+        message = zmq::Message::Factory();
+        message->AddFrame();
+        lines = 0;
+    };
+
+    for (const auto& ring : rings) {
+        while (ring->Pop(level, text)) {
+            message->AddFrame(std::to_string(level));
+            message->AddFrame(text);
+            message->AddFrame(ring->thread_);
+
+            if (LOG_BATCH_LINES <= ++lines) { send(); }
+        }
+
+        const auto dropped = ring->Dropped();
+
+        if (0 < dropped) {
+            message->AddFrame(std::to_string(0));
+            message->AddFrame(
+                std::to_string(dropped) + " log lines dropped (buffer full)");
+            message->AddFrame(ring->thread_);
+
+            if (LOG_BATCH_LINES <= ++lines) { send(); }
+        }
+    }
+
+    send();
+    rings.clear();
+    lock.lock();
+
+    // Only the list holds the ring of a thread which has exited
+    rings_.erase(
+        std::remove_if(
+            rings_.begin(),
+            rings_.end(),
+            [](const std::shared_ptr<Ring>& ring) -> bool {
+                return (1 == ring.use_count()) && (0 == ring->Size());
+            }),
+        rings_.end());
+}
+
+void LogPipeline::drain()
+{
+    auto socket = OT::App().ZMQ().PushSocket(zmq::Socket::Direction::Connect);
+    socket->Start(LOG_SINK);
+
+    while (running_.load()) {
+        Lock lock(lock_);
+        wake_.wait_for(
+            lock,
+            std::chrono::milliseconds(LOG_DRAIN_MILLISECONDS),
+            [&]() -> bool { return notified_ || (false == running_.load()); });
+        notified_ = false;
+        lock.unlock();
+        collect(socket);
+    }
+
+    collect(socket);
+}
+
+void LogPipeline::Flush(const int level)
+{
+    auto* ring = Local();
+
+    if (nullptr == ring) { return; }
+
+    ring->Push(level, ring->line_);
+
+    // Wake the drain thread early rather than let a busy thread fill its ring
+    if ((LOG_RING_SIZE / 2) == ring->Size()) { instance().notify(); }
+}
+
+LogPipeline& LogPipeline::instance()
+{
+    static LogPipeline pipeline{};
+
+    return pipeline;
+}
+
+LogPipeline::Ring* LogPipeline::Local()
+{
+    thread_local std::shared_ptr<Ring> local{nullptr};
+    auto& pipeline = instance();
+
+    if (false == pipeline.running_.load()) { return nullptr; }
+
+    if (local) { return local.get(); }
+
+    return pipeline.register_thread(local);
+}
+
+void LogPipeline::notify()
+{
+    Lock lock(lock_);
+    notified_ = true;
+    lock.unlock();
+    wake_.notify_one();
+}
+
+LogPipeline::Ring* LogPipeline::register_thread(std::shared_ptr<Ring>& local)
+{
+    std::stringstream id{};
+    id << std::this_thread::get_id();
+    local = std::make_shared<Ring>(id.str());
+    Lock lock(lock_);
+
+    if (false == running_.load()) {
+        local.reset();
+
+        return nullptr;
+    }
+
+    rings_.emplace_back(local);
+
+    if (false == bool(drain_)) {
+        drain_.reset(new std::thread(&LogPipeline::drain, this));
+    }
+
+    return local.get();
+}
+
+void LogPipeline::Shutdown() { instance().stop(); }
+
+void LogPipeline::stop()
+{
+    Lock lock(lock_);
+    running_.store(false);
+    notified_ = true;
+    lock.unlock();
+    wake_.notify_all();
+
+    if (drain_ && drain_->joinable()) { drain_->join(); }
+
+    lock.lock();
+    rings_.clear();
+}
+
+LogPipeline::~LogPipeline() { stop(); }
+}  // namespace opentxs::implementation
@@ -0,0 +1,101 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define LOG_RING_SIZE 256
+
+namespace opentxs::implementation
+{
+// Carries finished log lines from the threads which write them to api::Log.
+//
+// Each thread which logs gets its own fixed size ring of lines with a single
+// producer (that thread) and a single consumer (the drain thread), so writing
+// a line never takes a lock or contends with other threads. The drain thread
+// collects lines from every ring and pushes them to the log sink in batches.
+// A line written while its ring is full is dropped and counted instead of
+// blocking the caller. Rings are released once their thread has exited and
+// every line has been drained.
+class LogPipeline
+{
+public:
+    class Ring
+    {
+    public:
+        /** The line being formatted. Only used by the owning thread. */
+        std::string line_;
+        const std::string thread_;
+
+        std::uint64_t Dropped() { return dropped_.exchange(0); }
+        bool Pop(int& level, std::string& text);
+        /** Moves text into the ring. Only called by the owning thread. */
+        bool Push(const int level, std::string& text);
+        std::size_t Size() const;
+
+        explicit Ring(const std::string& thread);
+
+        ~Ring() = default;
+
+    private:
+        struct Slot {
+            int level_{-1};
+            std::string text_{};
+        };
+
+        std::array<Slot, LOG_RING_SIZE> slots_;
+        std::atomic<std::size_t> head_;
+        std::atomic<std::size_t> tail_;
+        std::atomic<std::uint64_t> dropped_;
+
+        Ring() = delete;
+        Ring(const Ring&) = delete;
+        Ring(Ring&&) = delete;
+        Ring& operator=(const Ring&) = delete;
+        Ring& operator=(Ring&&) = delete;
+    };
+
+    /** Queues the calling thread's current line for output */
+    static void Flush(const int level);
+    /** Returns the calling thread's ring, or nullptr after shutdown */
+    static Ring* Local();
+    static void Shutdown();
+
+    ~LogPipeline();
+
+private:
+    std::atomic<bool> running_;
+    std::mutex lock_;
+    std::condition_variable wake_;
+    bool notified_;
+    std::vector<std::shared_ptr<Ring>> rings_;
+    std::unique_ptr<std::thread> drain_;
+
+    static LogPipeline& instance();
+
+    void collect(OTZMQPushSocket& socket);
+    void drain();
+    void notify();
+    Ring* register_thread(std::shared_ptr<Ring>& local);
+    void stop();
+
+    LogPipeline();
+    LogPipeline(const LogPipeline&) = delete;
+    LogPipeline(LogPipeline&&) = delete;
+    LogPipeline& operator=(const LogPipeline&) = delete;
+    LogPipeline& operator=(LogPipeline&&) = delete;
+};
+}  // namespace opentxs::implementation
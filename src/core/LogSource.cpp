@@ -7,25 +7,16 @@
 
 #include "opentxs/core/LogSource.hpp"
 
-#include "opentxs/api/Native.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/StringXML.hpp"
-#include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/PushSocket.hpp"
-#include "opentxs/OT.hpp"
 
-#define LOG_SINK "inproc://opentxs/logsink/1"
-
-namespace zmq = opentxs::network::zeromq;
+#include "LogPipeline.hpp"
 
 namespace opentxs
 {
 std::atomic<int> LogSource::verbosity_{0};
 std::atomic<bool> LogSource::running_{true};
-std::mutex LogSource::buffer_lock_{};
-std::map<std::thread::id, LogSource::Source> LogSource::buffer_{};
 
 LogSource::LogSource(const int logLevel)
     : level_(logLevel)
@@ -34,11 +25,14 @@ LogSource::LogSource(const int logLevel)
 
 const LogSource& LogSource::operator()(const char* in) const
 {
+    // Disabled levels return before touching the thread's line buffer
     if (verbosity_.load() < level_) { return *this; }
 
-    std::string id{};
+    if (false == running_.load()) { return *this; }
+
+    auto* ring = implementation::LogPipeline::Local();
 
-    if (running_.load()) { std::get<1>(get_buffer(id)) << in; }
+    if (nullptr != ring) { ring->line_.append(in); }
 
     return *this;
 }
@@ -85,46 +79,16 @@ const LogSource& LogSource::operator()(const OTIdentifier& in) const
 
 const LogSource& LogSource::operator()(const Identifier& in) const
 {
+    if (verbosity_.load() < level_) { return *this; }
+
     return operator()(in.str().c_str());
 }
 
 void LogSource::Flush() const
 {
-    if (running_.load()) {
-        std::string id{};
-        auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message::Factory();
-        message->AddFrame();
-        message->AddFrame(std::to_string(level_));
-        message->AddFrame(buffer.str());
-        message->AddFrame(id);
-        socket->Push(message);
-        buffer = std::stringstream{};
-    }
-}
+    if (verbosity_.load() < level_) { return; }
 
-LogSource::Source& LogSource::get_buffer(std::string& out)
-{
-    const auto id = std::this_thread::get_id();
-    std::stringstream convert{};
-    convert << id;
-    out = convert.str();
-    auto it = buffer_.find(id);
-
-    if (buffer_.end() == it) {
-        Lock lock(buffer_lock_);
-        auto it = buffer_.emplace(
-            id,
-            Source{OT::App().ZMQ().PushSocket(zmq::Socket::Direction::Connect),
-                   std::stringstream{}});
-        auto& source = std::get<0>(it)->second;
-        auto& socket = std::get<0>(source).get();
-        socket.Start(LOG_SINK);
-
-        return source;
-    }
-
-    return it->second;
+    if (running_.load()) { implementation::LogPipeline::Flush(level_); }
 }
 
 void LogSource::SetVerbosity(const int level) { verbosity_.store(level); }
@@ -132,7 +96,7 @@ void LogSource::SetVerbosity(const int level) { verbosity_.store(level); }
 void LogSource::Shutdown()
 {
     running_.store(false);
-    buffer_.clear();
+    implementation::LogPipeline::Shutdown();
 }
 
 const LogSource& LogSource::StartLog(
@@ -8,6 +8,7 @@
 #include "opentxs/core/OTStorage.hpp"
 
 #include "opentxs/api/Native.hpp"
+#include "opentxs/api/Settings.hpp"
 #include "opentxs/core/util/OTPaths.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Data.hpp"
@@ -15,10 +16,20 @@
 #include "opentxs/core/OTStoragePB.hpp"
 #include "opentxs/OT.hpp"
 
+#if OT_STORAGE_LMDB
+#include "lmdb.h"
+#endif
+
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <typeinfo>
 
+#include "OTStorageLMDB.hpp"
+
 #define OT_METHOD "opentxs::Storage"
 
 /*
@@ -399,6 +410,94 @@ bool InitDefaultStorage(StorageType eStoreType, PackType ePackType)
     return true;
 }
 
+StorageType ConfiguredStorageType(const api::Settings& config)
+{
+    bool notUsed{false};
+    std::string backend{};
+    config.CheckSet_str(
+        String::Factory("otdb"),
+        String::Factory("backend"),
+        String::Factory("filesystem"),
+        backend,
+        notUsed,
+        String::Factory("; filesystem or lmdb"));
+
+    if ("lmdb" == backend) {
+#if OT_STORAGE_LMDB
+        const std::int64_t defaultSize = (sizeof(void*) > 4) ? 16384 : 512;
+        std::int64_t mapSize{0};
+        bool sync{true};
+        config.CheckSet_long(
+            String::Factory("otdb"),
+            String::Factory("lmdb_map_size"),
+            defaultSize,
+            mapSize,
+            notUsed,
+            String::Factory("; Maximum database size, in MiB"));
+        config.CheckSet_bool(
+            String::Factory("otdb"),
+            String::Factory("lmdb_sync"),
+            true,
+            sync,
+            notUsed,
+            String::Factory("; Flush every commit to disk"));
+
+        if (0 >= mapSize) { mapSize = defaultSize; }
+
+        StorageLMDB::SetOptions(static_cast<std::size_t>(mapSize) << 20, sync);
+
+        return STORE_LMDB;
+#else
+        otErr << "OTDB::" << __FUNCTION__
+              << ": LMDB support is not compiled in. Using the filesystem.\n";
+#endif
+    } else if ("filesystem" != backend) {
+        otErr << "OTDB::" << __FUNCTION__ << ": Unknown backend \"" << backend
+              << "\". Using the filesystem.\n";
+    }
+
+    return STORE_FILESYSTEM;
+}
+
+std::int64_t MigrateFromFilesystem(const std::string& dataFolder)
+{
+#if OT_STORAGE_LMDB
+    auto* pStorage = dynamic_cast<StorageLMDB*>(details::s_pStorage);
+
+    if (nullptr != pStorage) { return pStorage->Migrate(dataFolder); }
+#endif
+
+    otErr << "OTDB::" << __FUNCTION__
+          << ": The default storage context does not import files.\n";
+
+    return -1;
+}
+
+bool BeginBatch(const std::string& dataFolder)
+{
+    Storage* pStorage = details::s_pStorage;
+
+    if (nullptr == pStorage) { return false; }
+
+    return pStorage->BeginBatch(dataFolder);
+}
+
+bool CommitBatch(const std::string& dataFolder)
+{
+    Storage* pStorage = details::s_pStorage;
+
+    if (nullptr == pStorage) { return false; }
+
+    return pStorage->CommitBatch(dataFolder);
+}
+
+void AbortBatch(const std::string& dataFolder)
+{
+    Storage* pStorage = details::s_pStorage;
+
+    if (nullptr != pStorage) { pStorage->AbortBatch(dataFolder); }
+}
+
 // %newobject Factory::createObj();
 Storage* CreateStorageContext(StorageType eStoreType, PackType ePackType)
 {
@@ -2129,6 +2228,15 @@ Storage* Storage::Create(
             pStore = StorageFS::Instantiate();
             OT_ASSERT(nullptr != pStore);
             break;
+        case STORE_LMDB:
+#if OT_STORAGE_LMDB
+            pStore = StorageLMDB::Instantiate();
+            OT_ASSERT(nullptr != pStore);
+#else
+            otErr << "OTDB::Storage::Create: Failed: LMDB support is not "
+                     "compiled in.\n";
+#endif
+            break;
         //            case STORE_COUCH_DB:
         //                pStore = new StorageCouchDB; OT_ASSERT(nullptr !=
         //                pStore);
@@ -2169,6 +2277,10 @@ StorageType Storage::GetType() const
     // that this is a custom Storage type invented by the API user.
 
     if (typeid(*this) == typeid(StorageFS)) return STORE_FILESYSTEM;
+#if OT_STORAGE_LMDB
+    else if (typeid(*this) == typeid(StorageLMDB))
+        return STORE_LMDB;
+#endif
     //    else if (typeid(*this) == typeid(StorageCouchDB))
     //        return STORE_COUCH_DB;
     //  Etc.
@@ -0,0 +1,775 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "Internal.hpp"
+
+#if OT_STORAGE_LMDB
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "lmdb.h"
+
+extern "C" {
+#include <dirent.h>
+#include <sys/stat.h>
+}
+
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OTStorageLMDB.hpp"
+
+// Files imported per transaction during migration.
+#define OTDB_LMDB_IMPORT_BATCH 1000
+#define OTDB_LMDB_IMPORTED "filesystem_imported"
+
+#define OT_METHOD "opentxs::OTDB::StorageLMDB::"
+
+namespace opentxs::OTDB
+{
+std::size_t StorageLMDB::map_size_{(sizeof(void*) > 4)
+                                       ? (std::size_t{16384} << 20)
+                                       : (std::size_t{512} << 20)};
+bool StorageLMDB::sync_{true};
+
+StorageLMDB::StorageLMDB()
+    : Storage()
+    , environment_lock_()
+    , environments_()
+    , batch_lock_()
+    , batches_()
+{
+}
+
+void StorageLMDB::AbortBatch(const std::string& dataFolder)
+{
+    const auto root = normalize(dataFolder);
+    MDB_txn* txn{nullptr};
+
+    {
+        Lock lock(batch_lock_);
+        auto it = batches_.find(std::this_thread::get_id());
+
+        if ((batches_.end() == it) || (root != it->second.folder_)) { return; }
+
+        txn = it->second.txn_;
+        batches_.erase(it);
+    }
+
+    mdb_txn_abort(txn);
+}
+
+MDB_txn* StorageLMDB::batch(const std::string& root) const
+{
+    Lock lock(batch_lock_);
+    const auto it = batches_.find(std::this_thread::get_id());
+
+    if ((batches_.end() == it) || (root != it->second.folder_)) {
+        return nullptr;
+    }
+
+    return it->second.txn_;
+}
+
+bool StorageLMDB::BeginBatch(const std::string& dataFolder)
+{
+    const auto root = normalize(dataFolder);
+
+    {
+        Lock lock(batch_lock_);
+        auto it = batches_.find(std::this_thread::get_id());
+
+        if (batches_.end() != it) {
+            auto& existing = it->second;
+
+            if (root != existing.folder_) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": This thread already has a batch open for "
+                      << existing.folder_ << "\n";
+
+                return false;
+            }
+
+            ++existing.depth_;
+
+            return true;
+        }
+    }
+
+    auto* env = environment(root);
+
+    if (nullptr == env) { return false; }
+
+    // This blocks while another thread holds a batch (or any other write
+    // transaction) on the same environment, so it must happen without
+    // holding batch_lock_.
+    MDB_txn* txn{nullptr};
+    const auto rc = mdb_txn_begin(env->env_, nullptr, 0, &txn);
+
+    if (0 != rc) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to start transaction: " << mdb_strerror(rc)
+              << "\n";
+
+        return false;
+    }
+
+    Lock lock(batch_lock_);
+    batches_.emplace(std::this_thread::get_id(), Batch{root, txn, 1});
+
+    return true;
+}
+
+bool StorageLMDB::CommitBatch(const std::string& dataFolder)
+{
+    const auto root = normalize(dataFolder);
+    MDB_txn* txn{nullptr};
+
+    {
+        Lock lock(batch_lock_);
+        auto it = batches_.find(std::this_thread::get_id());
+
+        if ((batches_.end() == it) || (root != it->second.folder_)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": No batch is open for "
+                  << root << "\n";
+
+            return false;
+        }
+
+        auto& existing = it->second;
+
+        if (1 < existing.depth_) {
+            --existing.depth_;
+
+            return true;
+        }
+
+        txn = existing.txn_;
+        batches_.erase(it);
+    }
+
+    const auto rc = mdb_txn_commit(txn);
+
+    if (0 != rc) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to commit batch: " << mdb_strerror(rc) << "\n";
+
+        return false;
+    }
+
+    return true;
+}
+
+StorageLMDB::Environment* StorageLMDB::environment(const std::string& root)
+{
+    Lock lock(environment_lock_);
+    auto it = environments_.find(root);
+
+    if (environments_.end() != it) { return &it->second; }
+
+    Environment opened{};
+
+    if (false == open(root + "otdb/", opened)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to open LMDB environment in " << root << "\n";
+
+        return nullptr;
+    }
+
+    // A partially imported environment is never handed out, since it would
+    // serve missing keys for files which do exist
+    if (false == imported(opened)) {
+        const auto count = import_tree(opened, root);
+
+        if (0 > count) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to import existing files from " << root
+                  << ". The import will be retried the next time this folder"
+                     " is opened.\n";
+            mdb_env_close(opened.env_);
+
+            return nullptr;
+        }
+
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Imported ")(count)(
+            " files from ")(root)
+            .Flush();
+    }
+
+    return &environments_.emplace(root, opened).first->second;
+}
+
+bool StorageLMDB::Exists(
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    return read(normalize(dataFolder), key, [](const MDB_val&) {});
+}
+
+// Mirrors StorageFS::ConstructAndConfirmPathImp, minus the filesystem: the
+// key is the path relative to the data folder.
+bool StorageLMDB::form_key(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr,
+    std::string& key)
+{
+    const std::string zero(3 > strFolder.length() ? "" : strFolder);
+    const std::string one(3 > oneStr.length() ? "" : oneStr);
+    const std::string two(3 > twoStr.length() ? "" : twoStr);
+    const std::string three(3 > threeStr.length() ? "" : threeStr);
+
+    if (zero.empty() && (0 != strFolder.compare("."))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": strFolder is too short (and "
+              << "not \".\"): \"" << strFolder << "\"\n";
+
+        return false;
+    }
+
+    if (one.empty()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Empty oneStr passed in!\n";
+
+        return false;
+    }
+
+    if (two.empty() && !three.empty()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": threeStr passed in while twoStr is empty!\n";
+
+        return false;
+    }
+
+    key.clear();
+
+    if (!zero.empty()) { key += zero + "/"; }
+
+    key += one;
+
+    if (two.empty()) { return true; }
+
+    key += "/" + two;
+
+    if (three.empty()) { return true; }
+
+    key += "/" + three;
+
+    return true;
+}
+
+std::int64_t StorageLMDB::FormPathString(
+    std::string& strOutput,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    const auto root = normalize(dataFolder);
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return -1;
+    }
+
+    strOutput = root + key;
+    std::int64_t output{0};
+    read(root, key, [&output](const MDB_val& value) {
+        output = static_cast<std::int64_t>(value.mv_size);
+    });
+
+    return output;
+}
+
+std::int64_t StorageLMDB::import_folder(
+    const Environment& environment,
+    const std::string& root,
+    const std::string& relative,
+    const bool recurse,
+    MDB_txn*& txn,
+    std::size_t& pending)
+{
+    auto* dir = opendir((root + relative).c_str());
+
+    // Folders which were never created simply have nothing to import.
+    if (nullptr == dir) { return 0; }
+
+    std::int64_t output{0};
+
+    while (auto* entry = readdir(dir)) {
+        const std::string name{entry->d_name};
+
+        if (("." == name) || (".." == name)) { continue; }
+
+        const auto key = relative.empty() ? name : relative + "/" + name;
+        const auto path = root + key;
+        struct stat info;
+
+        if (0 != ::stat(path.c_str(), &info)) { continue; }
+
+        if (S_ISDIR(info.st_mode)) {
+            if (false == recurse) { continue; }
+
+            const auto count =
+                import_folder(environment, root, key, true, txn, pending);
+
+            if (0 > count) {
+                closedir(dir);
+
+                return -1;
+            }
+
+            output += count;
+
+            continue;
+        }
+
+        if (false == S_ISREG(info.st_mode)) { continue; }
+
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (false == file.is_open()) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Unable to read " << path
+                  << "\n";
+            closedir(dir);
+
+            return -1;
+        }
+
+        const std::string value{std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>()};
+
+        if (nullptr == txn) {
+            if (0 != mdb_txn_begin(environment.env_, nullptr, 0, &txn)) {
+                txn = nullptr;
+                closedir(dir);
+
+                return -1;
+            }
+        }
+
+        MDB_val mdbKey{key.size(), const_cast<char*>(key.data())};
+        MDB_val mdbValue{value.size(), const_cast<char*>(value.data())};
+        // Keys already in the database are either left from an interrupted
+        // import or were written since, so the file never replaces them
+        const auto rc = mdb_put(
+            txn, environment.data_, &mdbKey, &mdbValue, MDB_NOOVERWRITE);
+
+        if (MDB_KEYEXIST == rc) { continue; }
+
+        if (0 != rc) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to import " << path
+                  << ": " << mdb_strerror(rc) << "\n";
+            mdb_txn_abort(txn);
+            txn = nullptr;
+            closedir(dir);
+
+            return -1;
+        }
+
+        ++output;
+
+        if (OTDB_LMDB_IMPORT_BATCH <= ++pending) {
+            pending = 0;
+            const bool committed = (0 == mdb_txn_commit(txn));
+            txn = nullptr;
+
+            if (false == committed) {
+                closedir(dir);
+
+                return -1;
+            }
+        }
+    }
+
+    closedir(dir);
+
+    return output;
+}
+
+std::int64_t StorageLMDB::import_tree(
+    const Environment& environment,
+    const std::string& root)
+{
+    // Files in the data folder itself (such as the wallet file) are read
+    // with strFolder ".", which maps to a bare key. Everything else lives in
+    // one of the legacy folders.
+    const std::vector<std::string> folders{OTFolders::Account().Get(),
+                                           OTFolders::Cert().Get(),
+                                           OTFolders::Common().Get(),
+                                           OTFolders::Contract().Get(),
+                                           OTFolders::Cron().Get(),
+                                           OTFolders::ExpiredBox().Get(),
+                                           OTFolders::Inbox().Get(),
+                                           OTFolders::Market().Get(),
+                                           OTFolders::Mint().Get(),
+                                           OTFolders::Nym().Get(),
+                                           OTFolders::Nymbox().Get(),
+                                           OTFolders::Outbox().Get(),
+                                           OTFolders::PaymentInbox().Get(),
+                                           OTFolders::Purse().Get(),
+                                           OTFolders::Receipt().Get(),
+                                           OTFolders::RecordBox().Get(),
+                                           OTFolders::Spent().Get(),
+                                           OTFolders::UserAcct().Get()};
+    MDB_txn* txn{nullptr};
+    std::size_t pending{0};
+    auto output = import_folder(environment, root, "", false, txn, pending);
+
+    for (const auto& folder : folders) {
+        if (0 > output) { break; }
+
+        const auto count =
+            import_folder(environment, root, folder, true, txn, pending);
+        output = (0 > count) ? count : output + count;
+    }
+
+    if (0 > output) { return output; }
+
+    if (nullptr == txn) {
+        if (0 != mdb_txn_begin(environment.env_, nullptr, 0, &txn)) {
+            return -1;
+        }
+    }
+
+    // The marker goes in the same transaction as the last imported files so
+    // that an interrupted import is repeated, skipping the files which were
+    // already committed.
+    const std::string marker{OTDB_LMDB_IMPORTED};
+    const auto count = std::to_string(output);
+    MDB_val key{marker.size(), const_cast<char*>(marker.data())};
+    MDB_val value{count.size(), const_cast<char*>(count.data())};
+
+    if (0 != mdb_put(txn, environment.meta_, &key, &value, 0)) {
+        mdb_txn_abort(txn);
+
+        return -1;
+    }
+
+    if (0 != mdb_txn_commit(txn)) { return -1; }
+
+    return output;
+}
+
+bool StorageLMDB::imported(const Environment& environment)
+{
+    MDB_txn* txn{nullptr};
+
+    if (0 != mdb_txn_begin(environment.env_, nullptr, MDB_RDONLY, &txn)) {
+        return false;
+    }
+
+    const std::string marker{OTDB_LMDB_IMPORTED};
+    MDB_val key{marker.size(), const_cast<char*>(marker.data())};
+    MDB_val value{};
+    const bool output = (0 == mdb_get(txn, environment.meta_, &key, &value));
+    mdb_txn_abort(txn);
+
+    return output;
+}
+
+std::int64_t StorageLMDB::Migrate(const std::string& dataFolder)
+{
+    const auto root = normalize(dataFolder);
+    auto* env = environment(root);
+
+    if (nullptr == env) { return -1; }
+
+    return import_tree(*env, root);
+}
+
+std::string StorageLMDB::normalize(const std::string& dataFolder)
+{
+    if (dataFolder.empty() || ('/' == dataFolder.back())) { return dataFolder; }
+
+    return dataFolder + "/";
+}
+
+bool StorageLMDB::onEraseValueByKey(
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    return remove(normalize(dataFolder), key);
+}
+
+bool StorageLMDB::onQueryPackedBuffer(
+    PackedBuffer& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    return read(normalize(dataFolder), key, [&theBuffer](const MDB_val& value) {
+        theBuffer.SetData(
+            static_cast<const std::uint8_t*>(value.mv_data), value.mv_size);
+    });
+}
+
+bool StorageLMDB::onQueryPlainString(
+    std::string& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    theBuffer.clear();
+    read(normalize(dataFolder), key, [&theBuffer](const MDB_val& value) {
+        theBuffer.assign(
+            static_cast<const char*>(value.mv_data), value.mv_size);
+    });
+
+    return (0 < theBuffer.length());
+}
+
+bool StorageLMDB::onStorePackedBuffer(
+    PackedBuffer& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    return store(
+        normalize(dataFolder), key, theBuffer.GetData(), theBuffer.GetSize());
+}
+
+bool StorageLMDB::onStorePlainString(
+    const std::string& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string key{};
+
+    if (false == form_key(strFolder, oneStr, twoStr, threeStr, key)) {
+        return false;
+    }
+
+    return store(
+        normalize(dataFolder), key, theBuffer.data(), theBuffer.size());
+}
+
+bool StorageLMDB::open(const std::string& folder, Environment& environment)
+{
+    bool created{false};
+
+    if (false ==
+        OTPaths::BuildFolderPath(String::Factory(folder.c_str()), created)) {
+        return false;
+    }
+
+    if (0 != mdb_env_create(&environment.env_)) { return false; }
+
+    // Without sync, a crash can lose the most recent commits but never
+    // corrupts the environment.
+    const unsigned int flags = sync_ ? MDB_NOTLS : (MDB_NOTLS | MDB_NOSYNC);
+    bool opened = (0 == mdb_env_set_mapsize(environment.env_, map_size_)) &&
+                  (0 == mdb_env_set_maxdbs(environment.env_, 2)) &&
+                  (0 == mdb_env_open(environment.env_, folder.c_str(), flags,
+                                     0664));
+    MDB_txn* txn{nullptr};
+    opened = opened &&
+             (0 == mdb_txn_begin(environment.env_, nullptr, 0, &txn));
+
+    if (opened) {
+        opened =
+            (0 == mdb_dbi_open(txn, "otdb", MDB_CREATE, &environment.data_)) &&
+            (0 == mdb_dbi_open(txn, "meta", MDB_CREATE, &environment.meta_));
+
+        if (opened) {
+            opened = (0 == mdb_txn_commit(txn));
+        } else {
+            mdb_txn_abort(txn);
+        }
+    }
+
+    if (false == opened) {
+        mdb_env_close(environment.env_);
+        environment.env_ = nullptr;
+    }
+
+    return opened;
+}
+
+bool StorageLMDB::read(
+    const std::string& root,
+    const std::string& key,
+    const std::function<void(const MDB_val&)>& found)
+{
+    auto* env = environment(root);
+
+    if (nullptr == env) { return false; }
+
+    auto* txn = batch(root);
+    const bool batched = (nullptr != txn);
+
+    if ((false == batched) &&
+        (0 != mdb_txn_begin(env->env_, nullptr, MDB_RDONLY, &txn))) {
+        return false;
+    }
+
+    MDB_val mdbKey{key.size(), const_cast<char*>(key.data())};
+    MDB_val value{};
+    const bool output = (0 == mdb_get(txn, env->data_, &mdbKey, &value));
+
+    if (output) { found(value); }
+
+    if (false == batched) { mdb_txn_abort(txn); }
+
+    return output;
+}
+
+bool StorageLMDB::remove(const std::string& root, const std::string& key)
+{
+    auto* env = environment(root);
+
+    if (nullptr == env) { return false; }
+
+    auto* txn = batch(root);
+    const bool batched = (nullptr != txn);
+
+    if ((false == batched) &&
+        (0 != mdb_txn_begin(env->env_, nullptr, 0, &txn))) {
+        return false;
+    }
+
+    MDB_val mdbKey{key.size(), const_cast<char*>(key.data())};
+    const auto rc = mdb_del(txn, env->data_, &mdbKey, nullptr);
+
+    // Erasing a value which was never stored is not an error, matching
+    // StorageFS.
+    if ((0 != rc) && (MDB_NOTFOUND != rc)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to erase " << key
+              << ": " << mdb_strerror(rc) << "\n";
+
+        if (false == batched) { mdb_txn_abort(txn); }
+
+        return false;
+    }
+
+    if (batched) { return true; }
+
+    return (0 == mdb_txn_commit(txn));
+}
+
+void StorageLMDB::SetOptions(const std::size_t mapSize, const bool sync)
+{
+    map_size_ = mapSize;
+    sync_ = sync;
+}
+
+bool StorageLMDB::store(
+    const std::string& root,
+    const std::string& key,
+    const void* data,
+    const std::size_t size)
+{
+    auto* env = environment(root);
+
+    if (nullptr == env) { return false; }
+
+    auto* txn = batch(root);
+    const bool batched = (nullptr != txn);
+
+    if ((false == batched) &&
+        (0 != mdb_txn_begin(env->env_, nullptr, 0, &txn))) {
+        return false;
+    }
+
+    MDB_val mdbKey{key.size(), const_cast<char*>(key.data())};
+    MDB_val value{size, const_cast<void*>(data)};
+    const auto rc = mdb_put(txn, env->data_, &mdbKey, &value, 0);
+
+    if (0 != rc) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store " << key
+              << ": " << mdb_strerror(rc)
+              << ((MDB_MAP_FULL == rc)
+                      ? " (increase lmdb_map_size in the [otdb] section of "
+                        "the config file)"
+                      : "")
+              << "\n";
+
+        if (false == batched) { mdb_txn_abort(txn); }
+
+        return false;
+    }
+
+    if (batched) { return true; }
+
+    const auto committed = mdb_txn_commit(txn);
+
+    if (0 != committed) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to commit " << key
+              << ": " << mdb_strerror(committed) << "\n";
+
+        return false;
+    }
+
+    return true;
+}
+
+StorageLMDB::~StorageLMDB()
+{
+    for (auto& it : batches_) { mdb_txn_abort(it.second.txn_); }
+
+    batches_.clear();
+
+    for (auto& it : environments_) { mdb_env_close(it.second.env_); }
+
+    environments_.clear();
+}
+}  // namespace opentxs::OTDB
+#endif  // OT_STORAGE_LMDB
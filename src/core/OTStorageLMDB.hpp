@@ -0,0 +1,153 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#if OT_STORAGE_LMDB
+namespace opentxs::OTDB
+{
+// StorageLMDB keeps every value that StorageFS would have written as a file
+// in a single LMDB environment (<dataFolder>/otdb), keyed by the relative
+// path the file would have had. Each write outside of a batch is its own
+// durable transaction, so a crash leaves either the old or the new value,
+// never a truncated file.
+//
+// The first time a data folder is opened, the existing directory tree is
+// imported before the call which opened it returns (see Migrate), and a
+// marker is recorded so that this happens only once per data folder.
+class StorageLMDB : public Storage
+{
+public:
+    static StorageLMDB* Instantiate() { return new StorageLMDB; }
+
+    // Applied to environments opened after the call.
+    static void SetOptions(const std::size_t mapSize, const bool sync);
+
+    bool Exists(
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+    std::int64_t FormPathString(
+        std::string& strOutput,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+
+    bool BeginBatch(const std::string& dataFolder) override;
+    bool CommitBatch(const std::string& dataFolder) override;
+    void AbortBatch(const std::string& dataFolder) override;
+
+    // Imports every file in dataFolder and in its legacy subfolders which
+    // does not already have a value stored under its key. Must not be
+    // called while the calling thread holds a batch. Returns the number of
+    // files imported, or -1 on error.
+    std::int64_t Migrate(const std::string& dataFolder);
+
+    ~StorageLMDB();
+
+protected:
+    bool onStorePackedBuffer(
+        PackedBuffer& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+    bool onQueryPackedBuffer(
+        PackedBuffer& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+    bool onStorePlainString(
+        const std::string& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+    bool onQueryPlainString(
+        std::string& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+    bool onEraseValueByKey(
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) override;
+
+private:
+    struct Environment {
+        MDB_env* env_{nullptr};
+        MDB_dbi data_{0};
+        MDB_dbi meta_{0};
+    };
+
+    // A write transaction held open by one thread between BeginBatch and
+    // the outermost CommitBatch.
+    struct Batch {
+        std::string folder_{};
+        MDB_txn* txn_{nullptr};
+        std::size_t depth_{0};
+    };
+
+    static std::size_t map_size_;
+    static bool sync_;
+
+    mutable std::mutex environment_lock_;
+    std::map<std::string, Environment> environments_;
+    mutable std::mutex batch_lock_;
+    std::map<std::thread::id, Batch> batches_;
+
+    static bool form_key(
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr,
+        std::string& key);
+    static std::int64_t import_tree(
+        const Environment& environment,
+        const std::string& root);
+    static std::int64_t import_folder(
+        const Environment& environment,
+        const std::string& root,
+        const std::string& relative,
+        const bool recurse,
+        MDB_txn*& txn,
+        std::size_t& pending);
+    static bool imported(const Environment& environment);
+    static std::string normalize(const std::string& dataFolder);
+    static bool open(const std::string& folder, Environment& environment);
+
+    MDB_txn* batch(const std::string& root) const;
+    Environment* environment(const std::string& root);
+    bool read(
+        const std::string& root,
+        const std::string& key,
+        const std::function<void(const MDB_val&)>& found);
+    bool remove(const std::string& root, const std::string& key);
+    bool store(
+        const std::string& root,
+        const std::string& key,
+        const void* data,
+        const std::size_t size);
+
+    StorageLMDB();
+    StorageLMDB(const StorageLMDB&) = delete;
+    StorageLMDB(StorageLMDB&&) = delete;
+    StorageLMDB& operator=(const StorageLMDB&) = delete;
+    StorageLMDB& operator=(StorageLMDB&&) = delete;
+};
+}  // namespace opentxs::OTDB
+#endif  // OT_STORAGE_LMDB
@@ -16,7 +16,6 @@
 #include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/util/StringUtils.hpp"
 #include "opentxs/core/util/Tag.hpp"
-#include "opentxs/core/util/Timer.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Contract.hpp"
 #include "opentxs/core/Data.hpp"
@@ -28,12 +27,15 @@
 
 #include <irrxml/irrXML.hpp>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::OTCron"
 
@@ -46,8 +48,8 @@ std::int32_t OTCron::__trans_refill_amount = 500;  // The number of transaction
                                                    // itself, when it
 // gets low, before each round.
 std::int32_t OTCron::__cron_ms_between_process =
-    10000;  // The number of milliseconds
-            // (ideally) between each
+    10000;  // The maximum number of
+            // milliseconds between each
             // "Cron Process" event.
 
 std::int32_t OTCron::__cron_max_items_per_nym =
@@ -55,13 +57,18 @@ std::int32_t OTCron::__cron_max_items_per_nym =
          // items any given Nym can have
          // active at the same time.
 
-Timer OTCron::tCron(true);
-
 OTCron::OTCron(const api::Core& server)
     : Contract(server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_mapDatePositions()
+    , m_lockSchedule()
+    , m_cvSchedule()
+    , m_bWake(false)
+    , m_queueSchedule()
+    , m_mapDeadlines()
+    , m_tResumeDate(OT_TIME_ZERO)
     , m_NOTARY_ID(Identifier::Factory())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
@@ -241,13 +248,11 @@ bool OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const std::size_t theBidCount = pMarket->GetBidCount();
+        const std::size_t theAskCount = pMarket->GetAskCount();
 
-        pMarketData->number_bids =
-            to_string<mapOfOffers::size_type>(theBidCount);
-        pMarketData->number_asks =
-            to_string<mapOfOffers::size_type>(theAskCount);
+        pMarketData->number_bids = to_string<std::size_t>(theBidCount);
+        pMarketData->number_asks = to_string<std::size_t>(theAskCount);
 
         // In the past 24 hours.
         // (I'm not collecting this data yet, (maybe never), so these values
@@ -570,11 +575,62 @@ void OTCron::UpdateContents()
 
 std::int64_t OTCron::computeTimeout()
 {
-    return OTCron::GetCronMsBetweenProcess() - tCron.getElapsedTimeInMilliSec();
+    Lock lock(m_lockSchedule);
+
+    return compute_timeout(lock);
+}
+
+std::int64_t OTCron::compute_timeout(const Lock& lock)
+{
+    const std::int64_t limit = OTCron::GetCronMsBetweenProcess();
+
+    if (false == m_bIsActivated) { return limit; }
+
+    pop_stale(lock);
+
+    if (m_queueSchedule.empty()) { return limit; }
+
+    const auto due = std::max(m_queueSchedule.top().first, m_tResumeDate);
+    const std::int64_t now =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    const std::int64_t remaining = OTTimeGetSecondsFromTime(due) * 1000 - now;
+
+    return std::max<std::int64_t>(0, std::min(limit, remaining));
+}
+
+// Removes an item from the map, the multimap, and the schedule. Does not call
+// any hooks.
+void OTCron::erase_item(const std::int64_t lTransactionNum)
+{
+    auto it_position = m_mapDatePositions.find(lTransactionNum);
+
+    OT_ASSERT(m_mapDatePositions.end() != it_position);
+
+    m_multimapCronItems.erase(it_position->second);
+    m_mapDatePositions.erase(it_position);
+    m_mapCronItems.erase(lTransactionNum);
+    Lock lock(m_lockSchedule);
+    m_mapDeadlines.erase(lTransactionNum);
+}
+
+void OTCron::pop_stale(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    while (false == m_queueSchedule.empty()) {
+        const auto& [due, number] = m_queueSchedule.top();
+        const auto it = m_mapDeadlines.find(number);
+
+        if ((m_mapDeadlines.end() != it) && (it->second == due)) { break; }
+
+        m_queueSchedule.pop();
+    }
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
-// expire.
+// expire. Only the items which are due are touched.
 void OTCron::ProcessCronItems()
 {
     if (!m_bIsActivated) {
@@ -582,11 +638,16 @@ void OTCron::ProcessCronItems()
         return;
     }
 
-    // check elapsed time since last items processing
-    if (computeTimeout() > 0) { return; }
-    tCron.start();
-
+    const auto now = OTTimeGetCurrentTime();
     const std::int32_t nTwentyPercent = OTCron::GetCronRefillAmount() / 5;
+    // Don't keep retrying every pass if the server can't refill the supply.
+    const auto postpone = OTTimeAddTimeInterval(
+        now, std::max(1, OTCron::GetCronMsBetweenProcess() / 1000));
+
+    Lock lock(m_lockSchedule);
+
+    if (now < m_tResumeDate) { return; }
+
     if (GetTransactionCount() <= nTwentyPercent) {
         otErr << "WARNING: Cron has fewer than 20 percent of its normal "
                  "transaction number count available since the previous round! "
@@ -599,15 +660,34 @@ void OTCron::ProcessCronItems()
               << " were used in the last round alone!!! \n"
                  "SKIPPING THE CRON ITEMS THAT WERE SCHEDULED FOR THIS "
                  "ROUND!!!\n\n";
+        m_tResumeDate = postpone;
+
         return;
     }
+
+    // Take every item which is due off of the schedule. Each one is put back
+    // after it has been processed, under its new due date.
+    std::vector<Deadline> due{};
+    m_tResumeDate = OT_TIME_ZERO;
+    pop_stale(lock);
+
+    while ((false == m_queueSchedule.empty()) &&
+           (m_queueSchedule.top().first <= now)) {
+        due.emplace_back(m_queueSchedule.top());
+        m_queueSchedule.pop();
+        m_mapDeadlines.erase(due.back().second);
+        pop_stale(lock);
+    }
+
+    lock.unlock();
     bool bNeedToSave = false;
 
-    // loop through the cron items and tell each one to ProcessCron().
+    // loop through the due cron items and tell each one to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    for (auto it = due.begin(); it != due.end(); ++it) {
+        const auto lTransactionNum = it->second;
+
         if (GetTransactionCount() <= nTwentyPercent) {
             otErr << "WARNING: Cron has fewer than 20 percent of its normal "
                      "transaction "
@@ -621,33 +701,114 @@ void OTCron::ProcessCronItems()
                   << " were used in the current round alone!!! \n"
                      "SKIPPING THE REMAINDER OF THE CRON ITEMS THAT WERE "
                      "SCHEDULED FOR THIS ROUND!!!\n\n";
+            lock.lock();
+            m_tResumeDate = postpone;
+
+            // They're still due, and will go first next round.
+            for (; it != due.end(); ++it) {
+                if (m_mapCronItems.end() != m_mapCronItems.find(it->second)) {
+                    schedule(lock, it->second, it->first);
+                }
+            }
+
+            lock.unlock();
             break;
         }
-        auto pItem = it->second;
-        OT_ASSERT(false != bool(pItem));
+
+        // Another item may have removed this one while it was waiting.
+        auto it_map = FindItemOnMap(lTransactionNum);
+
+        if (m_mapCronItems.end() == it_map) { continue; }
+
+        auto pItem = it_map->second;
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Processing item number: ")(
-            pItem->GetTransactionNum())
+            lTransactionNum)
             .Flush();
 
         if (pItem->ProcessCron()) {
-            it++;
+            lock.lock();
+            schedule(lock, lTransactionNum, pItem->GetNextDueDate());
+            lock.unlock();
             continue;
         }
         pItem->HookRemovalFromCron(
             api_.Wallet(), nullptr, GetNextTransactionNumber());
         LogNormal(OT_METHOD)(__FUNCTION__)(": Removing cron item: ")(
-            pItem->GetTransactionNum())(".")
+            lTransactionNum)(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
-        m_mapCronItems.erase(it_map);
+        erase_item(lTransactionNum);
 
         bNeedToSave = true;
     }
     if (bNeedToSave) SaveCron();
 }
 
+void OTCron::schedule(
+    const Lock& lock,
+    const std::int64_t lTransactionNum,
+    const time64_t tDueDate)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    m_mapDeadlines[lTransactionNum] = tDueDate;
+    m_queueSchedule.emplace(tDueDate, lTransactionNum);
+
+    // Superseded entries are normally discarded when they reach the top, but
+    // an item which is rescheduled earlier over and over would leave its old
+    // entries behind indefinitely.
+    if (m_queueSchedule.size() > (2 * m_mapDeadlines.size() + 64)) {
+        std::vector<Deadline> live(m_mapDeadlines.size());
+        std::transform(
+            m_mapDeadlines.begin(),
+            m_mapDeadlines.end(),
+            live.begin(),
+            [](const auto& it) -> Deadline {
+                return {it.second, it.first};
+            });
+        m_queueSchedule = queueOfDeadlines(
+            std::greater<Deadline>(), std::move(live));
+    }
+}
+
+void OTCron::ScheduleItem(const std::int64_t lTransactionNum)
+{
+    Lock lock(m_lockSchedule);
+
+    // Items which are being processed right now are rescheduled afterwards
+    // according to GetNextDueDate().
+    if (m_mapDeadlines.end() == m_mapDeadlines.find(lTransactionNum)) {
+        return;
+    }
+
+    schedule(lock, lTransactionNum, OT_TIME_ZERO);
+    m_bWake = true;
+    lock.unlock();
+    m_cvSchedule.notify_all();
+}
+
+void OTCron::WaitForNextDeadline()
+{
+    Lock lock(m_lockSchedule);
+    const auto timeout = compute_timeout(lock);
+
+    if (0 < timeout) {
+        m_cvSchedule.wait_for(
+            lock, std::chrono::milliseconds(timeout), [&]() -> bool {
+                return m_bWake;
+            });
+    }
+
+    m_bWake = false;
+}
+
+void OTCron::Wake()
+{
+    Lock lock(m_lockSchedule);
+    m_bWake = true;
+    lock.unlock();
+    m_cvSchedule.notify_all();
+}
+
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
 // So make SURE it is allocated on the HEAP before you pass it in here, and
 // also make sure to delete it again if this call fails!
@@ -698,10 +859,11 @@ bool OTCron::AddCronItem(
 
         // Insert to the MULTIMAP (by Date)
         //
-        m_multimapCronItems.insert(
-            m_multimapCronItems.upper_bound(tDateAdded),
-            std::pair<time64_t, std::shared_ptr<OTCronItem>>(
-                tDateAdded, theItem));
+        m_mapDatePositions[theItem->GetTransactionNum()] =
+            m_multimapCronItems.insert(
+                m_multimapCronItems.upper_bound(tDateAdded),
+                std::pair<time64_t, std::shared_ptr<OTCronItem>>(
+                    tDateAdded, theItem));
 
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
@@ -715,6 +877,13 @@ bool OTCron::AddCronItem(
         // But if actually being activated for the first time, then this is
         // true.
 
+        // New items are processed on the next pass.
+        Lock lock(m_lockSchedule);
+        schedule(lock, theItem->GetTransactionNum(), OT_TIME_ZERO);
+        m_bWake = true;
+        lock.unlock();
+        m_cvSchedule.notify_all();
+
         // When an item is added to Cron for the first time, a copy of it is
         // saved to the
         // cron folder, and it has the user's original signature on it. (If it's
@@ -786,17 +955,11 @@ bool OTCron::RemoveCronItem(
         auto pItem = it_map->second;
         //      OT_ASSERT(nullptr != pItem); // Already done in FindItemOnMap.
 
-        // We have to remove it from the multimap as well.
-        auto it_multimap = FindItemOnMultimap(lTransactionNum);
-        OT_ASSERT(m_multimapCronItems.end() != it_multimap);  // If found on
-                                                              // map, MUST be on
-                                                              // multimap also.
-
         pItem->HookRemovalFromCron(
             api_.Wallet(), theRemover, GetNextTransactionNumber());
 
-        m_mapCronItems.erase(it_map);            // Remove from MAP.
-        m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        // Remove from MAP, MULTIMAP, and the schedule.
+        erase_item(lTransactionNum);
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
@@ -844,18 +1007,11 @@ mapOfCronItems::iterator OTCron::FindItemOnMap(std::int64_t lTransactionNum)
 multimapOfCronItems::iterator OTCron::FindItemOnMultimap(
     std::int64_t lTransactionNum)
 {
-    auto itt = m_multimapCronItems.begin();
-
-    while (m_multimapCronItems.end() != itt) {
-        auto pItem = itt->second;
-        OT_ASSERT(false != bool(pItem));
-
-        if (pItem->GetTransactionNum() == lTransactionNum) break;
+    auto itt = m_mapDatePositions.find(lTransactionNum);
 
-        ++itt;
-    }
+    if (m_mapDatePositions.end() == itt) { return m_multimapCronItems.end(); }
 
-    return itt;
+    return itt->second;
 }
 
 // Look up a transaction by transaction number and see if it is in the map.
@@ -12,6 +12,7 @@
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/consensus/ClientContext.hpp"
 #include "opentxs/consensus/ServerContext.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/recurring/OTPaymentPlan.hpp"
 #include "opentxs/core/script/OTSmartContract.hpp"
 #include "opentxs/core/trade/OTTrade.hpp"
@@ -710,6 +711,34 @@ bool OTCronItem::CanRemoveItemFromCron(const ClientContext& context)
     // Only if that fails, do you need to dig deeper...
 }
 
+void OTCronItem::FlagForRemoval()
+{
+    m_bRemovalFlag = true;
+
+    if (nullptr != m_pCron) { m_pCron->ScheduleItem(GetTransactionNum()); }
+}
+
+// The child classes skip ProcessCron until more than GetProcessInterval()
+// seconds have passed since GetLastProcessDate(), and everything expires after
+// GetValidTo(). Nothing can happen before the earlier of those two dates.
+time64_t OTCronItem::GetNextDueDate() const
+{
+    if (IsFlaggedForRemoval()) { return OT_TIME_ZERO; }
+
+    const auto last = GetLastProcessDate();
+
+    if (OT_TIME_ZERO == last) { return OT_TIME_ZERO; }
+
+    auto output = OTTimeAddTimeInterval(last, GetProcessInterval() + 1);
+    const auto validTo = GetValidTo();
+
+    if ((OT_TIME_ZERO < validTo) && (validTo < output)) {
+        output = OTTimeAddTimeInterval(validTo, 1);
+    }
+
+    return output;
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Child classes will override this, AND call it (to verify valid date range.)
 //
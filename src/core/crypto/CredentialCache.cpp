@@ -0,0 +1,118 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <fstream>
+
+#include "CredentialCache.hpp"
+
+#define CREDENTIAL_CACHE_CAPACITY 65536
+
+#define OT_METHOD "opentxs::implementation::CredentialCache::"
+
+namespace opentxs::implementation
+{
+CredentialCache::CredentialCache()
+    : lock_()
+    , verified_()
+    , order_()
+    , files_()
+{
+}
+
+bool CredentialCache::add(const Lock& lock, const Identifier& hash)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    auto id = Identifier::Factory(hash);
+
+    if (false == verified_.emplace(id).second) { return false; }
+
+    order_.push_back(id);
+
+    while (CREDENTIAL_CACHE_CAPACITY < order_.size()) {
+        verified_.erase(order_.front());
+        order_.pop_front();
+    }
+
+    return true;
+}
+
+bool CredentialCache::Check(const Identifier& hash)
+{
+    auto& cache = instance();
+    Lock lock(cache.lock_);
+
+    return 0 < cache.verified_.count(Identifier::Factory(hash));
+}
+
+void CredentialCache::Insert(const Identifier& hash)
+{
+    auto& cache = instance();
+    Lock lock(cache.lock_);
+
+    if (false == cache.add(lock, hash)) { return; }
+
+    for (const auto& path : cache.files_) {
+        std::ofstream file(path, std::ios::out | std::ios::app);
+
+        if (file.good()) { file << hash.str() << '\n'; }
+    }
+}
+
+CredentialCache& CredentialCache::instance()
+{
+    static CredentialCache cache{};
+
+    return cache;
+}
+
+void CredentialCache::load(const Lock& lock, const std::string& path)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    std::ifstream file(path);
+    std::string line{};
+    std::size_t lines{0};
+
+    while (std::getline(file, line)) {
+        if (line.empty()) { continue; }
+
+        ++lines;
+        const auto hash = Identifier::Factory(line);
+
+        if (hash->empty()) { continue; }
+
+        add(lock, hash);
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Loaded ")(lines)(
+        " verified credential sets from ")(path)
+        .Flush();
+
+    if (lines <= order_.size()) { return; }
+
+    // Drop duplicate and evicted entries so the file stays near the capacity
+    std::ofstream output(path, std::ios::out | std::ios::trunc);
+
+    for (const auto& hash : order_) { output << hash->str() << '\n'; }
+}
+
+void CredentialCache::Persist(const std::string& path)
+{
+    auto& cache = instance();
+    Lock lock(cache.lock_);
+
+    for (const auto& existing : cache.files_) {
+        if (existing == path) { return; }
+    }
+
+    cache.load(lock, path);
+    cache.files_.emplace_back(path);
+}
+}  // namespace opentxs::implementation
@@ -0,0 +1,59 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Identifier.hpp"
+
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace opentxs::implementation
+{
+// Remembers which public credential sets have passed
+// CredentialSet::VerifyInternally.
+//
+// Entries are keyed by the hash of the full serialized credential set, which
+// covers the master credential, every active and revoked child credential and
+// all of their signatures. Verification depends only on that content, so one
+// cache serves every api instance in the process, and a set which gains,
+// loses or revises a credential simply misses and is verified again. Only
+// successful verifications are remembered. The oldest entries are dropped
+// once the capacity is reached.
+//
+// When persistence is enabled for an api instance, the cache is preloaded
+// from a file in its data folder and every new entry is appended to it.
+class CredentialCache
+{
+public:
+    static bool Check(const Identifier& hash);
+    static void Insert(const Identifier& hash);
+    static void Persist(const std::string& path);
+
+    ~CredentialCache() = default;
+
+private:
+    mutable std::mutex lock_;
+    std::set<OTIdentifier> verified_;
+    std::deque<OTIdentifier> order_;
+    std::vector<std::string> files_;
+
+    static CredentialCache& instance();
+
+    bool add(const Lock& lock, const Identifier& hash);
+    void load(const Lock& lock, const std::string& path);
+
+    CredentialCache();
+    CredentialCache(const CredentialCache&) = delete;
+    CredentialCache(CredentialCache&&) = delete;
+    CredentialCache& operator=(const CredentialCache&) = delete;
+    CredentialCache& operator=(CredentialCache&&) = delete;
+};
+}  // namespace opentxs::implementation
@@ -64,6 +64,8 @@
 #include <string>
 #include <utility>
 
+#include "CredentialCache.hpp"
+
 #define OT_METHOD "opentxs::CredentialSet::"
 
 namespace opentxs
@@ -226,6 +228,18 @@ bool CredentialSet::VerifyInternally() const
         return false;
     }
 
+    // Public sets are cached by content hash, so any change to a credential
+    // or a signature forces a full verification
+    const bool cacheable{proto::KEYMODE_PUBLIC == mode_};
+    auto hash = Identifier::Factory();
+
+    if (cacheable) {
+        hash->CalculateDigest(
+            proto::ProtoAsData(*Serialize(CREDENTIAL_INDEX_MODE_FULL_CREDS)));
+
+        if (implementation::CredentialCache::Check(hash)) { return true; }
+    }
+
     // Check for a valid master credential, including whether or not the
     // NymID and MasterID in the CredentialSet match the master
     // credentials's versions.
@@ -254,6 +268,8 @@ bool CredentialSet::VerifyInternally() const
         }
     }
 
+    if (cacheable) { implementation::CredentialCache::Insert(hash); }
+
     return true;
 }
 
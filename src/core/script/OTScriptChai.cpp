@@ -15,6 +15,7 @@
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/Types.hpp"
 
 #include <chaiscript/chaiscript.hpp>
 #ifdef OT_USE_CHAI_STDLIB
@@ -24,18 +25,243 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace opentxs::implementation
+{
+// A ChaiScript engine which is reused between OTScriptChai instances.
+//
+// Constructing a ChaiScript engine and bootstrapping its standard library costs
+// far more than running a typical clause, so engines are kept in a pool. The
+// engine state is saved after the native calls are registered and restored at
+// the start of every lease, which discards the parties, accounts and variables
+// of the previous contract along with anything its script defined.
+class ChaiEngine
+{
+public:
+    using Compiled = decltype(
+        std::declval<chaiscript::ChaiScript&>().parse(std::string{}));
+
+    static std::unique_ptr<ChaiEngine> Lease();
+    static void Return(std::unique_ptr<ChaiEngine>&& engine);
+
+    chaiscript::ChaiScript* Chai() { return &chai_; }
+    // Parsing is cached by script text and by the names of the variables
+    // which are bound by reference, since ChaiScript caches their stack
+    // positions in the parsed tree.
+    const chaiscript::AST_Node& Compile(
+        const std::string& script,
+        const std::string& layout);
+    bool NeedsNativeCalls(const std::string& name);
+    void Snapshot();
+    OTScriptable*& Target() { return target_; }
+
+    ~ChaiEngine() = default;
+
+private:
+    using CompiledList = std::list<std::pair<std::string, Compiled>>;
+
+    static const std::size_t max_compiled_{256};
+    static const std::size_t max_idle_{16};
+
+    chaiscript::ChaiScript chai_;
+    chaiscript::ChaiScript::State state_;
+    std::map<std::string, chaiscript::Boxed_Value> locals_;
+    std::set<std::string> native_calls_;
+    std::set<std::string> pending_native_calls_;
+    OTScriptable* target_{nullptr};
+    CompiledList compiled_;
+    std::unordered_map<std::string, CompiledList::iterator> compiled_index_;
+
+    static std::mutex& pool_lock();
+    static std::vector<std::unique_ptr<ChaiEngine>>& pool();
+
+    void reset();
+
+    ChaiEngine();
+    ChaiEngine(const ChaiEngine&) = delete;
+    ChaiEngine(ChaiEngine&&) = delete;
+    ChaiEngine& operator=(const ChaiEngine&) = delete;
+    ChaiEngine& operator=(ChaiEngine&&) = delete;
+};
+
+ChaiEngine::ChaiEngine()
+    : chai_()
+    , state_(chai_.get_state())
+    , locals_(chai_.get_locals())
+    , native_calls_()
+    , pending_native_calls_()
+    , target_(nullptr)
+    , compiled_()
+    , compiled_index_()
+{
+}
+
+const chaiscript::AST_Node& ChaiEngine::Compile(
+    const std::string& script,
+    const std::string& layout)
+{
+    const auto key = layout + '\n' + script;
+    auto it = compiled_index_.find(key);
+
+    if (compiled_index_.end() != it) {
+        compiled_.splice(compiled_.begin(), compiled_, it->second);
+
+        return *it->second->second;
+    }
+
+    compiled_.emplace_front(key, chai_.parse(script));
+    compiled_index_.emplace(key, compiled_.begin());
+
+    if (max_compiled_ < compiled_.size()) {
+        compiled_index_.erase(compiled_.back().first);
+        compiled_.pop_back();
+    }
+
+    return *compiled_.front().second;
+}
+
+std::unique_ptr<ChaiEngine> ChaiEngine::Lease()
+{
+    std::unique_ptr<ChaiEngine> output{nullptr};
+    Lock lock(pool_lock());
+    auto& engines = pool();
+
+    if (false == engines.empty()) {
+        output = std::move(engines.back());
+        engines.pop_back();
+    }
+
+    lock.unlock();
+
+    if (output) {
+        output->reset();
+    } else {
+        output.reset(new ChaiEngine);
+    }
+
+    OT_ASSERT(output);
+
+    return output;
+}
+
+bool ChaiEngine::NeedsNativeCalls(const std::string& name)
+{
+    if (0 < native_calls_.count(name)) { return false; }
+
+    return pending_native_calls_.emplace(name).second;
+}
+
+std::mutex& ChaiEngine::pool_lock()
+{
+    static std::mutex lock{};
+
+    return lock;
+}
+
+std::vector<std::unique_ptr<ChaiEngine>>& ChaiEngine::pool()
+{
+    static std::vector<std::unique_ptr<ChaiEngine>> engines{};
+
+    return engines;
+}
+
+void ChaiEngine::reset()
+{
+    chai_.set_state(state_);
+    chai_.set_locals(locals_);
+    pending_native_calls_.clear();
+    target_ = nullptr;
+}
+
+void ChaiEngine::Return(std::unique_ptr<ChaiEngine>&& engine)
+{
+    if (false == bool(engine)) { return; }
+
+    Lock lock(pool_lock());
+    auto& engines = pool();
+
+    if (max_idle_ > engines.size()) { engines.emplace_back(std::move(engine)); }
+}
+
+// Called before anything specific to the current contract is added
+void ChaiEngine::Snapshot()
+{
+    if (pending_native_calls_.empty()) { return; }
+
+    state_ = chai_.get_state();
+    locals_ = chai_.get_locals();
+    native_calls_.insert(
+        pending_native_calls_.begin(), pending_native_calls_.end());
+    pending_native_calls_.clear();
+}
+}  // namespace opentxs::implementation
 
 namespace opentxs
 {
+namespace
+{
+void log_eval_error(
+    const chaiscript::exception::eval_error& ee,
+    const std::string& filename)
+{
+    otErr << "OTScriptChai::ExecuteScript: \n Caught "
+             "chaiscript::exception::eval_error: \n "
+          << ee.reason << ". \n   File: " << filename
+          << "\n"
+             "   Start position, line: "
+          << ee.start_position.line << " column: " << ee.start_position.column
+          << "\n\n";
+
+    std::cout << ee.what();
+    if (ee.call_stack.size() > 0) {
+        std::cout << "during evaluation at (" << ee.call_stack[0].start().line
+                  << ", " << ee.call_stack[0].start().column << ")";
+    }
+    std::cout << std::endl;
+    std::cout << std::endl;
+
+    if (ee.call_stack.size() > 0) {
+        for (size_t j = 1; j < ee.call_stack.size(); ++j) {
+            if (ee.call_stack[j].identifier !=
+                    chaiscript::AST_Node_Type::Block &&
+                ee.call_stack[j].identifier !=
+                    chaiscript::AST_Node_Type::File) {
+                std::cout << std::endl;
+                std::cout << "  from " << ee.call_stack[j].filename() << " ("
+                          << ee.call_stack[j].start().line << ", "
+                          << ee.call_stack[j].start().column << ") : ";
+                std::cout << ee.call_stack[j].text << std::endl;
+            }
+        }
+    }
+    std::cout << std::endl;
+}
+}  // namespace
+
 
 bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 {
     using namespace chaiscript;
 
     OT_ASSERT(nullptr != chai_);
+    OT_ASSERT(engine_);
 
     if (m_str_script.size() > 0) {
+        // Keep the native calls registered for this lease, if any were, for
+        // every future lease of this engine.
+        engine_->Snapshot();
+        // Names of the variables bound by reference, in the order they are
+        // added to the engine.
+        std::string layout{};
 
         /*
         chai_->add(user_type<OTParty>(), "OTParty");
@@ -147,12 +373,14 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                         chai_->add_global_const(
                             const_var(pVar->CopyValueInteger()),
                             var_name.c_str());
-                    else
+                    else {
+                        layout.append(var_name + ',');
                         chai_->add(
                             var(&nValue),  // passing ptr here so the
                                            // script can modify this
                                            // variable if it wants.
                             var_name.c_str());
+                    }
                 } break;
 
                 case OTVariable::Var_Bool: {
@@ -163,12 +391,14 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                                             // constant.
                         chai_->add_global_const(
                             const_var(pVar->CopyValueBool()), var_name.c_str());
-                    else
+                    else {
+                        layout.append(var_name + ',');
                         chai_->add(
                             var(&bValue),  // passing ptr here so the
                                            // script can modify this
                                            // variable if it wants.
                             var_name.c_str());
+                    }
                 } break;
 
                 case OTVariable::Var_String: {
@@ -187,6 +417,7 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                         // (const var added to script): %s\n\n\n",
                         // str_Value.c_str());
                     } else {
+                        layout.append(var_name + ',');
                         chai_->add(
                             var(&str_Value),  // passing ptr here so the
                                               // script can modify this
@@ -216,37 +447,29 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
         // "Parties");
 
         try {
-            if (nullptr == pReturnVar)  // Nothing to return.
-                chai_->eval(
-                    m_str_script.c_str(),
-                    exception_specification<const std::exception&>(),
-                    m_str_display_filename);
+            chaiscript::Boxed_Value result{};
 
-            else  // There's a return variable.
-            {
+            try {
+                result = chai_->eval(engine_->Compile(m_str_script, layout));
+            } catch (const chaiscript::eval::detail::Return_Value& rv) {
+                // A top level return statement
+                result = rv.retval;
+            }
+
+            if (nullptr != pReturnVar) {
                 switch (pReturnVar->GetType()) {
                     case OTVariable::Var_Integer: {
-                        std::int32_t nResult = chai_->eval<int32_t>(
-                            m_str_script.c_str(),
-                            exception_specification<const std::exception&>(),
-                            m_str_display_filename);
-                        pReturnVar->SetValue(nResult);
+                        pReturnVar->SetValue(
+                            chai_->boxed_cast<std::int32_t>(result));
                     } break;
 
                     case OTVariable::Var_Bool: {
-                        bool bResult = chai_->eval<bool>(
-                            m_str_script.c_str(),
-                            exception_specification<const std::exception&>(),
-                            m_str_display_filename);
-                        pReturnVar->SetValue(bResult);
+                        pReturnVar->SetValue(chai_->boxed_cast<bool>(result));
                     } break;
 
                     case OTVariable::Var_String: {
-                        std::string str_Result = chai_->eval<std::string>(
-                            m_str_script.c_str(),
-                            exception_specification<const std::exception&>(),
-                            m_str_display_filename);
-                        pReturnVar->SetValue(str_Result);
+                        pReturnVar->SetValue(
+                            chai_->boxed_cast<std::string>(result));
                     } break;
 
                     default:
@@ -256,57 +479,11 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                                  "unable to service it.\n";
                         return false;
                 }  // switch
-            }      // else return variable.
+            }      // if return variable.
         }          // try
         catch (const chaiscript::exception::eval_error& ee) {
-            // Error in script parsing / execution
-            otErr << "OTScriptChai::ExecuteScript: \n Caught "
-                     "chaiscript::exception::eval_error: \n "
-                  << ee.reason << ". \n   File: " << ee.filename
-                  << "\n"
-                     "   Start position, line: "
-                  << ee.start_position.line << " column: "
-                  << ee.start_position.column
-                  //                  << "\n"
-                  //                     "   End position,   line: " <<
-                  //                     ee.end_position.line
-                  //                  << " column: " << ee.end_position.column
-                  << "\n\n";
-
-            std::cout << ee.what();
-            if (ee.call_stack.size() > 0) {
-                std::cout << "during evaluation at ("
-                          << ee.call_stack[0].start().line << ", "
-                          << ee.call_stack[0].start().column << ")";
-            }
-            std::cout << std::endl;
-            std::cout << std::endl;
-
-            //          std::cout << ee.what();
-            if (ee.call_stack.size() > 0) {
-                //                std::cout << "during evaluation at (" <<
-                // *(ee.call_stack[0]->filename) << " " <<
-                // ee.call_stack[0]->start().line << ", " <<
-                // ee.call_stack[0]->start().column << ")";
-
-                //                const std::string text;
-                //                boost::shared_ptr<const std::string> filename;
-
-                for (size_t j = 1; j < ee.call_stack.size(); ++j) {
-                    if (ee.call_stack[j].identifier !=
-                            chaiscript::AST_Node_Type::Block &&
-                        ee.call_stack[j].identifier !=
-                            chaiscript::AST_Node_Type::File) {
-                        std::cout << std::endl;
-                        std::cout << "  from " << ee.call_stack[j].filename()
-                                  << " (" << ee.call_stack[j].start().line
-                                  << ", " << ee.call_stack[j].start().column
-                                  << ") : ";
-                        std::cout << ee.call_stack[j].text << std::endl;
-                    }
-                }
-            }
-            std::cout << std::endl;
+            // Error in script parsing
+            log_eval_error(ee, m_str_display_filename);
 
             return false;
         } catch (const chaiscript::exception::bad_boxed_cast& e) {
@@ -325,10 +502,21 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                                             : "e.what() returned null, sorry")
                   << "\n";
             return false;
-        }
-        //      catch (chaiscript::Boxed_Value bv)
-        catch (...) {
-            //          std::int32_t i = chaiscript::boxed_cast<int32_t>(bv);
+        } catch (const chaiscript::Boxed_Value& bv) {
+            // Evaluating a parsed script reports execution errors, and
+            // anything thrown by the script itself, as a boxed value.
+            try {
+                log_eval_error(
+                    chai_->boxed_cast<const chaiscript::exception::eval_error&>(
+                        bv),
+                    m_str_display_filename);
+            } catch (...) {
+                otErr << "OTScriptChai::ExecuteScript: Caught exception "
+                         "thrown by script.\n";
+            }
+
+            return false;
+        } catch (...) {
             otErr << "OTScriptChai::ExecuteScript: Caught exception.\n";
             return false;
         }
@@ -337,77 +525,65 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
     return true;
 }
 
-#if !defined(OT_USE_CHAI_STDLIB)
-
 OTScriptChai::OTScriptChai()
     : OTScript()
-    , chai_(new chaiscript::ChaiScript)
+    , engine_(implementation::ChaiEngine::Lease())
+    , chai_(engine_->Chai())
 {
 }
 
-OTScriptChai::OTScriptChai(const OTString& strValue)
+OTScriptChai::OTScriptChai(const String& strValue)
     : OTScript(strValue)
-    , chai_(new chaiscript::ChaiScript)
+    , engine_(implementation::ChaiEngine::Lease())
+    , chai_(engine_->Chai())
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string)
     : OTScript(new_string)
-    , chai_(new chaiscript::ChaiScript)
+    , engine_(implementation::ChaiEngine::Lease())
+    , chai_(engine_->Chai())
 {
 }
 
 OTScriptChai::OTScriptChai(const char* new_string, size_t sizeLength)
     : OTScript(new_string, sizeLength)
-    , chai_(new chaiscript::ChaiScript)
+    , engine_(implementation::ChaiEngine::Lease())
+    , chai_(engine_->Chai())
 {
 }
 
 OTScriptChai::OTScriptChai(const std::string& new_string)
     : OTScript(new_string)
-    , chai_(new chaiscript::ChaiScript)
+    , engine_(implementation::ChaiEngine::Lease())
+    , chai_(engine_->Chai())
 {
 }
 
-#else  // OT_USE_CHAI_STDLIB *is* defined...
-
-OTScriptChai::OTScriptChai()
-    : OTScript()
-    , chai_(new chaiscript::ChaiScript)
+bool OTScriptChai::NeedsNativeCalls(const std::string& name)
 {
-}
+    OT_ASSERT(engine_);
 
-OTScriptChai::OTScriptChai(const String& strValue)
-    : OTScript(strValue)
-    , chai_(new chaiscript::ChaiScript)
-{
+    return engine_->NeedsNativeCalls(name);
 }
 
-OTScriptChai::OTScriptChai(const char* new_string)
-    : OTScript(new_string)
-    , chai_(new chaiscript::ChaiScript)
+void OTScriptChai::SetTarget(OTScriptable& target)
 {
-}
+    OT_ASSERT(engine_);
 
-OTScriptChai::OTScriptChai(const char* new_string, size_t sizeLength)
-    : OTScript(new_string, sizeLength)
-    , chai_(new chaiscript::ChaiScript)
-{
+    engine_->Target() = &target;
 }
 
-OTScriptChai::OTScriptChai(const std::string& new_string)
-    : OTScript(new_string)
-    , chai_(new chaiscript::ChaiScript)
+OTScriptable* const& OTScriptChai::Target() const
 {
-}
+    OT_ASSERT(engine_);
 
-#endif  // defined(OT_USE_CHAI_STDLIB)
+    return engine_->Target();
+}
 
 OTScriptChai::~OTScriptChai()
 {
-    if (nullptr != chai_) delete chai_;
-
-    // chai = nullptr;  (It's const).
+    implementation::ChaiEngine::Return(std::move(engine_));
 }
 }  // namespace opentxs
 #endif  // OT_SCRIPT_CHAI
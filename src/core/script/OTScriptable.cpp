@@ -251,10 +251,22 @@ void OTScriptable::RegisterOTNativeCallsWithScript(
     if (nullptr != pScript) {
         OT_ASSERT(nullptr != pScript->chai_)
 
+        pScript->SetTarget(*this);
+
+        // The engine is pooled, so these calls may already be registered
+        if (false == pScript->NeedsNativeCalls("OTScriptable")) { return; }
+
+        OTScriptable* const* target = &pScript->Target();
+
         pScript->chai_->add(fun(&OTScriptable::GetTime), "get_time");
 
         pScript->chai_->add(
-            fun(&OTScriptable::CanExecuteClause, this),
+            fun([target](
+                    std::string str_party_name,
+                    std::string str_clause_name) -> bool {
+                return (*target)->CanExecuteClause(
+                    str_party_name, str_clause_name);
+            }),
             "party_may_execute_clause");
     } else
 #endif  // OT_SCRIPT_CHAI
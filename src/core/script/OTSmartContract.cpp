@@ -706,6 +706,21 @@ DONE cron_activate        (Triggers when the smart contract is first activated.)
 // Cannot perform boxed_cast.
 // OTSmartContract::ExecuteClauses: Error while running script: process_clause
 
+#if OT_SCRIPT_CHAI
+namespace
+{
+// Pooled script engines are shared with plain OTScriptables, so the target of
+// a native call has to be checked every time.
+OTSmartContract& scripted_contract(OTScriptable* const* target)
+{
+    OT_ASSERT(nullptr != target);
+    OT_ASSERT(nullptr != *target);
+
+    return dynamic_cast<OTSmartContract&>(**target);
+}
+}  // namespace
+#endif  // OT_SCRIPT_CHAI
+
 // Class member, with string parameter.
 typedef bool (OTSmartContract::*OT_SM_RetBool_ThrStr)(
     std::string from_acct_name,
@@ -767,6 +782,12 @@ void OTSmartContract::RegisterOTNativeCallsWithScript(OTScript& theScript)
     if (nullptr != pScript) {
         OT_ASSERT(nullptr != pScript->chai_)
 
+        // The parent already set the target. The engine is pooled, so these
+        // calls may already be registered.
+        if (false == pScript->NeedsNativeCalls("OTSmartContract")) { return; }
+
+        OTScriptable* const* target = &pScript->Target();
+
         // OT NATIVE FUNCTIONS
         // (These functions can be called from INSIDE the scripted clauses.)
         //                                                                                        //
@@ -777,34 +798,80 @@ void OTSmartContract::RegisterOTNativeCallsWithScript(OTScript& theScript)
         //      OTSmartContract>());
 
         pScript->chai_->add(
-            fun<OT_SM_RetBool_ThrStr>(&OTSmartContract::MoveAcctFundsStr, this),
+            fun([target](
+                    std::string from_acct_name,
+                    std::string to_acct_name,
+                    std::string str_Amount) -> bool {
+                return scripted_contract(target).MoveAcctFundsStr(
+                    from_acct_name, to_acct_name, str_Amount);
+            }),
             "move_funds");
 
         pScript->chai_->add(
-            fun(&OTSmartContract::StashAcctFunds, this), "stash_funds");
+            fun([target](
+                    std::string from_acct_name,
+                    std::string to_stash_name,
+                    std::string str_Amount) -> bool {
+                return scripted_contract(target).StashAcctFunds(
+                    from_acct_name, to_stash_name, str_Amount);
+            }),
+            "stash_funds");
         pScript->chai_->add(
-            fun(&OTSmartContract::UnstashAcctFunds, this), "unstash_funds");
+            fun([target](
+                    std::string to_acct_name,
+                    std::string from_stash_name,
+                    std::string str_Amount) -> bool {
+                return scripted_contract(target).UnstashAcctFunds(
+                    to_acct_name, from_stash_name, str_Amount);
+            }),
+            "unstash_funds");
         pScript->chai_->add(
-            fun(&OTSmartContract::GetAcctBalance, this), "get_acct_balance");
+            fun([target](std::string from_acct_name) -> std::string {
+                return scripted_contract(target).GetAcctBalance(
+                    from_acct_name);
+            }),
+            "get_acct_balance");
         pScript->chai_->add(
-            fun(&OTSmartContract::GetInstrumentDefinitionIDofAcct, this),
+            fun([target](std::string from_acct_name) -> std::string {
+                return scripted_contract(target)
+                    .GetInstrumentDefinitionIDofAcct(from_acct_name);
+            }),
             "get_acct_instrument_definition_id");
         pScript->chai_->add(
-            fun(&OTSmartContract::GetStashBalance, this), "get_stash_balance");
+            fun([target](
+                    std::string stash_name,
+                    std::string instrument_definition_id) -> std::string {
+                return scripted_contract(target).GetStashBalance(
+                    stash_name, instrument_definition_id);
+            }),
+            "get_stash_balance");
         pScript->chai_->add(
-            fun(&OTSmartContract::SendNoticeToParty, this), "send_notice");
+            fun([target](std::string party_name) -> bool {
+                return scripted_contract(target).SendNoticeToParty(
+                    party_name);
+            }),
+            "send_notice");
         pScript->chai_->add(
-            fun(&OTSmartContract::SendANoticeToAllParties, this),
+            fun([target]() -> bool {
+                return scripted_contract(target).SendANoticeToAllParties();
+            }),
             "send_notice_to_parties");
         pScript->chai_->add(
-            fun(&OTSmartContract::SetRemainingTimer, this),
+            fun([target](std::string str_seconds_from_now) -> void {
+                scripted_contract(target).SetRemainingTimer(
+                    str_seconds_from_now);
+            }),
             "set_seconds_until_timer");
         pScript->chai_->add(
-            fun(&OTSmartContract::GetRemainingTimer, this),
+            fun([target]() -> std::string {
+                return scripted_contract(target).GetRemainingTimer();
+            }),
             "get_remaining_timer");
 
         pScript->chai_->add(
-            fun(&OTSmartContract::DeactivateSmartContract, this),
+            fun([target]() -> void {
+                scripted_contract(target).DeactivateSmartContract();
+            }),
             "deactivate_contract");
 
         // CALLBACKS
@@ -822,7 +889,10 @@ void OTSmartContract::RegisterOTNativeCallsWithScript(OTScript& theScript)
         // trigger when the callback is needed.
 
         pScript->chai_->add(
-            fun(&OTSmartContract::CanCancelContract, this),
+            fun([target](std::string str_party_name) -> bool {
+                return scripted_contract(target).CanCancelContract(
+                    str_party_name);
+            }),
             "party_may_cancel_contract");  // param_party_name
                                            // will be available
                                            // inside script.
@@ -33,6 +33,7 @@
 
 #include <irrxml/irrXML.hpp>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 #include <iterator>
@@ -50,9 +51,12 @@ OTMarket::OTMarket(const api::Core& core, const char* szFilename)
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids()
+    , m_Asks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
     , m_mapOffers()
+    , m_mapPositions()
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
     , m_CURRENCY_TYPE_ID(Identifier::Factory())
@@ -71,9 +75,12 @@ OTMarket::OTMarket(const api::Core& core)
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids()
+    , m_Asks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
     , m_mapOffers()
+    , m_mapPositions()
     , m_NOTARY_ID(Identifier::Factory())
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory())
     , m_CURRENCY_TYPE_ID(Identifier::Factory())
@@ -93,9 +100,12 @@ OTMarket::OTMarket(
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids()
+    , m_Asks()
+    , m_lBidCount(0)
+    , m_lAskCount(0)
     , m_mapOffers()
+    , m_mapPositions()
     , m_NOTARY_ID(Identifier::Factory(NOTARY_ID))
     , m_INSTRUMENT_DEFINITION_ID(Identifier::Factory(INSTRUMENT_DEFINITION_ID))
     , m_CURRENCY_TYPE_ID(Identifier::Factory(CURRENCY_TYPE_ID))
@@ -174,7 +184,7 @@ std::int32_t OTMarket::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
             OT_ASSERT(false != bool(pOffer));
 
             OTOffer* offer = pOffer.release();
-            if (pOffer->LoadContractFromString(strData) &&
+            if (offer->LoadContractFromString(strData) &&
                 AddOffer(nullptr, *offer, false, tDateAdded))
             // bSaveMarket = false (Don't SAVE -- we're loading right now!)
             {
@@ -216,36 +226,27 @@ void OTMarket::UpdateContents()
     tag.add_attribute("lastSaleDate", m_strLastSaleDate);
     tag.add_attribute("lastSalePrice", formatLong(m_lLastSalePrice));
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
-
-    // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
+    // Save the offers for sale, then the bids. Each price level is saved in
+    // the order its offers were added, so the order survives a reload.
+    for (auto* side : {&m_Asks, &m_Bids}) {
+        for (auto& level : *side) {
+            for (OTOffer* pOffer : level.second) {
+                OT_ASSERT(nullptr != pOffer);
+
+                auto strOffer = String::Factory(*pOffer);  // Extract the offer
+                                                           // contract into
+                                                           // string form.
+                auto ascOffer = Armored::Factory(strOffer);  // Base64-encode
+                                                             // that for
+                                                             // storage.
+
+                TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
+                tagOffer->add_attribute(
+                    "dateAdded",
+                    formatTimestamp(pOffer->GetDateAddedToMarket()));
+                tag.add_tag(tagOffer);
+            }
+        }
     }
 
     std::string str_result;
@@ -258,11 +259,12 @@ std::int64_t OTMarket::GetTotalAvailableAssets()
 {
     std::int64_t lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    for (auto& level : m_Asks) {
+        for (OTOffer* pOffer : level.second) {
+            OT_ASSERT(nullptr != pOffer);
 
-        lTotal += pOffer->GetAmountAvailable();
+            lTotal += pOffer->GetAmountAvailable();
+        }
     }
 
     return lTotal;
@@ -458,81 +460,90 @@ bool OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
-
+    // Both sides are listed starting from the best price.
     std::int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
+    for (auto level = m_Bids.rbegin();
+         (level != m_Bids.rend()) && (nTempDepth <= lDepth);
+         ++level) {
+        const std::int64_t& lPriceLimit = level->first;
 
         if (0 == lPriceLimit)  // Skipping any market orders.
             continue;
 
-        // OfferDataMarket
-        std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
-
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
-
-        pOfferData->transaction_id = to_string<std::int64_t>(lTransactionNum);
-        pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
-        pOfferData->available_assets =
-            to_string<std::int64_t>(lAvailableAssets);
-        pOfferData->minimum_increment =
-            to_string<std::int64_t>(lMinimumIncrement);
-        pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
-
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddBidData(*pOfferData);
-        nOfferCount++;
+        for (OTOffer* pOffer : level->second) {
+            if (nTempDepth++ > lDepth) break;
+
+            OT_ASSERT(nullptr != pOffer);
+
+            // OfferDataMarket
+            std::unique_ptr<OTDB::BidData> pOfferData(
+                dynamic_cast<OTDB::BidData*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
+
+            const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
+            const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
+            const std::int64_t& lMinimumIncrement =
+                pOffer->GetMinimumIncrement();
+            const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+
+            pOfferData->transaction_id =
+                to_string<std::int64_t>(lTransactionNum);
+            pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
+            pOfferData->available_assets =
+                to_string<std::int64_t>(lAvailableAssets);
+            pOfferData->minimum_increment =
+                to_string<std::int64_t>(lMinimumIncrement);
+            pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
+
+            // *pOfferData is CLONED at this time (I'm still responsible to
+            // delete.) That's also why I add it here, below: So the data is
+            // set right before the cloning occurs.
+            //
+            pOfferList->AddBidData(*pOfferData);
+            nOfferCount++;
+        }
     }
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        // OfferDataMarket
-        std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
-
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
-        const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
-        const std::int64_t& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
-
-        pOfferData->transaction_id = to_string<std::int64_t>(lTransactionNum);
-        pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
-        pOfferData->available_assets =
-            to_string<std::int64_t>(lAvailableAssets);
-        pOfferData->minimum_increment =
-            to_string<std::int64_t>(lMinimumIncrement);
-        pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
-
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddAskData(*pOfferData);
-        nOfferCount++;
+    for (auto level = m_Asks.rbegin();
+         (level != m_Asks.rend()) && (nTempDepth <= lDepth);
+         ++level) {
+        const std::int64_t& lPriceLimit = level->first;
+
+        for (OTOffer* pOffer : level->second) {
+            if (nTempDepth++ > lDepth) break;
+
+            OT_ASSERT(nullptr != pOffer);
+
+            // OfferDataMarket
+            std::unique_ptr<OTDB::AskData> pOfferData(
+                dynamic_cast<OTDB::AskData*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
+
+            const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
+            const std::int64_t lAvailableAssets = pOffer->GetAmountAvailable();
+            const std::int64_t& lMinimumIncrement =
+                pOffer->GetMinimumIncrement();
+            const time64_t tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+
+            pOfferData->transaction_id =
+                to_string<std::int64_t>(lTransactionNum);
+            pOfferData->price_per_scale = to_string<std::int64_t>(lPriceLimit);
+            pOfferData->available_assets =
+                to_string<std::int64_t>(lAvailableAssets);
+            pOfferData->minimum_increment =
+                to_string<std::int64_t>(lMinimumIncrement);
+            pOfferData->date = to_string<time64_t>(tDateAddedToMarket);
+
+            // *pOfferData is CLONED at this time (I'm still responsible to
+            // delete.) That's also why I add it here, below: So the data is
+            // set right before the cloning occurs.
+            //
+            pOfferList->AddAskData(*pOfferData);
+            nOfferCount++;
+        }
     }
 
     // Now pack the list into strOutput...
@@ -579,18 +590,6 @@ bool OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef std::multimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 OTOffer* OTMarket::GetOffer(const std::int64_t& lTransactionNum)
 {
     // See if there's something there with that transaction number.
@@ -617,12 +616,10 @@ OTOffer* OTMarket::GetOffer(const std::int64_t& lTransactionNum)
     return nullptr;
 }
 
-bool OTMarket::RemoveOffer(const std::int64_t& lTransactionNum)  // if false,
-                                                                 // offer
-// wasn't found.
+bool OTMarket::RemoveOffer(
+    const std::int64_t& lTransactionNum,
+    bool bSaveFile)  // if false, offer wasn't found.
 {
-    bool bReturnValue = false;
-
     // See if there's something there with that transaction number.
     auto it = m_mapOffers.find(lTransactionNum);
 
@@ -633,74 +630,58 @@ bool OTMarket::RemoveOffer(const std::int64_t& lTransactionNum)  // if false,
               << lTransactionNum << "\n";
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
 
-        OT_ASSERT(nullptr != pOffer);
+    OTOffer* pOffer = it->second;
 
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
+    OT_ASSERT(nullptr != pOffer);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
+    // This removes it from one list (the one indexed by transaction
+    // number.) But it's still in the book...
+    m_mapOffers.erase(it);
 
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
+    // ...which is where the stored position comes in.
+    auto position = m_mapPositions.find(lTransactionNum);
 
-        for (mapOfOffers::iterator iii = pMap->begin(); iii != pMap->end();
-             ++iii) {
-            pSameOffer = iii->second;
+    if (m_mapPositions.end() == position) {
+        otErr << "Removed Offer from offers list, but not found on bid/ask "
+                 "list.\n";
+        delete pOffer;
 
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
+        return false;
+    }
 
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
+    // They SHOULD be pointers to the SAME object.
+    OT_ASSERT(pOffer == *position->second.position_);
 
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+    remove_from_book(position->second);
+    m_mapPositions.erase(position);
+    delete pOffer;
+    pOffer = nullptr;
 
-        if (nullptr == pSameOffer) {
-            otErr << "Removed Offer from offers list, but not found on bid/ask "
-                     "list.\n";
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
+    if (bSaveFile) {
+        return SaveMarket();  // <====== SAVE since an offer was removed.
+    }
 
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
+    return true;
+}
 
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
-    }
+void OTMarket::remove_from_book(const OfferPosition& position)
+{
+    auto& side = position.bid_ ? m_Bids : m_Asks;
+    auto level = find_price_level(position.bid_, position.price_);
 
-    if (bReturnValue)
-        return SaveMarket();  // <====== SAVE since an offer was removed.
-    else
-        return false;
+    OT_ASSERT(side.end() != level);
+    OT_ASSERT(position.price_ == level->first);
+
+    level->second.erase(position.position_);
+
+    if (level->second.empty()) { side.erase(level); }
+
+    if (position.bid_) {
+        --m_lBidCount;
+    } else {
+        --m_lAskCount;
+    }
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -725,9 +706,9 @@ bool OTMarket::AddOffer(
 
         if (nullptr != pTrade) pTrade->FlagForRemoval();
     } else {
-        // I store duplicate lists of offer pointers. Two multimaps ordered by
-        // price,
-        // (for buyers and sellers) and one map ordered by transaction number.
+        // I store duplicate lists of offer pointers. The book ordered by
+        // price, (for buyers and sellers) and one map ordered by transaction
+        // number.
 
         // See if there's something else already there with the same transaction
         // number.
@@ -756,25 +737,22 @@ bool OTMarket::AddOffer(
         //
         // So next, let's add it to the lists that are indexed by price:
 
-        // Determine if it's a buy or sell, and add it to the right list.
-        if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+        // Determine if it's a buy or sell, and add it to the back of the line
+        // at its price. No bother checking if the offer is already in the
+        // book, since the code above basically already verifies that for us.
+        const bool bid = theOffer.IsBid();
+        auto& level = get_price_level(bid, lPriceLimit);
+        level.push_back(&theOffer);
+        m_mapPositions[lTransactionNum] =
+            OfferPosition{bid, lPriceLimit, std::prev(level.end())};
+
+        if (bid) {
+            ++m_lBidCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            ++m_lAskCount;
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as an ask to the market.")
                 .Flush();
@@ -916,48 +894,61 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
     theIdentifier.CalculateDigest(strTemp);
 }
 
+vectorOfPriceLevels::iterator OTMarket::find_price_level(
+    const bool bid,
+    const std::int64_t price)
+{
+    auto& side = bid ? m_Bids : m_Asks;
+
+    return std::lower_bound(
+        side.begin(),
+        side.end(),
+        price,
+        [bid](
+            const vectorOfPriceLevels::value_type& level,
+            const std::int64_t value) -> bool {
+            return is_worse(bid, level.first, value);
+        });
+}
+
+listOfOffers& OTMarket::get_price_level(
+    const bool bid,
+    const std::int64_t price)
+{
+    auto& side = bid ? m_Bids : m_Asks;
+    auto level = find_price_level(bid, price);
+
+    if ((side.end() == level) || (price != level->first)) {
+        level = side.emplace(level, price, listOfOffers{});
+    }
+
+    return level->second;
+}
+
 // returns 0 if there are no bids. Otherwise returns the value of the highest
 // bid on the market.
 std::int64_t OTMarket::GetHighestBidPrice()
 {
-    std::int64_t lPrice = 0;
-
-    mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
+    if (m_Bids.empty()) { return 0; }
 
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
-
-    return lPrice;
+    return m_Bids.back().first;
 }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
 // on the market.
 std::int64_t OTMarket::GetLowestAskPrice()
 {
-    std::int64_t lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
+    // Market orders have a 0 price, so we need to skip them if they are here.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices, so we need to skip any that have a 0 price. They can only
+    // be on the last price level.
+    for (auto level = m_Asks.rbegin(); level != m_Asks.rend(); ++level) {
+        if (0 != level->first) { return level->first; }
     }
 
-    return lPrice;
+    return 0;
 }
 
 // This utility function is used directly below (only).
@@ -2399,192 +2390,159 @@ bool OTMarket::ProcessTrade(
 
     if (theOffer.IsAsk())  // If I'm selling,
     {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
-             rr != m_mapBids.rend();
-             ++rr) {
-            // then I want to start at the highest bidder and loop DOWN
-            // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
-
+        // The highest bid is the last price level. We start there and
+        // loop down until there are no other bids within my price range.
+        for (auto level = m_Bids.rbegin(); level != m_Bids.rend(); ++level) {
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
             //
-            // If BOTH offers are market orders, we just skip this bid.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pBid! Imagine if pBid is a market order
-            // and theOffer isn't -- that would mean pBid hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
+            // We ONLY process a market order as theOffer, not as pBid!
+            // Imagine if pBid is a market order and theOffer isn't --
+            // that would mean pBid hasn't been processed yet (since it
+            // will only process once.) So it needs to wait its turn!
             //
-            if (pBid->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pBid->IsMarketOrder())
-                //              continue;
-                break;
-            // NOTE: Why break, instead of continue? Because since we
-            // are looping through the bids, from the HIGHEST down to
-            // the LOWEST, and since market orders have a ZERO price, we
-            // know for a fact that there are not any other non-zero
-            // bids. (So we might as well break.)
-
-            // I'm selling.
-            //
-            // If the bid is larger than, or equal to, my
-            // low-side-limit, and the amount available is at least my
-            // minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pBid->GetPriceLimit() >=
-                 theOffer.GetPriceLimit()))  // Or if this bid is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.)
+            // Market orders have a ZERO price, so they are all on the
+            // last price level and there are no other bids below them.
+            if (0 == level->first) { break; }
+
+            // Within a price level, the first bid in line is at the
+            // front.
+            for (OTOffer* pBid : level->second) {
+                OT_ASSERT(nullptr != pBid);
+
+                // I'm selling.
                 //
-                // ...So all the other "if"s have to go INSIDE the block
-                // here:
+                // If the bid is larger than, or equal to, my
+                // low-side-limit, and the amount available is at least my
+                // minimum increment, (and vice versa),
+                // ...then let's trade!
                 //
-                if ((pBid->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pBid->GetMinimumIncrement()) &&
-                    (nullptr != pBid->GetTrade()) &&
-                    !pBid->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet,
-                        theTrade,
-                        theOffer,
-                        *pBid);  // <========
-            }
-
-            // Else, the bid is lower than I am willing to sell. (And
-            // all the remaining bids are even lower.)
-            //
-            else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
-                              // now.)
-            }
+                if (theOffer.IsMarketOrder() ||  // If I don't care about
+                                                 // price...
+                    (pBid->GetPriceLimit() >=
+                     theOffer.GetPriceLimit()))  // Or if this bid is within
+                                                 // my price range...
+                {
+                    // Notice the above "if" is ONLY based on price...
+                    // because the "else" returns! (Once I am out of my
+                    // price range, no point to continue looping.)
+                    //
+                    // ...So all the other "if"s have to go INSIDE the block
+                    // here:
+                    //
+                    if ((pBid->GetAmountAvailable() >=
+                         theOffer.GetMinimumIncrement()) &&
+                        (theOffer.GetAmountAvailable() >=
+                         pBid->GetMinimumIncrement()) &&
+                        (nullptr != pBid->GetTrade()) &&
+                        !pBid->GetTrade()->IsFlaggedForRemoval())
+
+                        ProcessTrade(
+                            wallet,
+                            theTrade,
+                            theOffer,
+                            *pBid);  // <========
+                }
 
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": Removing market order: ")(theTrade.GetOpeningNum())(
-                    ". IsFlaggedForRemoval: ")(theTrade.IsFlaggedForRemoval())(
-                    ". Minimum increment is larger than Amount ")(
-                    "available: ")(theOffer.GetMinimumIncrement())(
-                    theOffer.GetAmountAvailable())
-                    .Flush();
+                // Else, the bid is lower than I am willing to sell. (And
+                // all the remaining bids are even lower.)
+                //
+                else if (theOffer.IsLimitOrder()) {
+                    return true;  // stay on cron for more processing (for
+                                  // now.)
+                }
 
-                return false;  // remove this trade from cron
+                // The offer has no more trading to do--it's done.
+                if (theTrade.IsFlaggedForRemoval() ||  // during processing,
+                                                       // the trade may have
+                                                       // gotten flagged.
+                    (theOffer.GetMinimumIncrement() >
+                     theOffer.GetAmountAvailable())) {
+
+                    LogVerbose(OT_METHOD)(__FUNCTION__)(
+                        ": Removing market order: ")(theTrade.GetOpeningNum())(
+                        ". IsFlaggedForRemoval: ")(
+                        theTrade.IsFlaggedForRemoval())(
+                        ". Minimum increment is larger than Amount ")(
+                        "available: ")(theOffer.GetMinimumIncrement())(
+                        theOffer.GetAmountAvailable())
+                        .Flush();
+
+                    return false;  // remove this trade from cron
+                }
             }
-
-            pBid = nullptr;
         }
     }
     // I'm buying
     else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
-        //
-        for (auto& it : m_mapAsks) {
-            // then I want to start at the lowest seller and loop UP
-            // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
-
+        // The lowest ask is the last price level. We start there and
+        // loop up until there are no other asks within my price range.
+        for (auto level = m_Asks.rbegin(); level != m_Asks.rend(); ++level) {
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
             //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
-            //
-            if (pAsk->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
-
-            // I'm buying.
-            // If the ask price is less than, or equal to, my price
-            // limit, and the amount available for purchase is at least
-            // my minimum increment, (and vice versa),
-            // ...then let's trade!
-            //
-            if (theOffer.IsMarketOrder() ||  // If I don't care about
-                                             // price...
-                (pAsk->GetPriceLimit() <=
-                 theOffer.GetPriceLimit()))  // Or if this ask is within
-                                             // my price range...
-            {
-                // Notice the above "if" is ONLY based on price...
-                // because the "else" returns! (Once I am out of my
-                // price range, no point to continue looping.) So all
-                // the other "if"s have to go INSIDE the block here:
+            // We ONLY process a market order as theOffer, not as pAsk!
+            // (See the comment on bids above.) Market orders have a ZERO
+            // price, so they are all on the best price level.
+            if (0 == level->first) { continue; }
+
+            // Within a price level, the first ask in line is at the
+            // front.
+            for (OTOffer* pAsk : level->second) {
+                OT_ASSERT(nullptr != pAsk);
+
+                // I'm buying.
+                // If the ask price is less than, or equal to, my price
+                // limit, and the amount available for purchase is at least
+                // my minimum increment, (and vice versa),
+                // ...then let's trade!
                 //
-                if ((pAsk->GetAmountAvailable() >=
-                     theOffer.GetMinimumIncrement()) &&
-                    (theOffer.GetAmountAvailable() >=
-                     pAsk->GetMinimumIncrement()) &&
-                    (nullptr != pAsk->GetTrade()) &&
-                    !pAsk->GetTrade()->IsFlaggedForRemoval())
-
-                    ProcessTrade(
-                        wallet, theTrade, theOffer, *pAsk);  // <=======
-            }
-            // Else, the ask price is higher than I am willing to pay.
-            // (And all the remaining sellers are even HIGHER.)
-            else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
-            }
-
-            // The offer has no more trading to do--it's done.
-            if (theTrade.IsFlaggedForRemoval() ||  // during processing,
-                                                   // the trade may have
-                                                   // gotten flagged.
-                (theOffer.GetMinimumIncrement() >
-                 theOffer.GetAmountAvailable())) {
-
-                LogVerbose(OT_METHOD)(__FUNCTION__)(
-                    ": Removing market order: ")(theTrade.GetOpeningNum())(
-                    ". IsFlaggedForRemoval: ")(theTrade.IsFlaggedForRemoval())(
-                    ". Minimum increment is larger than Amount ")(
-                    "available: ")(theOffer.GetMinimumIncrement())(
-                    theOffer.GetAmountAvailable())
-                    .Flush();
+                if (theOffer.IsMarketOrder() ||  // If I don't care about
+                                                 // price...
+                    (pAsk->GetPriceLimit() <=
+                     theOffer.GetPriceLimit()))  // Or if this ask is within
+                                                 // my price range...
+                {
+                    // Notice the above "if" is ONLY based on price...
+                    // because the "else" returns! (Once I am out of my
+                    // price range, no point to continue looping.) So all
+                    // the other "if"s have to go INSIDE the block here:
+                    //
+                    if ((pAsk->GetAmountAvailable() >=
+                         theOffer.GetMinimumIncrement()) &&
+                        (theOffer.GetAmountAvailable() >=
+                         pAsk->GetMinimumIncrement()) &&
+                        (nullptr != pAsk->GetTrade()) &&
+                        !pAsk->GetTrade()->IsFlaggedForRemoval())
+
+                        ProcessTrade(
+                            wallet, theTrade, theOffer, *pAsk);  // <=======
+                }
+                // Else, the ask price is higher than I am willing to pay.
+                // (And all the remaining sellers are even HIGHER.)
+                else if (theOffer.IsLimitOrder()) {
+                    return true;  // stay on the market for now.
+                }
 
-                return false;  // remove this trade from the market.
+                // The offer has no more trading to do--it's done.
+                if (theTrade.IsFlaggedForRemoval() ||  // during processing,
+                                                       // the trade may have
+                                                       // gotten flagged.
+                    (theOffer.GetMinimumIncrement() >
+                     theOffer.GetAmountAvailable())) {
+
+                    LogVerbose(OT_METHOD)(__FUNCTION__)(
+                        ": Removing market order: ")(theTrade.GetOpeningNum())(
+                        ". IsFlaggedForRemoval: ")(
+                        theTrade.IsFlaggedForRemoval())(
+                        ". Minimum increment is larger than Amount ")(
+                        "available: ")(theOffer.GetMinimumIncrement())(
+                        theOffer.GetAmountAvailable())
+                        .Flush();
+
+                    return false;  // remove this trade from the market.
+                }
             }
-
-            pAsk = nullptr;
         }
     }
 
@@ -2681,6 +2639,16 @@ bool OTMarket::ValidateOfferForMarket(OTOffer& theOffer)
     return bValidOffer;
 }
 
+// Bids are sorted by ascending price and asks by descending price, so the best
+// price level of either side is at the back.
+bool OTMarket::is_worse(
+    const bool bid,
+    const std::int64_t lhs,
+    const std::int64_t rhs)
+{
+    return bid ? (lhs < rhs) : (lhs > rhs);
+}
+
 void OTMarket::InitMarket() { m_strContractType = String::Factory("MARKET"); }
 
 void OTMarket::Release_Market()
@@ -2698,18 +2666,17 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
+    for (auto& it : m_mapOffers) {
+        delete it.second;
+        it.second = nullptr;
     }
+
+    m_mapOffers.clear();
+    m_mapPositions.clear();
+    m_Bids.clear();
+    m_Asks.clear();
+    m_lBidCount = 0;
+    m_lAskCount = 0;
 }
 
 void OTMarket::Release()
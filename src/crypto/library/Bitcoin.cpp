@@ -163,6 +163,28 @@ std::shared_ptr<proto::AsymmetricKey> Bitcoin::GetHDKey(
     return {};
 }
 
+bool Bitcoin::GetPublicChild(
+    [[maybe_unused]] const EcdsaCurve& curve,
+    [[maybe_unused]] const Data& parent,
+    [[maybe_unused]] const std::uint32_t index,
+    [[maybe_unused]] Data& child) const
+{
+    // TODO
+
+    return {};
+}
+
+bool Bitcoin::GetPublicNode(
+    [[maybe_unused]] const EcdsaCurve& curve,
+    [[maybe_unused]] const OTPassword& seed,
+    [[maybe_unused]] const proto::HDPath& path,
+    [[maybe_unused]] Data& node) const
+{
+    // TODO
+
+    return {};
+}
+
 bool Bitcoin::RandomKeypair(
     [[maybe_unused]] OTPassword& privateKey,
     [[maybe_unused]] Data& publicKey) const
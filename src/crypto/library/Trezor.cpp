@@ -52,6 +52,7 @@ extern "C" {
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -263,6 +264,77 @@ std::shared_ptr<proto::AsymmetricKey> Trezor::GetHDKey(
     return output;
 }
 
+bool Trezor::GetPublicChild(
+    const EcdsaCurve& curve,
+    const Data& parent,
+    const std::uint32_t index,
+    Data& child) const
+{
+    child.Release();
+    HDNode node{};
+    const auto chainCodeSize = sizeof(node.chain_code);
+    const auto publicKeySize = sizeof(node.public_key);
+
+    if ((chainCodeSize + publicKeySize) != parent.size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid parent node."
+              << std::endl;
+
+        return false;
+    }
+
+    node.curve = get_curve_by_name(CurveName(curve).c_str());
+
+    if (nullptr == node.curve) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unsupported curve."
+              << std::endl;
+
+        return false;
+    }
+
+    const auto* bytes = static_cast<const std::uint8_t*>(parent.data());
+    std::memcpy(node.chain_code, bytes, chainCodeSize);
+    std::memcpy(node.public_key, bytes + chainCodeSize, publicKeySize);
+
+    if (1 != hdnode_public_ckd(&node, index)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive child."
+              << std::endl;
+
+        return false;
+    }
+
+    child.Assign(node.chain_code, chainCodeSize);
+    child.Concatenate(node.public_key, publicKeySize);
+
+    return true;
+}
+
+bool Trezor::GetPublicNode(
+    const EcdsaCurve& curve,
+    const OTPassword& seed,
+    const proto::HDPath& path,
+    Data& node) const
+{
+    node.Release();
+    auto childPath = path;
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Deriving node: ")(Print(childPath))
+        .Flush();
+    auto derived = DeriveChild(curve, seed, childPath);
+
+    if (!derived) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to derive node."
+              << std::endl;
+
+        return false;
+    }
+
+    ::hdnode_fill_public_key(derived.get());
+    node.Assign(derived->chain_code, sizeof(derived->chain_code));
+    node.Concatenate(derived->public_key, sizeof(derived->public_key));
+    OTPassword::zeroMemory(derived->private_key, sizeof(derived->private_key));
+
+    return true;
+}
+
 std::shared_ptr<proto::AsymmetricKey> Trezor::HDNodeToSerialized(
     const proto::AsymmetricKeyType& type,
     const HDNode& node,
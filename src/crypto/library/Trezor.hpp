@@ -32,6 +32,16 @@ public:
         const EcdsaCurve& curve,
         const OTPassword& seed,
         proto::HDPath& path) const override;
+    bool GetPublicChild(
+        const EcdsaCurve& curve,
+        const Data& parent,
+        const std::uint32_t index,
+        Data& child) const override;
+    bool GetPublicNode(
+        const EcdsaCurve& curve,
+        const OTPassword& seed,
+        const proto::HDPath& path,
+        Data& node) const override;
     bool RandomKeypair(OTPassword& privateKey, Data& publicKey) const override;
     std::string SeedToFingerprint(
         const EcdsaCurve& curve,
@@ -0,0 +1,46 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/network/zeromq/Context.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace opentxs::network::zeromq::internal
+{
+/** Polls every registered socket from a single thread and dispatches ready
+ *  sockets to a pool of worker threads.
+ *
+ *  A registered socket is owned by the reactor while it is armed. The
+ *  callback for a socket never runs on more than one thread at a time.
+ *
+ *  A callback may block on a reply from another socket in the same reactor.
+ *  If every worker is busy while ready sockets wait, the pool grows until
+ *  they are serviced.
+ */
+struct Reactor {
+    using Callback = std::function<void()>;
+
+    /** Returns a registration id, or -1 if the reactor is shutting down */
+    virtual int Add(const std::vector<void*>& sockets, Callback&& callback)
+        const = 0;
+    /** Blocks until the callback for the registration is no longer running */
+    virtual void Remove(const int id) const = 0;
+    /** Schedules the callback even if no socket is readable */
+    virtual bool Wake(const int id) const = 0;
+
+    virtual ~Reactor() = default;
+};
+
+struct Context : virtual public zeromq::Context {
+    virtual const internal::Reactor& Reactor() const = 0;
+
+    virtual ~Context() = default;
+};
+}  // namespace opentxs::network::zeromq::internal
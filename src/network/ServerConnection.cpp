@@ -11,7 +11,6 @@
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/consensus/ServerContext.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
-#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Lockable.hpp"
@@ -37,12 +36,14 @@
 #include <chrono>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
 
 #include "ServerConnection.hpp"
+#include "WireFormat.hpp"
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -96,6 +97,9 @@ ServerConnection::ServerConnection(
     , use_proxy_(Flag::Factory(false))
     , registration_lock_()
     , registered_for_push_()
+    , pending_lock_()
+    , pending_()
+    , wire_(Wire::Unknown)
 {
     OT_ASSERT(remote_contract_)
 
@@ -109,6 +113,7 @@ ServerConnection::ServerConnection(
 void ServerConnection::activity_timer()
 {
     while (zmq_.Running()) {
+        expire_requests();
         const auto limit = zmq_.KeepAlive();
         const auto now = std::chrono::seconds(std::time(nullptr));
         const auto last = std::chrono::seconds(last_activity_.load());
@@ -165,6 +170,15 @@ std::pair<bool, proto::ServerReply> ServerConnection::check_for_protobuf(
     return output;
 }
 
+bool ServerConnection::claim_probe()
+{
+    if (false == zmq_.BinaryFraming()) { return false; }
+
+    auto expected{Wire::Unknown};
+
+    return wire_.compare_exchange_strong(expected, Wire::Probing);
+}
+
 bool ServerConnection::ClearProxy()
 {
     Lock lock(lock_);
@@ -183,6 +197,21 @@ bool ServerConnection::EnableProxy()
     return true;
 }
 
+bool ServerConnection::encode(
+    const Message& message,
+    const bool binary,
+    std::string& frame) const
+{
+    auto raw = String::Factory();
+    message.SaveContractRaw(raw);
+
+    if (binary) {
+        return WireFormat::EncodeBinary(raw, zmq_.WireCompression(), frame);
+    }
+
+    return WireFormat::EncodeArmored(raw, frame);
+}
+
 std::string ServerConnection::endpoint() const
 {
     std::uint32_t port{0};
@@ -205,6 +234,45 @@ std::string ServerConnection::endpoint() const
     return endpoint;
 }
 
+void ServerConnection::expire_requests()
+{
+    const auto now = std::chrono::system_clock::now();
+    Lock lock(pending_lock_);
+
+    for (auto it = pending_.begin(); it != pending_.end();) {
+        const auto& key = it->first;
+        auto& pending = it->second;
+
+        if (pending.deadline_ > now) {
+            ++it;
+
+            continue;
+        }
+
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Request ")(key.second)(
+            " for nym ")(key.first)(" timed out.")
+            .Flush();
+        pending.promise_.set_value({SendResult::TIMEOUT, nullptr});
+        it = pending_.erase(it);
+    }
+}
+
+bool ServerConnection::finish_request(
+    const RequestKey& key,
+    const SendResult status,
+    std::shared_ptr<Message> reply)
+{
+    Lock lock(pending_lock_);
+    auto it = pending_.find(key);
+
+    if (pending_.end() == it) { return false; }
+
+    it->second.promise_.set_value({status, reply});
+    pending_.erase(it);
+
+    return true;
+}
+
 std::string ServerConnection::form_endpoint(
     proto::AddressType type,
     std::string hostname,
@@ -254,9 +322,50 @@ zeromq::RequestSocket& ServerConnection::get_sync(const Lock& lock)
 }
 
 std::chrono::time_point<std::chrono::system_clock> ServerConnection::
-    get_timeout()
+    get_timeout() const
+{
+    return std::chrono::system_clock::now() + zmq_.SendTimeout() +
+           zmq_.ReceiveTimeout();
+}
+
+std::unique_ptr<Message> ServerConnection::instantiate(
+    const zeromq::Frame& frame) const
 {
-    return std::chrono::system_clock::now() + zmq_.SendTimeout();
+    auto output{api_.Factory().Message()};
+
+    OT_ASSERT(false != bool(output));
+
+    auto serialized = String::Factory();
+
+    if (false == WireFormat::Decode(std::string(frame), serialized)) {
+        return {};
+    }
+
+    if (false == output->LoadContractFromString(serialized)) { return {}; }
+
+    return output;
+}
+
+NetworkReplyMessage ServerConnection::probe(const Message& message)
+{
+    bool legacy{false};
+    auto output = send_sync(message, true, legacy);
+
+    if (legacy) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Notary ")(server_id_)(
+            " does not support binary framing.")
+            .Flush();
+        wire_.store(Wire::Armored);
+
+        return send_sync(message, false, legacy);
+    }
+
+    // Try again with the next request if this one did not get a reply
+    wire_.store(
+        (SendResult::VALID_REPLY == output.first) ? Wire::Binary
+                                                  : Wire::Unknown);
+
+    return output;
 }
 
 void ServerConnection::process_incoming(const proto::ServerReply& in)
@@ -277,13 +386,8 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
 {
     if (status_->On()) { publish(); }
 
-    auto message{api_.Factory().Message()};
-
-    OT_ASSERT(false != bool(message));
-
     if (1 > in.Body().size()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Received legacy reply on async socket.")
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Empty reply on async socket.")
             .Flush();
 
         return;
@@ -291,7 +395,11 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
 
     auto& frame = *in.Body().begin();
 
-    if (0 == frame.size()) { return; }
+    if (rejected(frame)) {
+        process_rejection(in);
+
+        return;
+    }
 
     if (1 < in.Body().size()) {
         const auto [isProto, reply] = check_for_protobuf(frame);
@@ -308,6 +416,58 @@ void ServerConnection::process_incoming(const zeromq::Message& in)
 
         return;
     }
+
+    process_reply(frame);
+}
+
+// The envelope of the reply identifies the request, even if the notary was
+// unable to parse it
+void ServerConnection::process_rejection(const zeromq::Message& in)
+{
+    if (2 != in.Header().size()) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": Discarding rejection of an unknown request.")
+            .Flush();
+
+        return;
+    }
+
+    const RequestKey key{
+        std::string(in.Header().at(0)),
+        String::Factory(std::string(in.Header().at(1)))->ToLong()};
+    LogOutput(OT_METHOD)(__FUNCTION__)(": Notary rejected request ")(
+        key.second)(" for nym ")(key.first)
+        .Flush();
+
+    if (false == finish_request(key, SendResult::INVALID_REPLY, nullptr)) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": Discarding rejection of request ")(key.second)(" for nym ")(
+            key.first)(" which is no longer pending.")
+            .Flush();
+    }
+}
+
+void ServerConnection::process_reply(const zeromq::Frame& frame)
+{
+    std::shared_ptr<Message> reply{instantiate(frame)};
+
+    if (false == bool(reply)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Received server reply, but unable to instantiate it as a "
+            "Message.")
+            .Flush();
+
+        return;
+    }
+
+    const RequestKey key{reply->m_strNymID->Get(),
+                         reply->m_strRequestNum->ToLong()};
+
+    if (false == finish_request(key, SendResult::VALID_REPLY, reply)) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Discarding reply to request ")(
+            key.second)(" for nym ")(key.first)(" which is no longer pending.")
+            .Flush();
+    }
 }
 
 void ServerConnection::publish() const
@@ -319,6 +479,12 @@ void ServerConnection::publish() const
     updates_.Publish(message);
 }
 
+bool ServerConnection::rejected(const zeromq::Frame& frame)
+{
+    return (0 == frame.size()) ||
+           (WireFormat::Rejected() == std::string(frame));
+}
+
 void ServerConnection::register_for_push(const ServerContext& context)
 {
     if (2 > context.Request()) {
@@ -360,6 +526,47 @@ void ServerConnection::reset_timer()
 NetworkReplyMessage ServerConnection::Send(
     const ServerContext& context,
     const Message& message)
+{
+    register_for_push(context);
+
+    // The request socket pairs every reply with its request, so the first
+    // request on a connection finds out whether the notary understands
+    // binary framing.
+    if (claim_probe()) { return probe(message); }
+
+    std::future<NetworkReplyMessage> future{};
+
+    if (start_request(message, future)) { return future.get(); }
+
+    // Another request with the same nym and request number is in flight, so
+    // the reply could not be matched. Fall back to the request socket.
+    bool notUsed{false};
+
+    return send_sync(message, use_binary(), notUsed);
+}
+
+std::future<NetworkReplyMessage> ServerConnection::SendAsync(
+    const ServerContext& context,
+    const Message& message)
+{
+    register_for_push(context);
+    std::future<NetworkReplyMessage> output{};
+
+    if (start_request(message, output)) { return output; }
+
+    LogOutput(OT_METHOD)(__FUNCTION__)(": Request ")(message.m_strRequestNum)(
+        " for nym ")(message.m_strNymID)(" is already in flight.")
+        .Flush();
+    std::promise<NetworkReplyMessage> promise{};
+    promise.set_value({SendResult::ERROR, nullptr});
+
+    return promise.get_future();
+}
+
+NetworkReplyMessage ServerConnection::send_sync(
+    const Message& message,
+    const bool binary,
+    bool& legacy)
 {
     struct Cleanup {
         const Lock& lock_;
@@ -394,7 +601,6 @@ NetworkReplyMessage ServerConnection::Send(
         }
     };
 
-    register_for_push(context);
     NetworkReplyMessage output{SendResult::ERROR, nullptr};
     auto& status = output.first;
     auto& reply = output.second;
@@ -402,24 +608,20 @@ NetworkReplyMessage ServerConnection::Send(
 
     OT_ASSERT(false != bool(reply));
 
-    auto raw = String::Factory();
-    message.SaveContractRaw(raw);
-    auto envelope = Armored::Factory(raw);
+    legacy = false;
+    std::string envelope{};
 
-    if (false == envelope->Exists()) { return output; }
+    if (false == encode(message, binary, envelope)) { return output; }
 
     Lock socketLock(lock_);
     Cleanup cleanup(socketLock, *this, status, reply);
-    auto request = zmq::Message::Factory(std::string(envelope->Get()));
+    auto request = zmq::Message::Factory(envelope);
     auto sendresult = get_sync(socketLock).SendRequest(request);
 
     if (status_->On()) { publish(); }
 
     status = sendresult.first;
     auto in = sendresult.second;
-    auto replymessage{api_.Factory().Message()};
-
-    OT_ASSERT(false != bool(replymessage));
 
     if (SendResult::TIMEOUT == status) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Reply timeout.").Flush();
@@ -447,19 +649,17 @@ NetworkReplyMessage ServerConnection::Send(
     auto& frame = *in->Body().begin();
 
     if (0 == frame.size()) {
+        // A notary which predates binary framing can not parse the request
+        legacy = binary;
         LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid reply message.").Flush();
         cleanup.SetStatus(SendResult::INVALID_REPLY);
 
         return output;
     }
 
-    auto armored = Armored::Factory();
-    armored->Set(std::string(frame).c_str());
-    auto serialized = String::Factory();
-    armored->GetString(serialized);
-    const auto loaded = replymessage->LoadContractFromString(serialized);
+    auto replymessage = instantiate(frame);
 
-    if (loaded) {
+    if (replymessage) {
         reply.reset(replymessage.release());
     } else {
         LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -523,10 +723,66 @@ OTZMQRequestSocket ServerConnection::sync_socket(const Lock& lock) const
     return output;
 }
 
+bool ServerConnection::start_request(
+    const Message& message,
+    std::future<NetworkReplyMessage>& future)
+{
+    const RequestKey key{message.m_strNymID->Get(),
+                         message.m_strRequestNum->ToLong()};
+    Lock pendingLock(pending_lock_);
+
+    if (0 < pending_.count(key)) { return false; }
+
+    auto& pending = pending_[key];
+    pending.deadline_ = get_timeout();
+    future = pending.promise_.get_future();
+    pendingLock.unlock();
+    std::string envelope{};
+
+    if (false == encode(message, use_binary(), envelope)) {
+        finish_request(key, SendResult::ERROR, nullptr);
+
+        return true;
+    }
+
+    auto request = zmq::Message::Factory();
+
+    // The notary returns the envelope with the reply, so rejections can be
+    // matched to the request
+    if (false == key.first.empty()) {
+        request->AddFrame(key.first);
+        request->AddFrame(std::to_string(key.second));
+    }
+
+    request->AddFrame();
+    request->AddFrame(envelope);
+    Lock socketLock(lock_);
+    const auto sent = get_async(socketLock).Send(request);
+    socketLock.unlock();
+
+    if (false == sent) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to send request.").Flush();
+        finish_request(key, SendResult::ERROR, nullptr);
+    }
+
+    return true;
+}
+
 bool ServerConnection::Status() const { return status_.get(); }
 
+bool ServerConnection::use_binary() const
+{
+    return zmq_.BinaryFraming() && (Wire::Binary == wire_.load());
+}
+
 ServerConnection::~ServerConnection()
 {
     if (thread_.joinable()) { thread_.join(); }
+
+    Lock lock(pending_lock_);
+
+    for (auto& it : pending_) {
+        it.second.promise_.set_value({SendResult::ERROR, nullptr});
+    }
 }
 }  // namespace opentxs::network::implementation
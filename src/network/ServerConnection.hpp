@@ -19,6 +19,9 @@ public:
     NetworkReplyMessage Send(
         const ServerContext& context,
         const Message& message) override;
+    std::future<NetworkReplyMessage> SendAsync(
+        const ServerContext& context,
+        const Message& message) override;
     bool Status() const override;
 
     ~ServerConnection();
@@ -26,6 +29,21 @@ public:
 private:
     friend opentxs::network::ServerConnection;
 
+    using RequestKey = std::pair<std::string, RequestNumber>;
+
+    // Framing of legacy requests, as negotiated with the notary
+    enum class Wire : std::uint8_t {
+        Unknown = 0,
+        Probing = 1,
+        Binary = 2,
+        Armored = 3,
+    };
+
+    struct PendingRequest {
+        std::promise<NetworkReplyMessage> promise_{};
+        std::chrono::time_point<std::chrono::system_clock> deadline_{};
+    };
+
     const api::network::ZMQ& zmq_;
     const api::Core& api_;
     const zeromq::PublishSocket& updates_;
@@ -43,32 +61,56 @@ private:
     OTFlag use_proxy_;
     mutable std::mutex registration_lock_;
     std::map<OTIdentifier, bool> registered_for_push_;
+    mutable std::mutex pending_lock_;
+    std::map<RequestKey, PendingRequest> pending_;
+    std::atomic<Wire> wire_;
 
     static std::pair<bool, proto::ServerReply> check_for_protobuf(
         const zeromq::Frame& frame);
+    static bool rejected(const zeromq::Frame& frame);
 
     OTZMQDealerSocket async_socket(const Lock& lock) const;
     ServerConnection* clone() const override { return nullptr; }
+    bool encode(const Message& message, const bool binary, std::string& frame)
+        const;
     std::string endpoint() const;
     std::string form_endpoint(
         proto::AddressType type,
         std::string hostname,
         std::uint32_t port) const;
-    std::chrono::time_point<std::chrono::system_clock> get_timeout();
+    std::chrono::time_point<std::chrono::system_clock> get_timeout() const;
+    std::unique_ptr<Message> instantiate(const zeromq::Frame& frame) const;
     void publish() const;
     void set_curve(const Lock& lock, zeromq::CurveClient& socket) const;
     void set_proxy(const Lock& lock, zeromq::DealerSocket& socket) const;
     void set_timeouts(const Lock& lock, zeromq::Socket& socket) const;
     OTZMQRequestSocket sync_socket(const Lock& lock) const;
+    bool use_binary() const;
 
     void activity_timer();
+    bool claim_probe();
+    void expire_requests();
+    bool finish_request(
+        const RequestKey& key,
+        const SendResult status,
+        std::shared_ptr<Message> reply);
     zeromq::DealerSocket& get_async(const Lock& lock);
     zeromq::RequestSocket& get_sync(const Lock& lock);
     void process_incoming(const zeromq::Message& in);
     void process_incoming(const proto::ServerReply& in);
+    void process_rejection(const zeromq::Message& in);
+    void process_reply(const zeromq::Frame& frame);
+    NetworkReplyMessage probe(const Message& message);
     void register_for_push(const ServerContext& context);
     void reset_socket(const Lock& lock);
     void reset_timer();
+    NetworkReplyMessage send_sync(
+        const Message& message,
+        const bool binary,
+        bool& legacy);
+    bool start_request(
+        const Message& message,
+        std::future<NetworkReplyMessage>& future);
 
     ServerConnection(
         const api::Core& api,
@@ -0,0 +1,193 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
+
+#include <zconf.h>
+#include <zlib.h>
+
+#include <algorithm>
+
+#include "WireFormat.hpp"
+
+#define WIRE_MARKER 0x00
+#define WIRE_VERSION 0x01
+#define WIRE_HEADER_SIZE 7
+// Upper bound on the declared size of a binary payload, so that a corrupt
+// header can not trigger an unbounded allocation
+#define WIRE_MAX_MESSAGE_SIZE (256U * 1024U * 1024U)
+
+#define OT_METHOD "opentxs::network::implementation::WireFormat::"
+
+namespace opentxs::network::implementation
+{
+bool WireFormat::Decode(const std::string& frame, String& message)
+{
+    message.Release();
+
+    if (frame.empty()) { return false; }
+
+    if (IsBinary(frame)) { return decode_binary(frame, message); }
+
+    auto armored = Armored::Factory();
+    armored->MemSet(frame.data(), static_cast<std::uint32_t>(frame.size()));
+
+    if (false == armored->GetString(message)) { return false; }
+
+    return message.Exists();
+}
+
+bool WireFormat::decode_binary(const std::string& frame, String& message)
+{
+    if (WIRE_HEADER_SIZE > frame.size()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Truncated header.").Flush();
+
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const std::uint8_t*>(frame.data());
+
+    if (WIRE_VERSION != header[1]) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Unsupported version ")(
+            std::to_string(header[1]))
+            .Flush();
+
+        return false;
+    }
+
+    const std::uint32_t size = (std::uint32_t(header[3]) << 24) |
+                               (std::uint32_t(header[4]) << 16) |
+                               (std::uint32_t(header[5]) << 8) |
+                               std::uint32_t(header[6]);
+    const auto* payload = frame.data() + WIRE_HEADER_SIZE;
+    const auto payloadSize = frame.size() - WIRE_HEADER_SIZE;
+
+    if (0 == size) { return false; }
+
+    if (WIRE_MAX_MESSAGE_SIZE < size) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Declared size ")(size)(
+            " exceeds limit.")
+            .Flush();
+
+        return false;
+    }
+
+    switch (static_cast<Compression>(header[2])) {
+        case Compression::None: {
+            if (size != payloadSize) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Size mismatch.").Flush();
+
+                return false;
+            }
+
+            message.MemSet(payload, size);
+        } break;
+        case Compression::Zlib: {
+            std::string output(size, '\0');
+            uLongf outputSize{size};
+            const auto result = uncompress(
+                reinterpret_cast<Bytef*>(&output[0]),
+                &outputSize,
+                reinterpret_cast<const Bytef*>(payload),
+                static_cast<uLong>(payloadSize));
+
+            if ((Z_OK != result) || (size != outputSize)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Decompression failed.")
+                    .Flush();
+
+                return false;
+            }
+
+            message.MemSet(output.data(), size);
+        } break;
+        default: {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Unknown compression type.")
+                .Flush();
+
+            return false;
+        }
+    }
+
+    return message.Exists();
+}
+
+bool WireFormat::EncodeArmored(const String& message, std::string& frame)
+{
+    frame.clear();
+    auto armored = Armored::Factory(message);
+
+    if (false == armored->Exists()) { return false; }
+
+    frame.assign(armored->Get(), armored->GetLength());
+
+    return true;
+}
+
+bool WireFormat::EncodeBinary(
+    const String& message,
+    const std::int32_t level,
+    std::string& frame)
+{
+    frame.clear();
+    const auto size = message.GetLength();
+
+    if (0 == size) { return false; }
+
+    const bool compress{0 != level};
+    frame.reserve(
+        WIRE_HEADER_SIZE + (compress ? compressBound(size) : uLong(size)));
+    frame.push_back(char(WIRE_MARKER));
+    frame.push_back(char(WIRE_VERSION));
+    frame.push_back(char(compress ? Compression::Zlib : Compression::None));
+    frame.push_back(char((size >> 24) & 0xff));
+    frame.push_back(char((size >> 16) & 0xff));
+    frame.push_back(char((size >> 8) & 0xff));
+    frame.push_back(char(size & 0xff));
+
+    if (false == compress) {
+        frame.append(message.Get(), size);
+
+        return true;
+    }
+
+    uLongf compressedSize{compressBound(size)};
+    frame.resize(WIRE_HEADER_SIZE + compressedSize);
+    const auto result = compress2(
+        reinterpret_cast<Bytef*>(&frame[WIRE_HEADER_SIZE]),
+        &compressedSize,
+        reinterpret_cast<const Bytef*>(message.Get()),
+        size,
+        std::max(Z_DEFAULT_COMPRESSION, std::min(Z_BEST_COMPRESSION, level)));
+
+    if (Z_OK != result) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Compression failed.").Flush();
+        frame.clear();
+
+        return false;
+    }
+
+    frame.resize(WIRE_HEADER_SIZE + compressedSize);
+
+    return true;
+}
+
+bool WireFormat::IsBinary(const std::string& frame)
+{
+    return (false == frame.empty()) && (char(WIRE_MARKER) == frame.front());
+}
+
+std::string WireFormat::Rejected()
+{
+    std::string output(WIRE_HEADER_SIZE, '\0');
+    output[1] = char(WIRE_VERSION);
+    output[2] = char(Compression::None);
+
+    return output;
+}
+}  // namespace opentxs::network::implementation
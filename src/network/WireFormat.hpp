@@ -0,0 +1,56 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace opentxs::network::implementation
+{
+// Framing of legacy notary requests and replies.
+//
+// Armored frames hold a serialized Message compressed at Z_BEST_COMPRESSION
+// and base64 encoded, which every client and notary understands. Binary
+// frames start with a zero byte, which never appears in armored text,
+// followed by a version byte, a compression byte, the size of the serialized
+// Message as a big endian 32 bit integer and the serialized Message itself,
+// deflated at a configurable level or not at all.
+//
+// A notary always replies in the framing of the request. A notary which
+// predates binary framing replies to a binary request with an empty frame.
+// A notary which can not process a request replies with an empty frame
+// (armored) or a bare header (binary).
+class WireFormat
+{
+public:
+    static bool Decode(const std::string& frame, String& message);
+    static bool EncodeArmored(const String& message, std::string& frame);
+    /** level is a zlib compression level. 0 disables compression. */
+    static bool EncodeBinary(
+        const String& message,
+        const std::int32_t level,
+        std::string& frame);
+    static bool IsBinary(const std::string& frame);
+    /** Binary reply to a binary request which could not be processed */
+    static std::string Rejected();
+
+private:
+    enum class Compression : std::uint8_t {
+        None = 0,
+        Zlib = 1,
+    };
+
+    static bool decode_binary(const std::string& frame, String& message);
+
+    WireFormat() = delete;
+    WireFormat(const WireFormat&) = delete;
+    WireFormat(WireFormat&&) = delete;
+    WireFormat& operator=(const WireFormat&) = delete;
+    WireFormat& operator=(WireFormat&&) = delete;
+};
+}  // namespace opentxs::network::implementation
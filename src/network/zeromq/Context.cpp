@@ -22,6 +22,7 @@
 #include "opentxs/network/zeromq/SubscribeSocket.hpp"
 
 #include "PairEventListener.hpp"
+#include "Reactor.hpp"
 
 #include <zmq.h>
 
@@ -92,9 +93,14 @@ namespace opentxs::network::zeromq::implementation
 {
 Context::Context()
     : context_(zmq_ctx_new())
+    , reactor_(nullptr)
 {
     OT_ASSERT(nullptr != context_);
     OT_ASSERT(1 == zmq_has("curve"));
+
+    reactor_.reset(new implementation::Reactor(context_));
+
+    OT_ASSERT(reactor_);
 }
 
 Context::operator void*() const
@@ -131,6 +137,13 @@ OTZMQDealerSocket Context::DealerSocket(
     return DealerSocket::Factory(*this, direction, callback);
 }
 
+const internal::Reactor& Context::Reactor() const
+{
+    OT_ASSERT(reactor_);
+
+    return *reactor_;
+}
+
 OTZMQSubscribeSocket Context::PairEventListener(
     const PairEventCallback& callback,
     const int instance) const
@@ -215,6 +228,8 @@ OTZMQSubscribeSocket Context::SubscribeSocket(
 
 Context::~Context()
 {
+    reactor_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
@@ -9,9 +9,15 @@
 
 #include "opentxs/network/zeromq/Context.hpp"
 
+#include "internal/network/zeromq/Internal.hpp"
+
+#include <memory>
+
 namespace opentxs::network::zeromq::implementation
 {
-class Context : virtual public zeromq::Context
+class Reactor;
+
+class Context : virtual public internal::Context
 {
 public:
     operator void*() const override;
@@ -60,12 +66,15 @@ public:
     OTZMQSubscribeSocket SubscribeSocket(
         const ListenCallback& callback) const override;
 
+    const internal::Reactor& Reactor() const override;
+
     ~Context();
 
 private:
     friend network::zeromq::Context;
 
     void* context_{nullptr};
+    std::unique_ptr<implementation::Reactor> reactor_;
 
     Context* clone() const override;
 
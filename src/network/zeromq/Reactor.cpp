@@ -0,0 +1,279 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include "network/zeromq/socket/Socket.hpp"
+
+#include <zmq.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "Reactor.hpp"
+
+#define REACTOR_MIN_WORKERS 4
+#define REACTOR_MAX_WORKERS 16
+#define REACTOR_STALL_MILLISECONDS 100
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::implementation
+{
+Reactor::Reactor(void* context)
+    : endpoint_(socket::implementation::Socket::random_inproc_endpoint())
+    , running_(true)
+    , wake_push_(zmq_socket(context, ZMQ_PUSH))
+    , wake_pull_(zmq_socket(context, ZMQ_PULL))
+    , wake_lock_()
+    , lock_()
+    , state_changed_()
+    , next_id_(0)
+    , generation_(0)
+    , registrations_()
+    , executor_(worker_count())
+    , poller_()
+{
+    OT_ASSERT(nullptr != wake_push_);
+    OT_ASSERT(nullptr != wake_pull_);
+
+    const int linger{0};
+    zmq_setsockopt(wake_push_, ZMQ_LINGER, &linger, sizeof(linger));
+    zmq_setsockopt(wake_pull_, ZMQ_LINGER, &linger, sizeof(linger));
+
+    const auto bound = zmq_bind(wake_pull_, endpoint_.c_str());
+
+    OT_ASSERT(0 == bound);
+
+    const auto connected = zmq_connect(wake_push_, endpoint_.c_str());
+
+    OT_ASSERT(0 == connected);
+
+    poller_ = std::thread(&Reactor::poll, this);
+}
+
+int Reactor::Add(const std::vector<void*>& sockets, Callback&& callback) const
+{
+    OT_ASSERT(callback);
+
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return -1; }
+
+    const auto id = ++next_id_;
+    const auto task = executor_.Add(
+        [this, id, cb = std::move(callback)]() -> void {
+            cb();
+            finish(id);
+        });
+
+    if (-1 == task) { return -1; }
+
+    auto& registration = registrations_[id];
+    registration.sockets_ = sockets;
+    registration.task_ = task;
+    lock.unlock();
+    signal();
+
+    return id;
+}
+
+void Reactor::drain_wake_socket()
+{
+    char buffer{0};
+
+    while (-1 != zmq_recv(wake_pull_, &buffer, sizeof(buffer), ZMQ_DONTWAIT)) {
+        ;
+    }
+}
+
+void Reactor::finish(const int id) const
+{
+    Lock lock(lock_);
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() != it) { it->second.busy_ = false; }
+
+    lock.unlock();
+    signal();
+}
+
+void Reactor::poll()
+{
+    std::vector<zmq_pollitem_t> items{};
+    std::vector<int> owners{};
+    std::vector<int> ready{};
+    const std::chrono::milliseconds stall{REACTOR_STALL_MILLISECONDS};
+
+    while (running_.load()) {
+        items.clear();
+        owners.clear();
+        ready.clear();
+        items.push_back({wake_pull_, 0, ZMQ_POLLIN, 0});
+        owners.push_back(-1);
+        bool busy{false};
+        Lock lock(lock_);
+
+        for (auto& [id, registration] : registrations_) {
+            if (registration.removed_) { continue; }
+
+            if (registration.busy_) {
+                busy = true;
+
+                continue;
+            }
+
+            if (registration.pending_) {
+                registration.pending_ = false;
+                registration.busy_ = true;
+                ready.push_back(registration.task_);
+                busy = true;
+
+                continue;
+            }
+
+            for (auto* socket : registration.sockets_) {
+                items.push_back({socket, 0, ZMQ_POLLIN, 0});
+                owners.push_back(id);
+            }
+        }
+
+        lock.unlock();
+
+        for (const auto task : ready) { executor_.Wake(task); }
+
+        ready.clear();
+        // While callbacks are out, wake up regularly to check that they are
+        // not all blocked waiting on sockets which are still queued
+        const auto events = zmq_poll(
+            items.data(),
+            items.size(),
+            busy ? static_cast<long>(stall.count()) : -1);
+        lock.lock();
+        ++generation_;
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+
+            if (ETERM == error) {
+                running_.store(false);
+            } else {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+            }
+        } else {
+            for (std::size_t i = 1; i < items.size(); ++i) {
+                if (0 == (ZMQ_POLLIN & items.at(i).revents)) { continue; }
+
+                auto it = registrations_.find(owners.at(i));
+
+                if (registrations_.end() == it) { continue; }
+
+                auto& registration = it->second;
+
+                if (registration.removed_) { continue; }
+                if (registration.busy_) { continue; }
+
+                registration.busy_ = true;
+                ready.push_back(registration.task_);
+            }
+        }
+
+        lock.unlock();
+        state_changed_.notify_all();
+
+        for (const auto task : ready) { executor_.Wake(task); }
+
+        if (busy) { executor_.Grow(stall); }
+
+        if (ZMQ_POLLIN & items.at(0).revents) { drain_wake_socket(); }
+    }
+}
+
+void Reactor::Remove(const int id) const
+{
+    Lock lock(lock_);
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return; }
+
+    auto& registration = it->second;
+    registration.removed_ = true;
+    const auto task = registration.task_;
+
+    if (false == registration.busy_) {
+        // The poller may be inside zmq_poll with this socket, so wait for it
+        // to complete a cycle before allowing the caller to close the socket.
+        const auto target = generation_ + 1;
+        lock.unlock();
+        signal();
+        lock.lock();
+        state_changed_.wait(lock, [&]() -> bool {
+            return (generation_ >= target) || (false == running_.load());
+        });
+    }
+
+    lock.unlock();
+    // Waits for a running callback to return, unless called from inside it
+    executor_.Remove(task);
+    lock.lock();
+    registrations_.erase(id);
+}
+
+void Reactor::signal() const
+{
+    Lock lock(wake_lock_);
+    zmq_send(wake_push_, nullptr, 0, ZMQ_DONTWAIT);
+}
+
+bool Reactor::Wake(const int id) const
+{
+    Lock lock(lock_);
+
+    if (false == running_.load()) { return false; }
+
+    auto it = registrations_.find(id);
+
+    if (registrations_.end() == it) { return false; }
+
+    auto& registration = it->second;
+
+    if (registration.removed_) { return false; }
+
+    registration.pending_ = true;
+    lock.unlock();
+    signal();
+
+    return true;
+}
+
+std::size_t Reactor::worker_count()
+{
+    return std::clamp<std::size_t>(
+        std::thread::hardware_concurrency(),
+        REACTOR_MIN_WORKERS,
+        REACTOR_MAX_WORKERS);
+}
+
+Reactor::~Reactor()
+{
+    Lock lock(lock_);
+    running_.store(false);
+    lock.unlock();
+    signal();
+    state_changed_.notify_all();
+
+    if (poller_.joinable()) { poller_.join(); }
+
+    executor_.Stop();
+
+    zmq_disconnect(wake_push_, endpoint_.c_str());
+    zmq_unbind(wake_pull_, endpoint_.c_str());
+    zmq_close(wake_push_);
+    zmq_close(wake_pull_);
+}
+}  // namespace opentxs::network::zeromq::implementation
@@ -0,0 +1,70 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "api/Executor.hpp"
+#include "internal/network/zeromq/Internal.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs::network::zeromq::implementation
+{
+class Reactor final : virtual public internal::Reactor
+{
+public:
+    int Add(const std::vector<void*>& sockets, Callback&& callback)
+        const override;
+    void Remove(const int id) const override;
+    bool Wake(const int id) const override;
+
+    explicit Reactor(void* context);
+
+    ~Reactor();
+
+private:
+    struct Registration {
+        std::vector<void*> sockets_{};
+        int task_{-1};
+        // Handed to the executor and not yet returned, so not polled
+        bool busy_{false};
+        bool pending_{false};
+        bool removed_{false};
+    };
+
+    const std::string endpoint_;
+    std::atomic<bool> running_;
+    void* wake_push_{nullptr};
+    void* wake_pull_{nullptr};
+    mutable std::mutex wake_lock_;
+    mutable std::mutex lock_;
+    mutable std::condition_variable state_changed_;
+    mutable int next_id_{0};
+    mutable std::uint64_t generation_{0};
+    mutable std::map<int, Registration> registrations_;
+    api::implementation::Executor executor_;
+    std::thread poller_;
+
+    static std::size_t worker_count();
+
+    void drain_wake_socket();
+    void finish(const int id) const;
+    void poll();
+    void signal() const;
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
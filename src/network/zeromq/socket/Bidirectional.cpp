@@ -18,9 +18,6 @@
 
 #include "Bidirectional.hpp"
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define POLL_MILLISECONDS 100
-
 #define OT_METHOD "opentxs::network::zeromq::implementation::Bidirectional::"
 
 namespace opentxs::network::zeromq::socket::implementation
@@ -30,9 +27,8 @@ Bidirectional::Bidirectional(
     const SocketType type,
     const zeromq::Socket::Direction direction,
     const bool startThread)
-    : Receiver(context, type, direction, false)
+    : Receiver(context, type, direction, startThread)
     , push_socket_{zmq_socket(context, ZMQ_PUSH)}
-    , bidirectional_start_thread_(startThread)
     , endpoint_{Socket::random_inproc_endpoint()}
     , pull_socket_{zmq_socket(context, ZMQ_PULL)}
 {
@@ -108,11 +104,12 @@ void Bidirectional::init()
 
     OT_ASSERT(false != connected);
 
-    Socket::init();
+    Receiver::init();
+}
 
-    if (bidirectional_start_thread_) {
-        receiver_thread_ = std::thread(&Bidirectional::thread, this);
-    }
+std::vector<void*> Bidirectional::poll_sockets() const
+{
+    return {socket_, pull_socket_};
 }
 
 bool Bidirectional::process_pull_socket(const Lock& lock)
@@ -139,6 +136,29 @@ bool Bidirectional::process_receiver_socket(const Lock& lock)
     return true;
 }
 
+void Bidirectional::process_sockets(const Lock& lock)
+{
+    for (std::size_t i = 0; i < RECEIVER_BATCH_SIZE; ++i) {
+        if (false == running_.get()) { return; }
+
+        bool processed{false};
+
+        if (have_message(socket_)) {
+            if (false == process_receiver_socket(lock)) { return; }
+
+            processed = true;
+        }
+
+        if (have_message(pull_socket_)) {
+            if (false == process_pull_socket(lock)) { return; }
+
+            processed = true;
+        }
+
+        if (false == processed) { return; }
+    }
+}
+
 bool Bidirectional::queue_message(zeromq::Message& message) const
 {
     Lock lock(send_lock_);
@@ -158,65 +178,11 @@ bool Bidirectional::send(const Lock& lock, zeromq::Message& message)
 void Bidirectional::shutdown(const Lock& lock)
 {
     Lock send(send_lock_);
-    Socket::shutdown(lock);
+    Receiver::shutdown(lock);
 
     if (running_.get()) {
         zmq_disconnect(push_socket_, endpoint_.c_str());
         zmq_unbind(pull_socket_, endpoint_.c_str());
     }
 }
-
-void Bidirectional::thread()
-{
-    LogVerbose(OT_METHOD)(__FUNCTION__)(": Starting listener").Flush();
-
-    while (running_.get()) {
-        if (have_callback()) { break; }
-
-        Log::Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
-    }
-
-    LogVerbose(OT_METHOD)(__FUNCTION__)(": Callback ready").Flush();
-    zmq_pollitem_t poll[2];
-    poll[0].socket = socket_;
-    poll[0].events = ZMQ_POLLIN;
-    poll[1].socket = pull_socket_;
-    poll[1].events = ZMQ_POLLIN;
-
-    while (running_.get()) {
-        std::this_thread::yield();
-        Lock lock(lock_, std::try_to_lock);
-
-        if (false == lock.owns_lock()) { continue; }
-
-        run_tasks(lock);
-        const auto events = zmq_poll(poll, 2, POLL_MILLISECONDS);
-
-        if (0 == events) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": No messages.").Flush();
-
-            continue;
-        }
-
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            otErr << OT_METHOD << __FUNCTION__
-                  << ": Poll error: " << zmq_strerror(error) << std::endl;
-
-            continue;
-        }
-
-        bool processed = true;
-
-        if (ZMQ_POLLIN == poll[0].revents) {
-            processed = process_receiver_socket(lock);
-        }
-
-        if (processed && ZMQ_POLLIN == poll[1].revents) {
-            processed = process_pull_socket(lock);
-        }
-    }
-
-    LogVerbose(OT_METHOD)(__FUNCTION__)(": Shutting down").Flush();
-}
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -14,7 +14,7 @@
 
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <vector>
 
 namespace opentxs::network::zeromq::socket::implementation
 {
@@ -30,13 +30,14 @@ protected:
         const bool startThread);
 
     void init() override;
+    std::vector<void*> poll_sockets() const override;
+    void process_sockets(const Lock& lock) override;
     bool queue_message(zeromq::Message& message) const;
     void shutdown(const Lock& lock) override;
 
     virtual ~Bidirectional() = default;
 
 private:
-    const bool bidirectional_start_thread_{true};
     const std::string endpoint_;
     void* pull_socket_{nullptr};
     mutable int linger_{0};
@@ -57,7 +58,6 @@ private:
     bool process_pull_socket(const Lock& lock);
     bool process_receiver_socket(const Lock& lock);
     bool send(const Lock& lock, zeromq::Message& message);
-    void thread() override;
 
     Bidirectional() = delete;
     Bidirectional(const Bidirectional&) = delete;
@@ -14,16 +14,20 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/Types.hpp"
 
+#include "internal/network/zeromq/Internal.hpp"
 #include "network/zeromq/socket/Socket.hpp"
 
 #include <zmq.h>
 
+#include <atomic>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <utility>
+#include <vector>
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define RECEIVER_POLL_MILLISECONDS 100
+#define RECEIVER_BATCH_SIZE 64
 
 #define RECEIVER_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
@@ -36,15 +40,17 @@ public:
     bool apply_socket(SocketCallback&& cb) const override;
 
 protected:
-    std::thread receiver_thread_{};
+    static bool have_message(void* socket);
 
     virtual bool have_callback() const { return false; }
     void run_tasks(const Lock& lock) const;
 
     void init() override;
+    virtual std::vector<void*> poll_sockets() const { return {socket_}; }
     virtual void process_incoming(const Lock& lock, T& message) = 0;
+    virtual void process_sockets(const Lock& lock);
     void shutdown(const Lock& lock) override;
-    virtual void thread();
+    void stop() const override;
 
     Receiver(
         const zeromq::Context& context,
@@ -55,15 +61,16 @@ protected:
     virtual ~Receiver();
 
 private:
+    using Task = std::pair<SocketCallback, std::promise<bool>>;
+
     const bool start_thread_{true};
+    mutable std::atomic<int> reactor_id_;
     mutable int next_task_;
     mutable std::mutex task_lock_;
-    mutable std::map<int, SocketCallback> socket_tasks_;
-    mutable std::map<int, bool> task_result_;
+    mutable std::map<int, Task> socket_tasks_;
 
-    int add_task(SocketCallback&& cb) const;
-    bool task_result(const int id) const;
-    bool task_running(const int id) const;
+    const internal::Reactor& reactor() const;
+    void service();
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
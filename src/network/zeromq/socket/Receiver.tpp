@@ -17,8 +17,8 @@ Receiver<T>::Receiver(
     const Socket::Direction direction,
     const bool startThread)
     : Socket(context, type, direction)
-    , receiver_thread_()
     , start_thread_(startThread)
+    , reactor_id_(-1)
     , next_task_(0)
     , task_lock_()
     , socket_tasks_()
@@ -26,26 +26,40 @@ Receiver<T>::Receiver(
 }
 
 template <typename T>
-int Receiver<T>::add_task(SocketCallback&& cb) const
+bool Receiver<T>::apply_socket(SocketCallback&& cb) const
 {
-    Lock lock(task_lock_);
-    auto [it, success] = socket_tasks_.emplace(++next_task_, std::move(cb));
+    const auto id = reactor_id_.load();
 
-    OT_ASSERT(success);
+    if (-1 == id) { return Socket::apply_socket(std::move(cb)); }
 
-    return it->first;
+    std::promise<bool> promise{};
+    auto output = promise.get_future();
+    Lock task_lock(task_lock_);
+    socket_tasks_.emplace(
+        ++next_task_, Task{std::move(cb), std::move(promise)});
+    task_lock.unlock();
+
+    if (false == reactor().Wake(id)) {
+        // The reactor is no longer servicing this socket so nothing else will
+        // ever run the task.
+        Lock lock(lock_);
+        run_tasks(lock);
+    }
+
+    return output.get();
 }
 
 template <typename T>
-bool Receiver<T>::apply_socket(SocketCallback&& cb) const
+bool Receiver<T>::have_message(void* socket)
 {
-    const auto id = add_task(std::move(cb));
+    int events{0};
+    std::size_t size{sizeof(events)};
 
-    while (task_running(id)) {
-        Log::Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
+    if (0 != zmq_getsockopt(socket, ZMQ_EVENTS, &events, &size)) {
+        return false;
     }
 
-    return task_result(id);
+    return (ZMQ_POLLIN == (ZMQ_POLLIN & events));
 }
 
 template <typename T>
@@ -53,104 +67,88 @@ void Receiver<T>::init()
 {
     Socket::init();
 
-    if (start_thread_) {
-        receiver_thread_ = std::thread(&Receiver::thread, this);
+    if (start_thread_ && have_callback()) {
+        reactor_id_.store(
+            reactor().Add(poll_sockets(), [this]() -> void { service(); }));
     }
 }
 
 template <typename T>
-void Receiver<T>::run_tasks(const Lock& lock) const
+void Receiver<T>::process_sockets(const Lock& lock)
 {
-    Lock task_lock(task_lock_);
+    for (std::size_t i = 0; i < RECEIVER_BATCH_SIZE; ++i) {
+        if (false == running_.get()) { return; }
+        if (false == have_message(socket_)) { return; }
+
+        auto reply = T::Factory();
+        const auto received = Socket::receive_message(lock, socket_, reply);
+
+        if (false == received) {
+            std::cerr << RECEIVER_METHOD << __FUNCTION__
+                      << ": Failed to receive incoming message." << std::endl;
+
+            return;
+        }
 
-    for (auto i = socket_tasks_.begin(); i != socket_tasks_.end(); ++i) {
-        const auto& [id, cb] = *i;
-        task_result_.emplace(id, cb(lock));
-        socket_tasks_.erase(i);
+        process_incoming(lock, reply);
     }
 }
 
 template <typename T>
-void Receiver<T>::shutdown(const Lock& lock)
+const internal::Reactor& Receiver<T>::reactor() const
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
-
-    Socket::shutdown(lock);
+    return dynamic_cast<const internal::Context&>(context_).Reactor();
 }
 
 template <typename T>
-bool Receiver<T>::task_result(const int id) const
+void Receiver<T>::run_tasks(const Lock& lock) const
 {
-    Lock lock(task_lock_);
-    const auto it = task_result_.find(id);
-
-    OT_ASSERT(task_result_.end() != it);
-
-    auto output = it->second;
-    task_result_.erase(it);
+    Lock task_lock(task_lock_);
 
-    return output;
+    while (false == socket_tasks_.empty()) {
+        auto it = socket_tasks_.begin();
+        auto& [cb, promise] = it->second;
+        promise.set_value(cb(lock));
+        socket_tasks_.erase(it);
+    }
 }
 
 template <typename T>
-bool Receiver<T>::task_running(const int id) const
+void Receiver<T>::service()
 {
-    Lock lock(task_lock_);
+    Lock lock(lock_);
+
+    if (false == running_.get()) { return; }
 
-    return (1 == socket_tasks_.count(id));
+    run_tasks(lock);
+    process_sockets(lock);
 }
 
 template <typename T>
-void Receiver<T>::thread()
+void Receiver<T>::shutdown(const Lock& lock)
 {
-    while (running_.get()) {
-        if (have_callback()) { break; }
-
-        Log::Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
-    }
-
-    zmq_pollitem_t poll[1];
-    poll[0].socket = socket_;
-    poll[0].events = ZMQ_POLLIN;
-
-    while (running_.get()) {
-        std::this_thread::yield();
-        Lock lock(lock_, std::try_to_lock);
-
-        if (false == lock.owns_lock()) { continue; }
-
-        run_tasks(lock);
-        const auto events = zmq_poll(poll, 1, RECEIVER_POLL_MILLISECONDS);
-
-        if (0 == events) { continue; }
-
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+    {
+        Lock task_lock(task_lock_);
 
-            continue;
-        }
-
-        if (false == running_.get()) { return; }
+        for (auto& it : socket_tasks_) { it.second.second.set_value(false); }
 
-        auto reply = T::Factory();
-        const auto received = Socket::receive_message(lock, socket_, reply);
+        socket_tasks_.clear();
+    }
 
-        if (false == received) {
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Failed to receive incoming message." << std::endl;
+    Socket::shutdown(lock);
+}
 
-            continue;
-        }
+template <typename T>
+void Receiver<T>::stop() const
+{
+    const auto id = reactor_id_.exchange(-1);
 
-        process_incoming(lock, reply);
-    }
+    if (-1 != id) { reactor().Remove(id); }
 }
 
 template <typename T>
 Receiver<T>::~Receiver()
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
+    stop();
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -137,6 +137,7 @@ bool Socket::connect(const Lock& lock, const std::string& endpoint) const
 
 bool Socket::Close() const
 {
+    stop();
     Lock lock(lock_);
 
     if (nullptr == socket_) { return false; }
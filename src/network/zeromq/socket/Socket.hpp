@@ -21,6 +21,7 @@
 #define SHUTDOWN                                                               \
     {                                                                          \
         running_->Off();                                                       \
+        stop();                                                                \
         Lock lock(lock_);                                                      \
         shutdown(lock);                                                        \
     }
@@ -81,6 +82,8 @@ protected:
 
     virtual void init() {}
     virtual void shutdown(const Lock& lock);
+    // Must not be called while holding lock_
+    virtual void stop() const {}
 
     explicit Socket(
         const zeromq::Context& context,
@@ -9,7 +9,6 @@
 #include "opentxs/api/client/Manager.hpp"
 #include "opentxs/api/client/ServerAction.hpp"
 #include "opentxs/api/client/Sync.hpp"
-#include "opentxs/api/client/UI.hpp"
 #include "opentxs/api/client/Workflow.hpp"
 #include "opentxs/api/server/Manager.hpp"
 #include "opentxs/api/storage/Storage.hpp"
@@ -27,9 +26,11 @@
 #include "opentxs/core/contract/UnitDefinition.hpp"
 #include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/Cheque.hpp"
+#include "opentxs/core/Item.hpp"
 #include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -37,17 +38,18 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/network/zeromq/PullSocket.hpp"
-#include "opentxs/ui/AccountActivity.hpp"
-#include "opentxs/ui/BalanceItem.hpp"
 #include "opentxs/Proto.hpp"
 
 #include "internal/rpc/Internal.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <string>
 
 #include "RPC.hpp"
 
 #define ACCOUNTEVENT_VERSION 2
+#define ACCOUNT_ACTIVITY_PAGE 50
 #define ACCOUNTDATA_VERSION 1
 #define RPCTASK_VERSION 1
 #define RPCSTATUS_VERSION 1
@@ -198,6 +200,142 @@ proto::RPCResponse RPC::accept_pending_payments(
     return output;
 }
 
+std::size_t RPC::add_account_events(
+    const api::client::Manager& client,
+    const Identifier& nymID,
+    const Identifier& accountID,
+    const Identifier& workflowID,
+    proto::RPCResponse& output) const
+{
+    const auto workflow = client.Workflow().LoadWorkflow(nymID, workflowID);
+
+    if (false == bool(workflow)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load workflow ")(
+            workflowID)
+            .Flush();
+
+        return 0;
+    }
+
+    auto type{proto::ACCOUNTEVENT_ERROR};
+    Amount amount{0};
+    std::string memo{};
+    std::string uuid{};
+
+    switch (workflow->type()) {
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGCHEQUE:
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGCHEQUE: {
+            const auto cheque =
+                api::client::Workflow::InstantiateCheque(client, *workflow)
+                    .second;
+
+            if (false == bool(cheque)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to instantiate cheque from workflow ")(workflowID)
+                    .Flush();
+
+                return 0;
+            }
+
+            if (proto::PAYMENTWORKFLOWTYPE_INCOMINGCHEQUE == workflow->type()) {
+                type = proto::ACCOUNTEVENT_INCOMINGCHEQUE;
+                amount = cheque->GetAmount();
+            } else {
+                type = proto::ACCOUNTEVENT_OUTGOINGCHEQUE;
+                amount = -1 * cheque->GetAmount();
+            }
+
+            memo = cheque->GetMemo().Get();
+            uuid = api::client::Workflow::UUID(
+                cheque->GetNotaryID(), cheque->GetTransactionNum());
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGTRANSFER:
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGTRANSFER:
+        case proto::PAYMENTWORKFLOWTYPE_INTERNALTRANSFER: {
+            const auto transfer =
+                api::client::Workflow::InstantiateTransfer(client, *workflow)
+                    .second;
+
+            if (false == bool(transfer)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to instantiate transfer from workflow ")(
+                    workflowID)
+                    .Flush();
+
+                return 0;
+            }
+
+            // An internal transfer is incoming for its destination account
+            bool incoming{false};
+
+            if (proto::PAYMENTWORKFLOWTYPE_INTERNALTRANSFER ==
+                workflow->type()) {
+                incoming = (accountID == transfer->GetDestinationAcctID());
+            } else {
+                incoming = (proto::PAYMENTWORKFLOWTYPE_INCOMINGTRANSFER ==
+                            workflow->type());
+            }
+
+            if (incoming) {
+                type = proto::ACCOUNTEVENT_INCOMINGTRANSFER;
+                amount = transfer->GetAmount();
+            } else {
+                type = proto::ACCOUNTEVENT_OUTGOINGTRANSFER;
+                amount = -1 * transfer->GetAmount();
+            }
+
+            auto note = String::Factory();
+            transfer->GetNote(note);
+            memo = note->Get();
+            uuid = api::client::Workflow::UUID(
+                transfer->GetPurportedNotaryID(),
+                transfer->GetTransactionNum());
+        } break;
+        case proto::PAYMENTWORKFLOWTYPE_ERROR:
+        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGINVOICE:
+        case proto::PAYMENTWORKFLOWTYPE_INCOMINGINVOICE:
+        default: {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Unsupported workflow type (")(
+                workflow->type())(")")
+                .Flush();
+
+            return 0;
+        }
+    }
+
+    std::string contact{};
+
+    if (0 < workflow->party_size()) {
+        contact = client.Contacts()
+                      .NymToContact(Identifier::Factory(workflow->party(0)))
+                      ->str();
+    } else if (proto::ACCOUNTEVENT_INCOMINGTRANSFER == type) {
+        contact = client.Contacts().ContactID(nymID)->str();
+    }
+
+    const auto rows = api::client::Workflow::ExtractActivity(*workflow);
+
+    for (const auto& row : rows) {
+        const auto& time = row.second.first;
+        auto& accountevent = *output.add_accountevent();
+        accountevent.set_version(ACCOUNTEVENT_VERSION);
+        accountevent.set_id(accountID.str());
+        accountevent.set_type(type);
+
+        if (false == contact.empty()) { accountevent.set_contact(contact); }
+
+        accountevent.set_workflow(workflowID.str());
+        accountevent.set_amount(amount);
+        accountevent.set_pendingamount(amount);
+        accountevent.set_timestamp(std::chrono::system_clock::to_time_t(time));
+        accountevent.set_memo(memo);
+        accountevent.set_uuid(uuid);
+        accountevent.set_state(workflow->state());
+    }
+
+    return rows.size();
+}
+
 proto::RPCResponse RPC::add_claim(const proto::RPCCommand& command) const
 {
     auto output = init(command);
@@ -748,63 +886,31 @@ proto::RPCResponse RPC::get_account_activity(
     for (const auto& id : command.identifier()) {
         const auto accountid = Identifier::Factory(id);
         const auto accountownerid = client.Storage().AccountOwner(accountid);
-        auto& accountactivity =
-            client.UI().AccountActivity(accountownerid, accountid);
-        auto balanceitem = accountactivity.First();
+        std::size_t events{0};
+        std::size_t start{0};
 
-        if (!balanceitem->Valid()) {
-            add_output_status(output, proto::RPCRESPONSE_NONE);
-            continue;
-        }
+        // Workflows are read directly, one page at a time, so the reply
+        // doesn't depend on the window of the AccountActivity widget which UI
+        // code shares for this account
+        while (true) {
+            const auto workflows = client.Workflow().WorkflowsByAccount(
+                accountownerid, accountid, start, ACCOUNT_ACTIVITY_PAGE);
 
-        auto last = false;
+            if (workflows.empty()) { break; }
 
-        while (false == last) {
-            auto& accountevent = *output.add_accountevent();
-            accountevent.set_version(ACCOUNTEVENT_VERSION);
-            accountevent.set_id(id);
-
-            auto accounteventtype =
-                storagebox_to_accounteventtype(balanceitem->Type());
-            if (proto::ACCOUNTEVENT_ERROR == accounteventtype &&
-                StorageBox::INTERNALTRANSFER == balanceitem->Type()) {
-                if (0 > balanceitem->Amount()) {
-                    accounteventtype = proto::ACCOUNTEVENT_OUTGOINGTRANSFER;
-                } else {
-                    accounteventtype = proto::ACCOUNTEVENT_INCOMINGTRANSFER;
-                }
-            }
-            accountevent.set_type(accounteventtype);
-
-            if (0 < balanceitem->Contacts().size()) {
-                accountevent.set_contact(balanceitem->Contacts().at(0));
-            } else if (
-                proto::ACCOUNTEVENT_INCOMINGTRANSFER == accounteventtype) {
-                const auto contactid =
-                    client.Contacts().ContactID(accountownerid);
-                accountevent.set_contact(contactid->str());
+            for (const auto& workflowid : workflows) {
+                events += add_account_events(
+                    client, accountownerid, accountid, workflowid, output);
             }
 
-            accountevent.set_workflow(balanceitem->Workflow());
-            accountevent.set_amount(balanceitem->Amount());
-            accountevent.set_pendingamount(balanceitem->Amount());
-            accountevent.set_timestamp(
-                std::chrono::system_clock::to_time_t(balanceitem->Timestamp()));
-            accountevent.set_memo(balanceitem->Memo());
-            accountevent.set_uuid(balanceitem->UUID());
-            auto workflow = client.Workflow().LoadWorkflow(
-                accountownerid, Identifier::Factory(balanceitem->Workflow()));
-
-            if (workflow) { accountevent.set_state(workflow->state()); }
-
-            if (balanceitem->Last()) {
-                last = true;
-            } else {
-                balanceitem = accountactivity.Next();
-            }
+            start += workflows.size();
         }
 
-        add_output_status(output, proto::RPCRESPONSE_SUCCESS);
+        if (0 == events) {
+            add_output_status(output, proto::RPCRESPONSE_NONE);
+        } else {
+            add_output_status(output, proto::RPCRESPONSE_SUCCESS);
+        }
     }
 
     return output;
@@ -2066,29 +2172,4 @@ proto::RPCResponse RPC::start_server(const proto::RPCCommand& command) const
     return output;
 }
 
-proto::AccountEventType RPC::storagebox_to_accounteventtype(
-    StorageBox storagebox)
-{
-    proto::AccountEventType accounteventtype = proto::ACCOUNTEVENT_ERROR;
-
-    switch (storagebox) {
-        case StorageBox::INCOMINGCHEQUE: {
-            accounteventtype = proto::ACCOUNTEVENT_INCOMINGCHEQUE;
-        } break;
-        case StorageBox::OUTGOINGCHEQUE: {
-            accounteventtype = proto::ACCOUNTEVENT_OUTGOINGCHEQUE;
-        } break;
-        case StorageBox::INCOMINGTRANSFER: {
-            accounteventtype = proto::ACCOUNTEVENT_INCOMINGTRANSFER;
-        } break;
-        case StorageBox::OUTGOINGTRANSFER: {
-            accounteventtype = proto::ACCOUNTEVENT_OUTGOINGTRANSFER;
-        } break;
-        default: {
-        }
-    }
-
-    return accounteventtype;
-}
-
 }  // namespace opentxs::rpc::implementation
@@ -37,11 +37,15 @@ private:
     static std::size_t get_index(std::int32_t instance);
     static proto::RPCResponse init(const proto::RPCCommand& command);
     static proto::RPCResponse invalid_command(const proto::RPCCommand& command);
-    static proto::AccountEventType storagebox_to_accounteventtype(
-        StorageBox storagebox);
 
     proto::RPCResponse accept_pending_payments(
         const proto::RPCCommand& command) const;
+    std::size_t add_account_events(
+        const api::client::Manager& client,
+        const Identifier& nymID,
+        const Identifier& accountID,
+        const Identifier& workflowID,
+        proto::RPCResponse& output) const;
     proto::RPCResponse add_claim(const proto::RPCCommand& command) const;
     proto::RPCResponse add_contact(const proto::RPCCommand& command) const;
     proto::RPCResponse create_account(const proto::RPCCommand& command) const;
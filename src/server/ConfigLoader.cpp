@@ -93,10 +93,10 @@ bool ConfigLoader::load(
     }
 
     {
-        const char* szComment = "; ms_between_cron_beats is the number of "
-                                "milliseconds before Cron processes\n"
-                                "; (all the trades, all the smart contracts, "
-                                "etc every 10 seconds.)\n";
+        const char* szComment = "; ms_between_cron_beats is the maximum "
+                                "number of milliseconds between Cron passes\n"
+                                "; (items are processed when they are due, "
+                                "but Cron wakes at least this often.)\n";
 
         bool bIsNewKey = false;
         std::int64_t lValue = 0;
@@ -175,6 +175,67 @@ bool ConfigLoader::load(
             static_cast<std::int32_t>(lValue));
     }
 
+    // LEDGER CACHE
+    {
+        const char* szComment = ";; LEDGER CACHE  (remembers which versions "
+                                "of each box the server has already "
+                                "verified)\n";
+
+        bool bSectionExists = false;
+        config.CheckSetSection(
+            String::Factory("ledger_cache"),
+            String::Factory(szComment),
+            bSectionExists);
+    }
+
+    {
+        const char* szComment = "; max_bytes is the memory budget of the "
+                                "ledger cache. Least recently used entries "
+                                "are\n"
+                                "; evicted beyond it. 0 disables the cache.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("ledger_cache"),
+            String::Factory("max_bytes"),
+            ServerSettings::GetLedgerCacheBytes(),
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        ServerSettings::SetLedgerCacheBytes(lValue);
+    }
+
+    // WIRE
+    {
+        const char* szComment = ";; WIRE  (framing of replies to clients "
+                                "which send binary requests)\n";
+
+        bool bSectionExists = false;
+        config.CheckSetSection(
+            String::Factory("wire"),
+            String::Factory(szComment),
+            bSectionExists);
+    }
+
+    {
+        const char* szComment = "; compression is the zlib level (1-9) "
+                                "applied to binary replies. 0 sends them\n"
+                                "; uncompressed, which is fastest for inproc "
+                                "and LAN clients.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        config.CheckSet_long(
+            String::Factory("wire"),
+            String::Factory("compression"),
+            ServerSettings::GetWireCompression(),
+            lValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        ServerSettings::SetWireCompression(static_cast<std::int32_t>(lValue));
+    }
+
     // PERMISSIONS
 
     {
@@ -0,0 +1,87 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+
+#include "Lanes.hpp"
+
+namespace opentxs::server
+{
+Lanes::Lanes(const std::size_t count)
+    : lanes_()
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(count, 1); ++i) {
+        lanes_.emplace_back(new Queue);
+    }
+}
+
+std::size_t Lanes::Lane(const Identifier& nymID) const
+{
+    return std::hash<OTIdentifier>{}(Identifier::Factory(nymID)) %
+           lanes_.size();
+}
+
+void Lanes::Push(const Identifier& nymID, Job&& job)
+{
+    OT_ASSERT(job);
+
+    auto& queue = *lanes_.at(Lane(nymID));
+    Lock lock(queue.lock_);
+
+    if (queue.shutdown_) { return; }
+
+    queue.jobs_.emplace_back(std::move(job));
+    lock.unlock();
+    queue.cv_.notify_one();
+}
+
+void Lanes::Start()
+{
+    for (auto& queue : lanes_) {
+        OT_ASSERT(false == queue->thread_.joinable());
+
+        queue->thread_ = std::thread(&Lanes::work, this, std::ref(*queue));
+    }
+}
+
+void Lanes::Stop()
+{
+    for (auto& queue : lanes_) {
+        Lock lock(queue->lock_);
+        queue->shutdown_ = true;
+        queue->jobs_.clear();
+        lock.unlock();
+        queue->cv_.notify_all();
+    }
+
+    for (auto& queue : lanes_) {
+        if (queue->thread_.joinable()) { queue->thread_.join(); }
+    }
+}
+
+void Lanes::work(Queue& queue)
+{
+    while (true) {
+        Lock lock(queue.lock_);
+        queue.cv_.wait(lock, [&]() -> bool {
+            return queue.shutdown_ || (false == queue.jobs_.empty());
+        });
+
+        if (queue.shutdown_) { return; }
+
+        auto job = std::move(queue.jobs_.front());
+        queue.jobs_.pop_front();
+        lock.unlock();
+        job();
+    }
+}
+
+Lanes::~Lanes() { Stop(); }
+}  // namespace opentxs::server
@@ -0,0 +1,64 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Identifier.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs::server
+{
+// Runs notary requests on a fixed set of worker threads, each of which owns
+// a queue.
+//
+// Every request from a nym goes to the same queue, so requests from one nym
+// run one at a time in the order they were added, while requests from nyms
+// on different queues run concurrently.
+class Lanes
+{
+public:
+    using Job = std::function<void()>;
+
+    std::size_t Count() const { return lanes_.size(); }
+    /** Returns the queue which runs jobs for the nym */
+    std::size_t Lane(const Identifier& nymID) const;
+    void Push(const Identifier& nymID, Job&& job);
+    void Start();
+    /** Waits for running jobs to return. Jobs still queued are dropped. */
+    void Stop();
+
+    explicit Lanes(const std::size_t count);
+
+    ~Lanes();
+
+private:
+    struct Queue {
+        std::mutex lock_{};
+        std::condition_variable cv_{};
+        std::deque<Job> jobs_{};
+        bool shutdown_{false};
+        std::thread thread_{};
+    };
+
+    std::vector<std::unique_ptr<Queue>> lanes_;
+
+    void work(Queue& queue);
+
+    Lanes() = delete;
+    Lanes(const Lanes&) = delete;
+    Lanes(Lanes&&) = delete;
+    Lanes& operator=(const Lanes&) = delete;
+    Lanes& operator=(Lanes&&) = delete;
+};
+}  // namespace opentxs::server
@@ -0,0 +1,293 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "LedgerCache.hpp"
+
+#include "opentxs/api/Core.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/core/Account.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Ledger.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/Nym.hpp"
+
+#include "Server.hpp"
+#include "ServerSettings.hpp"
+
+#include <memory>
+#include <mutex>
+#include <set>
+
+// Rough per-entry overhead of the map node, list node and identifiers.
+#define LEDGER_CACHE_ENTRY_OVERHEAD 256
+// The metrics are logged once per this many lookups.
+#define LEDGER_CACHE_REPORT_LOOKUPS 10000
+
+#define OT_METHOD "opentxs::server::LedgerCache::"
+
+namespace opentxs::server
+{
+LedgerCache::LedgerCache(Server& server)
+    : server_(server)
+    , lock_()
+    , lru_()
+    , index_()
+    , metrics_()
+{
+}
+
+bool LedgerCache::check(
+    const Ledger& box,
+    const Nym& signer,
+    const Identifier& hash)
+{
+    Lock lock(lock_);
+    auto it = index_.find(key(box));
+    const bool hit = (index_.end() != it) &&
+                     (it->second->hash_.get() == hash) &&
+                     (it->second->signer_.get() == signer.ID());
+
+    if (hit) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        ++metrics_.hits_;
+    } else {
+        ++metrics_.misses_;
+    }
+
+    const auto lookups = metrics_.hits_ + metrics_.misses_;
+
+    if (0 == (lookups % LEDGER_CACHE_REPORT_LOOKUPS)) {
+        auto metrics = metrics_;
+        metrics.entries_ = lru_.size();
+        lock.unlock();
+        report(metrics);
+    }
+
+    return hit;
+}
+
+void LedgerCache::evict(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto limit =
+        static_cast<std::size_t>(ServerSettings::GetLedgerCacheBytes());
+
+    while ((metrics_.bytes_ > limit) && (false == lru_.empty())) {
+        const auto& entry = lru_.back();
+        metrics_.bytes_ -= entry.bytes_;
+        index_.erase(entry.key_);
+        lru_.pop_back();
+        ++metrics_.evictions_;
+    }
+}
+
+LedgerCache::Metrics LedgerCache::GetMetrics() const
+{
+    Lock lock(lock_);
+    auto output = metrics_;
+    output.entries_ = lru_.size();
+
+    return output;
+}
+
+LedgerCache::Key LedgerCache::key(const Ledger& box)
+{
+    return {Identifier::Factory(box.GetPurportedAccountID()), box.GetType()};
+}
+
+std::unique_ptr<Ledger> LedgerCache::LoadInbox(const Account& account)
+{
+    auto box{server_.API().Factory().Ledger(
+        account.GetNymID(),
+        account.GetRealAccountID(),
+        account.GetRealNotaryID())};
+
+    OT_ASSERT(false != bool(box));
+
+    if (box->LoadInbox() && VerifyAccount(*box, server_.GetServerNym())) {
+        return box;
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Unable to load or verify inbox ")(
+        account.GetRealAccountID())
+        .Flush();
+
+    return {};
+}
+
+std::unique_ptr<Ledger> LedgerCache::LoadOutbox(const Account& account)
+{
+    auto box{server_.API().Factory().Ledger(
+        account.GetNymID(),
+        account.GetRealAccountID(),
+        account.GetRealNotaryID())};
+
+    OT_ASSERT(false != bool(box));
+
+    if (box->LoadOutbox() && VerifyAccount(*box, server_.GetServerNym())) {
+        return box;
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Unable to load or verify outbox ")(
+        account.GetRealAccountID())
+        .Flush();
+
+    return {};
+}
+
+void LedgerCache::remember(
+    const Ledger& box,
+    const Identifier& signer,
+    const Identifier& hash)
+{
+    if (hash.empty()) { return; }
+
+    auto boxKey = key(box);
+    const std::size_t bytes = LEDGER_CACHE_ENTRY_OVERHEAD +
+                              boxKey.first->size() + hash.size() +
+                              signer.size();
+    Lock lock(lock_);
+    auto it = index_.find(boxKey);
+
+    if (index_.end() != it) {
+        auto& entry = *it->second;
+        metrics_.bytes_ -= entry.bytes_;
+        entry.hash_ = Identifier::Factory(hash);
+        entry.signer_ = Identifier::Factory(signer);
+        entry.bytes_ = bytes;
+        lru_.splice(lru_.begin(), lru_, it->second);
+    } else {
+        lru_.push_front(Entry{boxKey,
+                              Identifier::Factory(hash),
+                              Identifier::Factory(signer),
+                              bytes});
+        index_.emplace(std::move(boxKey), lru_.begin());
+    }
+
+    metrics_.bytes_ += bytes;
+    evict(lock);
+}
+
+void LedgerCache::report(const Metrics& metrics)
+{
+    const auto lookups = metrics.hits_ + metrics.misses_;
+    const auto rate = (0 == lookups) ? 0 : (100 * metrics.hits_) / lookups;
+
+    LogNormal(OT_METHOD)(__FUNCTION__)(": ")(metrics.hits_)(" hits, ")(
+        metrics.misses_)(" misses (")(rate)("% hit rate), ")(
+        metrics.entries_)(" entries, ")(metrics.bytes_)(" of ")(
+        ServerSettings::GetLedgerCacheBytes())(" bytes, ")(
+        metrics.evictions_)(" evictions.")
+        .Flush();
+}
+
+void LedgerCache::saved(
+    const bool success,
+    const Ledger& box,
+    const Identifier& hash)
+{
+    if (success) { remember(box, server_.GetServerNym().ID(), hash); }
+}
+
+bool LedgerCache::SaveInbox(Account& account, Ledger& inbox)
+{
+    auto hash = Identifier::Factory();
+    const bool output = account.SaveInbox(inbox, hash);
+    saved(output, inbox, hash);
+
+    return output;
+}
+
+bool LedgerCache::SaveInbox(Ledger& inbox)
+{
+    auto hash = Identifier::Factory();
+
+    return SaveInbox(inbox, hash);
+}
+
+bool LedgerCache::SaveInbox(Ledger& inbox, Identifier& hash)
+{
+    const bool output = inbox.SaveInbox(hash);
+    saved(output, inbox, hash);
+
+    return output;
+}
+
+bool LedgerCache::SaveNymbox(Ledger& nymbox)
+{
+    auto hash = Identifier::Factory();
+
+    return SaveNymbox(nymbox, hash);
+}
+
+bool LedgerCache::SaveNymbox(Ledger& nymbox, Identifier& hash)
+{
+    const bool output = nymbox.SaveNymbox(hash);
+    saved(output, nymbox, hash);
+
+    return output;
+}
+
+bool LedgerCache::SaveOutbox(Account& account, Ledger& outbox)
+{
+    auto hash = Identifier::Factory();
+    const bool output = account.SaveOutbox(outbox, hash);
+    saved(output, outbox, hash);
+
+    return output;
+}
+
+bool LedgerCache::SaveOutbox(Ledger& outbox)
+{
+    auto hash = Identifier::Factory();
+
+    return SaveOutbox(outbox, hash);
+}
+
+bool LedgerCache::SaveOutbox(Ledger& outbox, Identifier& hash)
+{
+    const bool output = outbox.SaveOutbox(hash);
+    saved(output, outbox, hash);
+
+    return output;
+}
+
+bool LedgerCache::VerifyAccount(Ledger& box, const Nym& signer)
+{
+    auto hash = Identifier::Factory();
+    box.CalculateHash(hash);
+
+    if (false == check(box, signer, hash)) {
+        if (false == box.VerifyAccount(signer)) { return false; }
+
+        remember(box, signer.ID(), hash);
+
+        return true;
+    }
+
+    // Everything Ledger::VerifyAccount does, except the signature.
+    std::set<std::int64_t> unloaded{};
+    box.LoadBoxReceipts(&unloaded);
+
+    return box.VerifyContractID();
+}
+
+bool LedgerCache::VerifySignature(Ledger& box, const Nym& signer)
+{
+    auto hash = Identifier::Factory();
+    box.CalculateHash(hash);
+
+    if (check(box, signer, hash)) { return true; }
+
+    if (false == box.VerifySignature(signer)) { return false; }
+
+    remember(box, signer.ID(), hash);
+
+    return true;
+}
+}  // namespace opentxs::server
@@ -0,0 +1,108 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Identifier.hpp"
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace opentxs
+{
+namespace server
+{
+// Remembers which versions of each nymbox, inbox and outbox the notary has
+// already verified (or signed itself), so that loading a box whose contents
+// hash matches a remembered version skips signature verification.
+//
+// Entries are keyed by (nym or account ID, box type) and hold the hash of
+// the most recent verified contents, so a box which was modified by any
+// other path simply misses and is verified as before. Saves made through
+// this class are written through, which means the notary never re-verifies
+// a box it has just signed. Least recently used entries are evicted once
+// the memory budget (ServerSettings::GetLedgerCacheBytes) is exceeded.
+//
+// The hit rate and the bytes held are logged periodically, and are available
+// from api::server::Manager::Server().Ledgers().GetMetrics().
+class LedgerCache
+{
+public:
+    struct Metrics {
+        std::uint64_t hits_{0};
+        std::uint64_t misses_{0};
+        std::uint64_t evictions_{0};
+        std::size_t entries_{0};
+        std::size_t bytes_{0};
+    };
+
+    Metrics GetMetrics() const;
+
+    // Same as Account::LoadInbox / LoadOutbox with the server nym.
+    std::unique_ptr<Ledger> LoadInbox(const Account& account);
+    std::unique_ptr<Ledger> LoadOutbox(const Account& account);
+
+    // The box must have just been signed by the server nym.
+    bool SaveInbox(Account& account, Ledger& inbox);
+    bool SaveInbox(Ledger& inbox);
+    bool SaveInbox(Ledger& inbox, Identifier& hash);
+    bool SaveNymbox(Ledger& nymbox);
+    bool SaveNymbox(Ledger& nymbox, Identifier& hash);
+    bool SaveOutbox(Account& account, Ledger& outbox);
+    bool SaveOutbox(Ledger& outbox);
+    bool SaveOutbox(Ledger& outbox, Identifier& hash);
+
+    // Drop-in replacements for Ledger::VerifyAccount and
+    // Ledger::VerifySignature on a loaded box.
+    bool VerifyAccount(Ledger& box, const Nym& signer);
+    bool VerifySignature(Ledger& box, const Nym& signer);
+
+    explicit LedgerCache(Server& server);
+
+    ~LedgerCache() = default;
+
+private:
+    using Key = std::pair<OTIdentifier, ledgerType>;
+
+    struct Entry {
+        Key key_;
+        OTIdentifier hash_;
+        OTIdentifier signer_;
+        std::size_t bytes_;
+    };
+
+    using LRU = std::list<Entry>;
+
+    Server& server_;
+    mutable std::mutex lock_;
+    LRU lru_;
+    std::map<Key, LRU::iterator> index_;
+    Metrics metrics_;
+
+    static Key key(const Ledger& box);
+    static void report(const Metrics& metrics);
+
+    bool check(const Ledger& box, const Nym& signer, const Identifier& hash);
+    void evict(const Lock& lock);
+    void remember(
+        const Ledger& box,
+        const Identifier& signer,
+        const Identifier& hash);
+    void saved(const bool success, const Ledger& box, const Identifier& hash);
+
+    LedgerCache() = delete;
+    LedgerCache(const LedgerCache&) = delete;
+    LedgerCache(LedgerCache&&) = delete;
+    LedgerCache& operator=(const LedgerCache&) = delete;
+    LedgerCache& operator=(LedgerCache&&) = delete;
+};
+}  // namespace server
+}  // namespace opentxs
@@ -12,8 +12,8 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/Wallet.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/util/Assert.hpp"
-#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
@@ -27,28 +27,33 @@
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PullSocket.hpp"
-#include "opentxs/network/zeromq/ReplyCallback.hpp"
-#include "opentxs/network/zeromq/ReplySocket.hpp"
 #include "opentxs/network/zeromq/RouterSocket.hpp"
 #include "opentxs/otx/Reply.hpp"
 #include "opentxs/otx/Request.hpp"
 
+#include "network/WireFormat.hpp"
+
 #include "Server.hpp"
+#include "ServerSettings.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <stddef.h>
 #include <sys/types.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <ostream>
 #include <string>
 
 #define OTX_ZAP_DOMAIN "opentxs-otx"
+#define NOTARY_MIN_WORKERS 2
 
 #define OT_METHOD "opentxs::MessageProcessor::"
 
 namespace zmq = opentxs::network::zeromq;
 
-template class opentxs::Pimpl<zmq::ReplySocket>;
-template class opentxs::Pimpl<zmq::ReplyCallback>;
+using WireFormat = opentxs::network::implementation::WireFormat;
+
 
 namespace opentxs::server
 {
@@ -66,12 +71,13 @@ MessageProcessor::MessageProcessor(
     , frontend_socket_(context.RouterSocket(
           frontend_callback_,
           zmq::Socket::Direction::Bind))
-    , backend_callback_(zmq::ReplyCallback::Factory(
-          [=](const zmq::Message& incoming) -> OTZMQMessage {
-              return this->process_backend(incoming);
+    , backend_callback_(zmq::ListenCallback::Factory(
+          [=](const zmq::Message& incoming) -> void {
+              this->process_backend(incoming);
           }))
-    , backend_socket_(
-          context.ReplySocket(backend_callback_, zmq::Socket::Direction::Bind))
+    , backend_socket_(context.RouterSocket(
+          backend_callback_,
+          zmq::Socket::Direction::Bind))
     , internal_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_internal(incoming);
@@ -87,6 +93,8 @@ MessageProcessor::MessageProcessor(
           notification_callback_,
           zmq::Socket::Direction::Bind))
     , thread_()
+    , lanes_(worker_count())
+    , notary_lock_()
     , internal_endpoint_(
           std::string("inproc://opentxs/notary/") + Identifier::Random()->str())
     , counter_lock_()
@@ -120,6 +128,9 @@ void MessageProcessor::associate_connection(
 
 void MessageProcessor::cleanup()
 {
+    lanes_.Stop();
+    server_.Cron().Wake();
+
     if (thread_.joinable()) { thread_.join(); }
 }
 
@@ -142,6 +153,35 @@ proto::ServerRequest MessageProcessor::extract_proto(
         incoming.data(), incoming.size());
 }
 
+std::unique_ptr<Message> MessageProcessor::extract_request(
+    const std::string& messageString) const
+{
+    if (messageString.size() < 1) { return {}; }
+
+    auto serialized = String::Factory();
+    WireFormat::Decode(messageString, serialized);
+
+    if (false == serialized->Exists()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Empty serialized request."
+              << std::endl;
+
+        return {};
+    }
+
+    auto request{server_.API().Factory().Message()};
+
+    OT_ASSERT(false != bool(request));
+
+    if (false == request->LoadContractFromString(serialized)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to deserialized request." << std::endl;
+
+        return {};
+    }
+
+    return request;
+}
+
 OTData MessageProcessor::get_connection(
     const network::zeromq::Message& incoming)
 {
@@ -196,38 +236,40 @@ void MessageProcessor::init(
 void MessageProcessor::run()
 {
     while (running_) {
-        // timeout is the time left until the next cron should execute.
+        // timeout is the time left until the next cron item is due.
         const auto timeout = server_.ComputeTimeout();
 
         if (timeout <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // Cron items touch arbitrary nyms, accounts and markets
+            eLock lock(notary_lock_);
             server_.ProcessCron();
         }
 
-        Log::Sleep(std::chrono::milliseconds(50));
+        // Returns early if an item is added or flagged for removal
+        server_.Cron().WaitForNextDeadline();
     }
 }
 
-OTZMQMessage MessageProcessor::process_backend(const zmq::Message& incoming)
+void MessageProcessor::process_backend(const zmq::Message& incoming)
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
-    std::string reply{};
-
     std::string messageString{};
+
     if (0 < incoming.Body().size()) {
         messageString = *incoming.Body().begin();
     }
 
-    bool error = process_message(messageString, reply);
-
-    if (error) { reply = ""; }
-
-    auto output = zmq::Message::ReplyFactory(incoming);
-    output->AddFrame(reply);
-
-    return output;
+    // Replies use the framing of the request, so clients which predate
+    // binary framing keep receiving armored replies
+    const bool binary = WireFormat::IsBinary(messageString);
+    // Requests are decoded here, in the order they arrived, because the
+    // requesting nym decides which worker runs them
+    std::shared_ptr<const Message> request{extract_request(messageString)};
+    const auto nymID = bool(request) ? Identifier::Factory(request->m_strNymID)
+                                     : Identifier::Factory();
+    OTZMQMessage message{incoming};
+    lanes_.Push(nymID, [this, message, binary, request]() -> void {
+        process_request(message, binary, request);
+    });
 }
 
 bool MessageProcessor::process_command(
@@ -317,46 +359,38 @@ void MessageProcessor::process_legacy(
 }
 
 bool MessageProcessor::process_message(
-    const std::string& messageString,
+    const Message& request,
+    const bool binary,
     std::string& reply)
 {
-    if (messageString.size() < 1) { return true; }
-
-    auto armored = Armored::Factory();
-    armored->MemSet(messageString.data(), messageString.size());
-    auto serialized = String::Factory();
-    armored->GetString(serialized);
-    auto request{server_.API().Factory().Message()};
+    auto replymsg{server_.API().Factory().Message()};
 
-    if (false == serialized->Exists()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Empty serialized request."
-              << std::endl;
+    OT_ASSERT(false != bool(replymsg));
 
-        return true;
-    }
+    // Requests from the same nym run in order on one worker. Requests from
+    // different nyms only run concurrently if the command is limited to the
+    // state of the requesting nym.
+    const auto type = Message::Type(request.m_strCommand->Get());
+    sLock sharedLock(notary_lock_, std::defer_lock);
+    eLock exclusiveLock(notary_lock_, std::defer_lock);
 
-    if (false == request->LoadContractFromString(serialized)) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Failed to deserialized request." << std::endl;
-
-        return true;
+    if (UserCommandProcessor::RequiresExclusiveLock(type)) {
+        exclusiveLock.lock();
+    } else {
+        sharedLock.lock();
     }
 
-    auto replymsg{server_.API().Factory().Message()};
-
-    OT_ASSERT(false != bool(replymsg));
-
     const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+        server_.CommandProcessor().ProcessUserCommand(request, *replymsg);
 
     if (false == processed) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": Failed to process user command ")(
-            request->m_strCommand)
+            request.m_strCommand)
             .Flush();
-        LogVerbose(OT_METHOD)(__FUNCTION__)(String::Factory(*request)).Flush();
+        LogVerbose(OT_METHOD)(__FUNCTION__)(String::Factory(request)).Flush();
     } else {
         LogDetail(OT_METHOD)(__FUNCTION__)(
-            ": Successfully processed user command ")(request->m_strCommand)
+            ": Successfully processed user command ")(request.m_strCommand)
             .Flush();
     }
 
@@ -369,17 +403,22 @@ bool MessageProcessor::process_message(
         return true;
     }
 
-    auto armoredReply = Armored::Factory(serializedReply);
+    bool encoded{false};
 
-    if (false == armoredReply->Exists()) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to armor reply."
+    if (binary) {
+        encoded = WireFormat::EncodeBinary(
+            serializedReply, ServerSettings::GetWireCompression(), reply);
+    } else {
+        encoded = WireFormat::EncodeArmored(serializedReply, reply);
+    }
+
+    if (false == encoded) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to encode reply."
               << std::endl;
 
         return true;
     }
 
-    reply.assign(armoredReply->Get(), armoredReply->GetLength());
-
     return false;
 }
 
@@ -459,6 +498,32 @@ void MessageProcessor::process_proto(
     }
 }
 
+void MessageProcessor::process_request(
+    const zmq::Message& incoming,
+    const bool binary,
+    const std::shared_ptr<const Message>& request)
+{
+    std::string reply{};
+    bool error{true};
+
+    if (request) { error = process_message(*request, binary, reply); }
+
+    if (error) {
+        // A binary reply tells the client that the notary understood the
+        // framing even though the request failed
+        reply = binary ? WireFormat::Rejected() : "";
+    }
+
+    // The reply keeps the envelope of the request, which identifies rejected
+    // requests to asynchronous clients
+    auto output = zmq::Message::ReplyFactory(incoming);
+    output->AddFrame(reply);
+
+    if (false == backend_socket_->Send(output)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to queue reply.").Flush();
+    }
+}
+
 OTData MessageProcessor::query_connection(const Identifier& nymID)
 {
     sLock lock(connection_map_lock_);
@@ -471,8 +536,15 @@ OTData MessageProcessor::query_connection(const Identifier& nymID)
 
 void MessageProcessor::Start()
 {
+    lanes_.Start();
     thread_ = std::thread(&MessageProcessor::run, this);
 }
 
+std::size_t MessageProcessor::worker_count()
+{
+    return std::max<std::size_t>(
+        NOTARY_MIN_WORKERS, std::thread::hardware_concurrency());
+}
+
 MessageProcessor::~MessageProcessor() { cleanup(); }
 }  // namespace opentxs::server
@@ -7,19 +7,22 @@
 
 #include "Internal.hpp"
 
-#include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/network/zeromq/Socket.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "Lanes.hpp"
+
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <thread>
 
 namespace opentxs::server
 {
-class MessageProcessor : Lockable
+class MessageProcessor
 {
 public:
     void DropIncoming(const int count) const;
@@ -42,13 +45,18 @@ private:
     [[maybe_unused]] const network::zeromq::Context& context_;
     OTZMQListenCallback frontend_callback_;
     OTZMQRouterSocket frontend_socket_;
-    OTZMQReplyCallback backend_callback_;
-    OTZMQReplySocket backend_socket_;
+    OTZMQListenCallback backend_callback_;
+    OTZMQRouterSocket backend_socket_;
     OTZMQListenCallback internal_callback_;
     OTZMQDealerSocket internal_socket_;
     OTZMQListenCallback notification_callback_;
     OTZMQPullSocket notification_socket_;
     std::thread thread_;
+    // Requests are routed by the nym they claim, which runs them in order
+    Lanes lanes_;
+    // Shared by commands which can run concurrently, exclusive for everything
+    // else including cron
+    std::shared_mutex notary_lock_;
     const std::string internal_endpoint_;
     mutable std::mutex counter_lock_;
     mutable int drop_incoming_{0};
@@ -58,12 +66,15 @@ private:
     mutable std::shared_mutex connection_map_lock_;
 
     static OTData get_connection(const network::zeromq::Message& incoming);
+    static std::size_t worker_count();
 
     proto::ServerRequest extract_proto(
         const network::zeromq::Frame& incoming) const;
+    std::unique_ptr<Message> extract_request(
+        const std::string& messageString) const;
 
     void associate_connection(const Identifier& nymID, const Data& connection);
-    OTZMQMessage process_backend(const network::zeromq::Message& incoming);
+    void process_backend(const network::zeromq::Message& incoming);
     bool process_command(
         const proto::ServerRequest& request,
         Identifier& nymID);
@@ -72,11 +83,18 @@ private:
     void process_legacy(
         const Data& id,
         const network::zeromq::Message& incoming);
-    bool process_message(const std::string& messageString, std::string& reply);
+    bool process_message(
+        const Message& request,
+        const bool binary,
+        std::string& reply);
     void process_notification(const network::zeromq::Message& incoming);
     void process_proto(
         const Data& id,
         const network::zeromq::Message& incoming);
+    void process_request(
+        const network::zeromq::Message& incoming,
+        const bool binary,
+        const std::shared_ptr<const Message>& request);
     OTData query_connection(const Identifier& nymID);
     void run();
 
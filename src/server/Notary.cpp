@@ -200,7 +200,7 @@ void Notary::cancel_cheque(
     inbox.ReleaseSignatures();
     inbox.SignContract(server_.GetServerNym());
     inbox.SaveContract();
-    account.SaveInbox(inbox, Identifier::Factory());
+    server_.Ledgers().SaveInbox(account, inbox);
     inboxTransaction->SaveBoxReceipt(inbox);
     responseItem.SetStatus(Item::acknowledgement);
     success = true;
@@ -301,7 +301,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderInbox->VerifyAccount(server_.GetServerNym())) {
+            if (false == server_.Ledgers().VerifyAccount(
+                    *senderInbox, server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender inbox")
                     .Flush();
@@ -331,7 +332,8 @@ void Notary::deposit_cheque(
                 return;
             }
 
-            if (false == senderOutbox->VerifyAccount(server_.GetServerNym())) {
+            if (false == server_.Ledgers().VerifyAccount(
+                    *senderOutbox, server_.GetServerNym())) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to verify sender outbox")
                     .Flush();
@@ -571,7 +573,7 @@ void Notary::deposit_cheque(
     senderInbox.ReleaseSignatures();
     senderInbox.SignContract(server_.GetServerNym());
     senderInbox.SaveContract();
-    senderAccount.SaveInbox(senderInbox, Identifier::Factory());
+    server_.Ledgers().SaveInbox(senderAccount, senderInbox);
     inboxItem->SaveBoxReceipt(senderInbox);
     responseItem.SetStatus(Item::acknowledgement);
     success = true;
@@ -846,7 +848,8 @@ void Notary::NotarizeTransfer(
 
                 if (bSuccessLoadingInbox) {
                     bSuccessLoadingInbox &=
-                        recipientOutbox->VerifyAccount(server_.GetServerNym());
+                        server_.Ledgers().VerifyAccount(
+                            *recipientOutbox, server_.GetServerNym());
                 }
             }
 
@@ -877,7 +880,8 @@ void Notary::NotarizeTransfer(
 
             if (true == bSuccessLoadingInbox) {
                 bSuccessLoadingInbox =
-                    recipientInbox->VerifyAccount(server_.GetServerNym());
+                    server_.Ledgers().VerifyAccount(
+                        *recipientInbox, server_.GetServerNym());
             } else {
                 otErr
                     << "Notary::NotarizeTransfer: Error loading 'to' inbox.\n";
@@ -885,16 +889,17 @@ void Notary::NotarizeTransfer(
 
             if (true == bSuccessLoadingOutbox) {
                 bSuccessLoadingOutbox =
-                    theFromOutbox->VerifyAccount(server_.GetServerNym());
+                    server_.Ledgers().VerifyAccount(
+                        *theFromOutbox, server_.GetServerNym());
             } else {
                 otErr << "Notary::NotarizeTransfer: Error loading 'from' "
                          "outbox.\n";
             }
 
             std::unique_ptr<Ledger> pInbox(
-                theFromAccount.get().LoadInbox(server_.GetServerNym()));
+                server_.Ledgers().LoadInbox(theFromAccount.get()));
             std::unique_ptr<Ledger> pOutbox(
-                theFromAccount.get().LoadOutbox(server_.GetServerNym()));
+                server_.Ledgers().LoadOutbox(theFromAccount.get()));
 
             if (nullptr == pInbox) {
                 otErr << "Error loading or verifying inbox.\n";
@@ -1082,10 +1087,10 @@ void Notary::NotarizeTransfer(
                         recipientInbox->SaveContract();
 
                         // Save their internals (signatures and all) to file.
-                        theFromAccount.get().SaveOutbox(
-                            *theFromOutbox, Identifier::Factory());
-                        destinationAccount.get().SaveInbox(
-                            *recipientInbox, Identifier::Factory());
+                        server_.Ledgers().SaveOutbox(
+                            theFromAccount.get(), *theFromOutbox);
+                        server_.Ledgers().SaveInbox(
+                            destinationAccount.get(), *recipientInbox);
 
                         theFromAccount.Release();
                         destinationAccount.Release();
@@ -1331,9 +1336,9 @@ void Notary::NotarizeWithdrawal(
         // definition
         ExclusiveAccount voucherReserveAccount;
         std::unique_ptr<Ledger> pInbox(
-            theAccount.get().LoadInbox(server_.GetServerNym()));
+            server_.Ledgers().LoadInbox(theAccount.get()));
         std::unique_ptr<Ledger> pOutbox(
-            theAccount.get().LoadOutbox(server_.GetServerNym()));
+            server_.Ledgers().LoadOutbox(theAccount.get()));
 
         // I'm using the operator== because it exists.
         // If the ID on the "from" account that was passed in,
@@ -1583,9 +1588,9 @@ void Notary::NotarizeWithdrawal(
                                           // to
                                           // pItem and its Owner Transaction.
         std::unique_ptr<Ledger> pInbox(
-            theAccount.get().LoadInbox(server_.GetServerNym()));
+            server_.Ledgers().LoadInbox(theAccount.get()));
         std::unique_ptr<Ledger> pOutbox(
-            theAccount.get().LoadOutbox(server_.GetServerNym()));
+            server_.Ledgers().LoadOutbox(theAccount.get()));
 
         std::shared_ptr<Mint> pMint{nullptr};
         ExclusiveAccount pMintCashReserveAcct{};
@@ -2298,9 +2303,9 @@ void Notary::NotarizePayDividend(
                 // for any failures, so he can have a record of them, and so he
                 // can recover the funds.
                 std::unique_ptr<Ledger> pInbox(
-                    theSourceAccount.get().LoadInbox(server_.GetServerNym()));
+                    server_.Ledgers().LoadInbox(theSourceAccount.get()));
                 std::unique_ptr<Ledger> pOutbox(
-                    theSourceAccount.get().LoadOutbox(server_.GetServerNym()));
+                    server_.Ledgers().LoadOutbox(theSourceAccount.get()));
                 // contains the server's funds to back vouchers of a specific
                 // instrument definition.
                 ExclusiveAccount voucherReserveAccount;
@@ -4622,9 +4627,9 @@ void Notary::NotarizeExchangeBasket(
     const auto strNymID = String::Factory(NYM_ID);
 
     std::unique_ptr<Ledger> pInbox(
-        theAccount.get().LoadInbox(server_.GetServerNym()));
+        server_.Ledgers().LoadInbox(theAccount.get()));
     std::unique_ptr<Ledger> pOutbox(
-        theAccount.get().LoadOutbox(server_.GetServerNym()));
+        server_.Ledgers().LoadOutbox(theAccount.get()));
 
     pResponseItem.reset(
         manager_.Factory()
@@ -4912,8 +4917,8 @@ void Notary::NotarizeExchangeBasket(
                                     // account, so we can drop the receipt.
                                     //
                                     auto pSubInbox =
-                                        tempUserAccount.get().LoadInbox(
-                                            server_.GetServerNym());
+                                        server_.Ledgers().LoadInbox(
+                                            tempUserAccount.get());
 
                                     if (false == bool(pSubInbox)) {
                                         otErr << "Error loading or "
@@ -5431,8 +5436,7 @@ void Notary::NotarizeExchangeBasket(
                                     pTempInbox->SignContract(
                                         server_.GetServerNym());
                                     pTempInbox->SaveContract();
-                                    pTempInbox->SaveInbox(
-                                        Identifier::Factory());
+                                    server_.Ledgers().SaveInbox(*pTempInbox);
                                 }
 
                                 delete pTempInbox;
@@ -5442,8 +5446,8 @@ void Notary::NotarizeExchangeBasket(
                                 pInbox->ReleaseSignatures();
                                 pInbox->SignContract(server_.GetServerNym());
                                 pInbox->SaveContract();
-                                theAccount.get().SaveInbox(
-                                    *pInbox, Identifier::Factory());
+                                server_.Ledgers().SaveInbox(
+                                    theAccount.get(), *pInbox);
                                 theAccount.Release();
                                 basketAccount.Release();
 
@@ -6328,7 +6332,7 @@ void Notary::NotarizeProcessNymbox(
 
     if (true == bSuccessLoadingNymbox) {
         bSuccessLoadingNymbox =
-            theNymbox->VerifyAccount(server_.GetServerNym());
+            server_.Ledgers().VerifyAccount(*theNymbox, server_.GetServerNym());
     }
 
     pResponseBalanceItem.reset(manager_.Factory()
@@ -6661,7 +6665,7 @@ void Notary::NotarizeProcessNymbox(
                             theNymbox->ReleaseSignatures();
                             theNymbox->SignContract(server_.GetServerNym());
                             theNymbox->SaveContract();
-                            theNymbox->SaveNymbox(Identifier::Factory());
+                            server_.Ledgers().SaveNymbox(*theNymbox);
 
                             // Now we can set the response item as an
                             // acknowledgement instead of the default
@@ -6697,7 +6701,7 @@ void Notary::NotarizeProcessNymbox(
                             theNymbox->ReleaseSignatures();
                             theNymbox->SignContract(server_.GetServerNym());
                             theNymbox->SaveContract();
-                            theNymbox->SaveNymbox(Identifier::Factory());
+                            server_.Ledgers().SaveNymbox(*theNymbox);
 
                             // Now we can set the response item as an
                             // acknowledgement instead of the default
@@ -6819,7 +6823,8 @@ void Notary::NotarizeProcessNymbox(
                             theNymbox->ReleaseSignatures();
                             theNymbox->SignContract(server_.GetServerNym());
                             theNymbox->SaveContract();
-                            theNymbox->SaveNymbox(NYMBOX_HASH);
+                            server_.Ledgers().SaveNymbox(
+                                *theNymbox, NYMBOX_HASH);
 
                             bNymboxHashRegenerated = true;
 
@@ -6854,7 +6859,8 @@ void Notary::NotarizeProcessNymbox(
                             theNymbox->ReleaseSignatures();
                             theNymbox->SignContract(server_.GetServerNym());
                             theNymbox->SaveContract();
-                            theNymbox->SaveNymbox(NYMBOX_HASH);
+                            server_.Ledgers().SaveNymbox(
+                                *theNymbox, NYMBOX_HASH);
 
                             bNymboxHashRegenerated = true;
 
@@ -6977,9 +6983,9 @@ void Notary::NotarizeProcessInbox(
     const std::string strNymID(String::Factory(NYM_ID)->Get());
     std::set<TransactionNumber> closedNumbers, closedCron;
     std::unique_ptr<Ledger> pInbox(
-        theAccount.get().LoadInbox(server_.GetServerNym()));
+        server_.Ledgers().LoadInbox(theAccount.get()));
     std::unique_ptr<Ledger> pOutbox(
-        theAccount.get().LoadOutbox(server_.GetServerNym()));
+        server_.Ledgers().LoadOutbox(theAccount.get()));
     pResponseBalanceItem.reset(manager_.Factory()
                                    .Item(
                                        processInboxResponse,
@@ -7642,7 +7648,8 @@ void Notary::NotarizeProcessInbox(
 
         if (!theInbox->LoadInbox()) {
             otErr << "Error loading inbox during processInbox\n";
-        } else if (false == theInbox->VerifyAccount(server_.GetServerNym())) {
+        } else if (false == server_.Ledgers().VerifyAccount(
+                *theInbox, server_.GetServerNym())) {
             otErr << "Error verifying inbox during processInbox\n";
         }
         //
@@ -7681,7 +7688,7 @@ void Notary::NotarizeProcessInbox(
             theInbox->ReleaseSignatures();
             theInbox->SignContract(server_.GetServerNym());
             theInbox->SaveContract();
-            theAccount.get().SaveInbox(*theInbox, Identifier::Factory());
+            server_.Ledgers().SaveInbox(theAccount.get(), *theInbox);
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -7711,7 +7718,7 @@ void Notary::NotarizeProcessInbox(
             theInbox->ReleaseSignatures();
             theInbox->SignContract(server_.GetServerNym());
             theInbox->SaveContract();
-            theAccount.get().SaveInbox(*theInbox, Identifier::Factory());
+            server_.Ledgers().SaveInbox(theAccount.get(), *theInbox);
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -7741,7 +7748,7 @@ void Notary::NotarizeProcessInbox(
             theInbox->ReleaseSignatures();
             theInbox->SignContract(server_.GetServerNym());
             theInbox->SaveContract();
-            theAccount.get().SaveInbox(*theInbox, Identifier::Factory());
+            server_.Ledgers().SaveInbox(theAccount.get(), *theInbox);
 
             // Now we can set the response item as an
             // acknowledgement instead of the default
@@ -7908,8 +7915,7 @@ void Notary::NotarizeProcessInbox(
                     theInbox->ReleaseSignatures();
                     theInbox->SignContract(server_.GetServerNym());
                     theInbox->SaveContract();
-                    theAccount.get().SaveInbox(
-                        *theInbox, Identifier::Factory());
+                    server_.Ledgers().SaveInbox(theAccount.get(), *theInbox);
 
                     // Now we can set the response item as an
                     // acknowledgement instead of the default
@@ -7982,7 +7988,8 @@ void Notary::NotarizeProcessInbox(
 
                     if (true == bSuccessLoadingInbox)
                         bSuccessLoadingInbox =
-                            theFromInbox->VerifyAccount(server_.GetServerNym());
+                            server_.Ledgers().VerifyAccount(
+                                *theFromInbox, server_.GetServerNym());
                     else
                         otErr << "ERROR missing 'from' "
                                  "inbox in "
@@ -7993,8 +8000,8 @@ void Notary::NotarizeProcessInbox(
                     // exist.
 
                     if (true == bSuccessLoadingOutbox)
-                        bSuccessLoadingOutbox = theFromOutbox->VerifyAccount(
-                            server_.GetServerNym());
+                        bSuccessLoadingOutbox = server_.Ledgers().VerifyAccount(
+                            *theFromOutbox, server_.GetServerNym());
                     else  // If it does not already exist, that
                         // is an error condition. For now, log
                         // and fail.
@@ -8156,8 +8163,8 @@ void Notary::NotarizeProcessInbox(
                             theFromInbox->SaveContract();
                             theFromOutbox->SaveContract();
 
-                            theFromInbox->SaveInbox(Identifier::Factory());
-                            theFromOutbox->SaveOutbox(Identifier::Factory());
+                            server_.Ledgers().SaveInbox(*theFromInbox);
+                            server_.Ledgers().SaveOutbox(*theFromOutbox);
 
                             // Release any signatures that were
                             // there before (Old ones won't
@@ -8166,8 +8173,8 @@ void Notary::NotarizeProcessInbox(
                             theInbox->ReleaseSignatures();
                             theInbox->SignContract(server_.GetServerNym());
                             theInbox->SaveContract();
-                            theAccount.get().SaveInbox(
-                                *theInbox, Identifier::Factory());
+                            server_.Ledgers().SaveInbox(
+                                theAccount.get(), *theInbox);
 
                             // Now we can set the response item
                             // as an acknowledgement instead of
@@ -8360,9 +8367,9 @@ void Notary::process_cash_deposit(
             "'from' account ID on the deposit item.\n");
     } else {
         std::unique_ptr<Ledger> pInbox(
-            depositorAccount.get().LoadInbox(server_.GetServerNym()));
+            server_.Ledgers().LoadInbox(depositorAccount.get()));
         std::unique_ptr<Ledger> pOutbox(
-            depositorAccount.get().LoadOutbox(server_.GetServerNym()));
+            server_.Ledgers().LoadOutbox(depositorAccount.get()));
 
         if (nullptr == pInbox) {
             otErr << "Notary::NotarizeDeposit: Error loading or "
@@ -8411,6 +8418,7 @@ void Notary::process_cash_deposit(
                                          // successful.
 
             bool bSuccess = false;
+            SpentTokens::Batch spent{};
 
             // Pull the token(s) out of the purse that was received from the
             // client.
@@ -8492,26 +8500,15 @@ void Notary::process_cash_deposit(
                             "verification failed. \n");
                         break;
                     }
-                    // Lookup the token in the SPENT TOKEN DATABASE, and
-                    // make sure
-                    // that it hasn't already been spent...
-                    else if (pToken->IsTokenAlreadySpent(strSpendableToken)) {
-                        // TODO!!!! Need to store the spent token database
-                        // in multiple places, on multiple media!
-                        //          Furthermore need to CHECK those multiple
-                        // places inside IsTokenAlreadySpent.
-                        //          In fact, that should all be configurable
-                        // in the server config file!
-                        //          Related: make sure IsTokenAlreadySpent
-                        // differentiates between ACTUALLY not finding
-                        //          a token as spent (successfully), versus
-                        // some error state with the storage.
+                    // VerifyToken does not check the date, and the spent
+                    // token store forgets a series once its tokens expire
+                    else if (OTTimeGetCurrentTime() > pMint->GetValidTo()) {
                         bSuccess = false;
                         Log::vOutput(
                             0,
                             "Notary::NotarizeDeposit: "
                             "ERROR verifying token: Token "
-                            "was already spent. \n");
+                            "has expired. \n");
                         break;
                     } else {
                         LogDebug(OT_METHOD)(__FUNCTION__)(
@@ -8552,35 +8549,15 @@ void Notary::process_cash_deposit(
                                          "while depositing cash.\n";
                             bSuccess = false;
                             break;
-                        }
-                        // Spent token database. This is where the call is
-                        // made to add
-                        // the token to the spent token database.
-                        else if (
-                            false ==
-                            pToken->RecordTokenAsSpent(strSpendableToken)) {
-                            otErr << "Notary::NotarizeDeposit: "
-                                     "Failed recording token as "
-                                     "spent...\n";
-
-                            if (false == pMintCashReserveAcct.get().Credit(
-                                             pToken->GetDenomination()))
-                                otErr << "Notary::NotarizeDeposit: "
-                                         "Failure crediting-back "
-                                         "mint's cash reserve account "
-                                         "while depositing cash.\n";
-
-                            if (false == depositorAccount.get().Debit(
-                                             pToken->GetDenomination()))
-                                otErr << "Notary::NotarizeDeposit: "
-                                         "Failure debiting-back user's "
-                                         "asset account while "
-                                         "depositing cash.\n";
-
-                            bSuccess = false;
-                            break;
                         } else  // SUCCESS!!! (this iteration)
                         {
+                            auto hash = Identifier::Factory();
+                            hash->CalculateDigest(strSpendableToken);
+                            spent.push_back(
+                                {Identifier::Factory(INSTRUMENT_DEFINITION_ID),
+                                 pToken->GetSeries(),
+                                 pMint->GetValidTo(),
+                                 hash});
                             Log::vOutput(
                                 2,
                                 "Notary::NotarizeDeposit: "
@@ -8600,6 +8577,15 @@ void Notary::process_cash_deposit(
                 }
             }  // while success popping token from purse
 
+            // The tokens are recorded together, after every one of them has
+            // been verified, so that a failed deposit spends none of them
+            if (bSuccess && (false == server_.Spent().Spend(spent))) {
+                otErr << "Notary::NotarizeDeposit: Failed recording "
+                         "tokens as spent, or a token was already "
+                         "spent.\n";
+                bSuccess = false;
+            }
+
             if (bSuccess) {
                 depositorAccount.Release();
                 // We also need to save the Mint's cash reserve.
@@ -8658,8 +8644,8 @@ void Notary::process_cheque_deposit(
     responseBalanceItem.SetReferenceString(serializedBalanceItem);
     responseBalanceItem.SetReferenceToNum(depositItem.GetTransactionNum());
 
-    auto inbox(depositorAccount.get().LoadInbox(server_.GetServerNym()));
-    auto outbox(depositorAccount.get().LoadOutbox(server_.GetServerNym()));
+    auto inbox(server_.Ledgers().LoadInbox(depositorAccount.get()));
+    auto outbox(server_.Ledgers().LoadOutbox(depositorAccount.get()));
 
     if (false == bool(inbox)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load depositor inbox")
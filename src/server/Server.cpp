@@ -77,8 +77,8 @@ std::int32_t OTCron::__trans_refill_amount = 500;  // The number of transaction
                                                    // itself, when it
 // gets low, before each round.
 std::int32_t OTCron::__cron_ms_between_process =
-    10000;  // The number of milliseconds
-            // (ideally) between each
+    10000;  // The maximum number of
+            // milliseconds between each
             // "Cron Process" event.
 std::int32_t OTCron::__cron_max_items_per_nym =
     10;  // The maximum number of cron
@@ -88,6 +88,8 @@ std::int32_t OTCron::__cron_max_items_per_nym =
 
 Server::Server(const opentxs::api::server::Manager& manager)
     : manager_(manager)
+    , ledgers_(*this)
+    , spent_(*this)
     , mainFile_(*this)
     , notary_(*this, manager_)
     , transactor_(*this)
@@ -501,7 +503,8 @@ void Server::Init(bool readOnly)
         OT_FAIL;
     }
 
-    OTDB::InitDefaultStorage(OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER);
+    OTDB::InitDefaultStorage(
+        OTDB::ConfiguredStorageType(manager_.Config()), OTDB_DEFAULT_PACKER);
 
     // Load up the transaction number and other Server data members.
     bool mainFileExists =
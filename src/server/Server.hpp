@@ -13,9 +13,11 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/network/zeromq/PushSocket.hpp"
 
+#include "LedgerCache.hpp"
 #include "Transactor.hpp"
 #include "Notary.hpp"
 #include "MainFile.hpp"
+#include "SpentTokens.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <cstddef>
@@ -53,6 +55,7 @@ public:
     Notary& GetNotary() { return notary_; }
     Transactor& GetTransactor() { return transactor_; }
     void Init(bool readOnly = false);
+    LedgerCache& Ledgers() { return ledgers_; }
     bool LoadServerNym(const Identifier& nymID);
     void ProcessCron();
     bool SendInstrumentToNym(
@@ -61,6 +64,7 @@ public:
         const Identifier& recipientNymID,
         const OTPayment& payment,
         const char* command);
+    SpentTokens& Spent() { return spent_; }
     String& WalletFilename() { return m_strWalletFilename; }
 
     ~Server();
@@ -78,6 +82,8 @@ private:
     const std::uint32_t MAX_TCP_PORT = 63356;
 
     const opentxs::api::server::Manager& manager_;
+    LedgerCache ledgers_;
+    SpentTokens spent_;
     MainFile mainFile_;
     Notary notary_;
     Transactor transactor_;
@@ -21,6 +21,10 @@ std::int64_t ServerSettings::__min_market_scale = 1;
 std::int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
 std::int32_t ServerSettings::__heartbeat_ms_between_beats = 100;
+// Memory budget for the cache of verified box hashes (see LedgerCache).
+std::int64_t ServerSettings::__ledger_cache_bytes = 16 * 1024 * 1024;
+// zlib level for replies to binary framed requests. 0 disables compression.
+std::int32_t ServerSettings::__wire_compression = 1;
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 std::string ServerSettings::__override_nym_id;
@@ -43,6 +43,20 @@ struct ServerSettings {
         __heartbeat_ms_between_beats = value;
     }
 
+    static std::int64_t GetLedgerCacheBytes() { return __ledger_cache_bytes; }
+
+    static void SetLedgerCacheBytes(std::int64_t value)
+    {
+        __ledger_cache_bytes = value;
+    }
+
+    static std::int32_t GetWireCompression() { return __wire_compression; }
+
+    static void SetWireCompression(std::int32_t value)
+    {
+        __wire_compression = value;
+    }
+
     static const std::string& GetOverrideNymID() { return __override_nym_id; }
 
     static void SetOverrideNymID(const std::string& id)
@@ -55,6 +69,12 @@ struct ServerSettings {
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
 
+    // Memory budget for the cache of verified box hashes.
+    static std::int64_t __ledger_cache_bytes;
+
+    // zlib level for replies to binary framed requests.
+    static std::int32_t __wire_compression;
+
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
     // Are usage credits REQUIRED in order to use this server?
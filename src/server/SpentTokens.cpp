@@ -0,0 +1,834 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "stdafx.hpp"
+
+#include "SpentTokens.hpp"
+
+#include "opentxs/api/Core.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "Server.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#define SPENT_TOKEN_FOLDER "spent_tokens"
+#define SPENT_LOG_SUFFIX ".log"
+#define SPENT_INDEX_SUFFIX ".idx"
+#define SPENT_RETIRED_SUFFIX ".retired"
+#define SPENT_LOG_MAGIC "otspent1"
+#define SPENT_INDEX_MAGIC "otsidx01"
+#define SPENT_MAGIC_SIZE 8
+#define SPENT_HEADER_SIZE 64
+#define SPENT_FLAG_LEGACY 0x1
+// Ten bits and seven probes per token give a false positive rate near 1%
+#define SPENT_BLOOM_BITS_PER_TOKEN 10
+#define SPENT_BLOOM_HASHES 7
+#define SPENT_BLOOM_MIN_BITS 65536
+#define SPENT_INDEX_MIN_SLOTS 4096
+// Log records read per call while rebuilding an index or filter
+#define SPENT_READ_BATCH 4096
+// Seconds past the end of a series' validity before it is retired
+#define SPENT_RETIRE_DELAY 86400
+
+#define OT_METHOD "opentxs::server::SpentTokens::"
+
+namespace
+{
+bool ends_with(const std::string& value, const std::string& suffix)
+{
+    return (value.size() > suffix.size()) &&
+           (0 == value.compare(
+                     value.size() - suffix.size(), suffix.size(), suffix));
+}
+
+bool read_all(
+    const int fd,
+    const std::uint64_t offset,
+    void* data,
+    const std::size_t size)
+{
+    auto* output = static_cast<std::uint8_t*>(data);
+    std::size_t done{0};
+
+    while (done < size) {
+        const auto result = ::pread(
+            fd, output + done, size - done, static_cast<off_t>(offset + done));
+
+        if (0 >= result) { return false; }
+
+        done += static_cast<std::size_t>(result);
+    }
+
+    return true;
+}
+
+bool write_all(
+    const int fd,
+    const std::uint64_t offset,
+    const void* data,
+    const std::size_t size)
+{
+    const auto* input = static_cast<const std::uint8_t*>(data);
+    std::size_t done{0};
+
+    while (done < size) {
+        const auto result = ::pwrite(
+            fd, input + done, size - done, static_cast<off_t>(offset + done));
+
+        if (0 >= result) { return false; }
+
+        done += static_cast<std::size_t>(result);
+    }
+
+    return true;
+}
+}  // namespace
+
+namespace opentxs::server
+{
+SpentTokens::SpentTokens(Server& server)
+    : server_(server)
+    , lock_()
+    , ready_(false)
+    , folder_()
+    , expires_()
+    , retired_()
+    , series_()
+    , next_retirement_(0)
+{
+}
+
+bool SpentTokens::any_spent(
+    const Lock& lock,
+    const Batch& tokens,
+    Group& groups)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    for (const auto& token : tokens) {
+        const auto id = name(token.unit_, token.series_);
+
+        if (0 < retired_.count(id)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Series ")(id)(
+                " has been retired.")
+                .Flush();
+
+            return true;
+        }
+
+        auto* series = load(lock, token);
+
+        if (nullptr == series) { return true; }
+
+        const auto hash = key(token.hash_);
+
+        if (false == groups[id].emplace(hash).second) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Token ")(token.hash_)(
+                " appears more than once.")
+                .Flush();
+
+            return true;
+        }
+
+        if (bloom_check(*series, hash)) {
+            bool found{false};
+
+            if (false == index_find(*series, hash, found)) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to read index for series ")(id)
+                    .Flush();
+
+                return true;
+            }
+
+            if (found) {
+                LogNormal(OT_METHOD)(__FUNCTION__)(": Token ")(token.hash_)(
+                    " was already spent.")
+                    .Flush();
+
+                return true;
+            }
+        }
+
+        if (series->legacy_ && legacy_spent(id, token.hash_)) {
+            LogNormal(OT_METHOD)(__FUNCTION__)(": Token ")(token.hash_)(
+                " was already spent.")
+                .Flush();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool SpentTokens::bloom_check(const Series& series, const Key& key)
+{
+    std::uint64_t h1{0};
+    std::uint64_t h2{0};
+    std::memcpy(&h1, key.data(), sizeof(h1));
+    std::memcpy(&h2, key.data() + sizeof(h1), sizeof(h2));
+    h2 |= 1;
+    const std::uint64_t bits = series.bloom_.size() * 64;
+
+    for (std::uint64_t i = 0; i < SPENT_BLOOM_HASHES; ++i) {
+        const auto bit = (h1 + i * h2) % bits;
+
+        if (0 == (series.bloom_[bit / 64] & (std::uint64_t(1) << (bit % 64)))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SpentTokens::bloom_insert(Series& series, const Key& key)
+{
+    std::uint64_t h1{0};
+    std::uint64_t h2{0};
+    std::memcpy(&h1, key.data(), sizeof(h1));
+    std::memcpy(&h2, key.data() + sizeof(h1), sizeof(h2));
+    h2 |= 1;
+    const std::uint64_t bits = series.bloom_.size() * 64;
+
+    for (std::uint64_t i = 0; i < SPENT_BLOOM_HASHES; ++i) {
+        const auto bit = (h1 + i * h2) % bits;
+        series.bloom_[bit / 64] |= (std::uint64_t(1) << (bit % 64));
+    }
+}
+
+bool SpentTokens::build_bloom(Series& series) const
+{
+    const auto bits = std::max<std::uint64_t>(
+        SPENT_BLOOM_MIN_BITS,
+        2 * series.records_ * SPENT_BLOOM_BITS_PER_TOKEN);
+    series.bloom_.assign((bits + 63) / 64, 0);
+
+    return read_log(
+        series, [&series](const Key& key) { bloom_insert(series, key); });
+}
+
+bool SpentTokens::build_index(Series& series) const
+{
+    const auto slots = round_slots(series.records_);
+    const auto path = folder_ + series.name_ + SPENT_INDEX_SUFFIX;
+    const auto temp = path + ".tmp";
+    const auto fd = ::open(temp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+    if (0 > fd) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create ")(temp).Flush();
+
+        return false;
+    }
+
+    const auto size = SPENT_HEADER_SIZE + (slots * key_size_);
+    bool success = (0 == ::ftruncate(fd, static_cast<off_t>(size)));
+    std::uint64_t used{0};
+
+    if (success) {
+        bool indexed{true};
+        const bool read = read_log(series, [&](const Key& key) {
+            bool added{false};
+            indexed &= index_insert(fd, slots, key, added);
+
+            if (added) { ++used; }
+        });
+        success = read && indexed;
+    }
+
+    if (success) { success = (0 == ::rename(temp.c_str(), path.c_str())); }
+
+    if (false == success) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to rebuild ")(path)
+            .Flush();
+        ::close(fd);
+        ::unlink(temp.c_str());
+
+        return false;
+    }
+
+    if (0 <= series.index_) { ::close(series.index_); }
+
+    series.index_ = fd;
+    series.slots_ = slots;
+    series.used_ = used;
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Indexed ")(used)(
+        " spent tokens for series ")(series.name_)
+        .Flush();
+
+    return write_index_header(series, false) && (0 == ::fsync(fd));
+}
+
+void SpentTokens::close(Series& series, const bool clean) const
+{
+    if (0 <= series.index_) {
+        if (clean && (0 == ::fsync(series.index_)) &&
+            write_index_header(series, true)) {
+            ::fsync(series.index_);
+        }
+
+        ::close(series.index_);
+        series.index_ = -1;
+    }
+
+    if (0 <= series.log_) {
+        ::close(series.log_);
+        series.log_ = -1;
+    }
+}
+
+bool SpentTokens::index_find(const Series& series, const Key& key, bool& found)
+{
+    found = false;
+
+    if (0 == series.slots_) { return true; }
+
+    const Key empty{};
+    std::uint64_t hash{0};
+    std::memcpy(&hash, key.data() + 12, sizeof(hash));
+    const auto mask = series.slots_ - 1;
+    Key slot{};
+
+    for (std::uint64_t i = 0; i < series.slots_; ++i) {
+        const auto position = (hash + i) & mask;
+        const auto offset = SPENT_HEADER_SIZE + (position * key_size_);
+
+        if (false == read_all(series.index_, offset, slot.data(), key_size_)) {
+            return false;
+        }
+
+        if (empty == slot) { return true; }
+
+        if (key == slot) {
+            found = true;
+
+            return true;
+        }
+    }
+
+    return true;
+}
+
+bool SpentTokens::index_insert(
+    const int fd,
+    const std::uint64_t slots,
+    const Key& key,
+    bool& added)
+{
+    added = false;
+    const Key empty{};
+    std::uint64_t hash{0};
+    std::memcpy(&hash, key.data() + 12, sizeof(hash));
+    const auto mask = slots - 1;
+    Key slot{};
+
+    for (std::uint64_t i = 0; i < slots; ++i) {
+        const auto position = (hash + i) & mask;
+        const auto offset = SPENT_HEADER_SIZE + (position * key_size_);
+
+        if (false == read_all(fd, offset, slot.data(), key_size_)) {
+            return false;
+        }
+
+        if (key == slot) { return true; }
+
+        if (empty == slot) {
+            added = write_all(fd, offset, key.data(), key_size_);
+
+            return added;
+        }
+    }
+
+    return false;
+}
+
+bool SpentTokens::init(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (ready_) { return true; }
+
+    auto folder = String::Factory();
+    bool created{false};
+    const bool havePath = OTPaths::AppendFolder(
+        folder,
+        String::Factory(server_.API().DataFolder()),
+        String::Factory(SPENT_TOKEN_FOLDER));
+
+    if ((false == havePath) ||
+        (false == OTPaths::BuildFolderPath(folder, created))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create ")(folder)
+            .Flush();
+
+        return false;
+    }
+
+    folder_ = folder->Get();
+    auto* dir = ::opendir(folder_.c_str());
+
+    if (nullptr == dir) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open ")(folder_)
+            .Flush();
+
+        return false;
+    }
+
+    const std::string logSuffix{SPENT_LOG_SUFFIX};
+    const std::string retiredSuffix{SPENT_RETIRED_SUFFIX};
+
+    while (auto* entry = ::readdir(dir)) {
+        const std::string file{entry->d_name};
+
+        if (ends_with(file, retiredSuffix)) {
+            retired_.emplace(
+                file.substr(0, file.size() - retiredSuffix.size()));
+        } else if (ends_with(file, logSuffix)) {
+            const auto fd = ::open((folder_ + file).c_str(), O_RDONLY);
+
+            if (0 > fd) { continue; }
+
+            char header[SPENT_HEADER_SIZE]{};
+            time64_t validTo{0};
+
+            if (read_all(fd, 0, header, sizeof(header)) &&
+                (0 == std::memcmp(header, SPENT_LOG_MAGIC, SPENT_MAGIC_SIZE))) {
+                std::memcpy(&validTo, header + 16, sizeof(validTo));
+                expires_[file.substr(0, file.size() - logSuffix.size())] =
+                    validTo;
+            }
+
+            ::close(fd);
+        }
+    }
+
+    ::closedir(dir);
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Found ")(expires_.size())(
+        " active and ")(retired_.size())(" retired series.")
+        .Flush();
+    ready_ = true;
+
+    return true;
+}
+
+SpentTokens::Key SpentTokens::key(const Identifier& hash)
+{
+    Key output{};
+    std::memcpy(
+        output.data(), hash.data(), std::min(hash.size(), output.size()));
+
+    return output;
+}
+
+bool SpentTokens::legacy(const std::string& name) const
+{
+    auto* storage = OTDB::GetDefaultStorage();
+
+    // Other backends can not list a folder, so assume it has tokens
+    if ((nullptr == storage) ||
+        (OTDB::STORE_FILESYSTEM != storage->GetType())) {
+        return true;
+    }
+
+    auto spent = String::Factory();
+    auto folder = String::Factory();
+
+    if (false == OTPaths::AppendFolder(
+                     spent,
+                     String::Factory(server_.API().DataFolder()),
+                     OTFolders::Spent())) {
+        return true;
+    }
+
+    if (false ==
+        OTPaths::AppendFolder(folder, spent, String::Factory(name))) {
+        return true;
+    }
+
+    return OTPaths::FolderExists(folder);
+}
+
+bool SpentTokens::legacy_spent(const std::string& name, const Identifier& hash)
+    const
+{
+    return OTDB::Exists(
+        server_.API().DataFolder(),
+        OTFolders::Spent().Get(),
+        name,
+        hash.str(),
+        "");
+}
+
+SpentTokens::Series* SpentTokens::load(const Lock& lock, const Entry& entry)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto id = name(entry.unit_, entry.series_);
+    auto it = series_.find(id);
+
+    if (series_.end() != it) { return it->second.get(); }
+
+    auto series = std::make_unique<Series>();
+
+    OT_ASSERT(series);
+
+    series->name_ = id;
+    const auto path = folder_ + id + SPENT_LOG_SUFFIX;
+    series->log_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0600);
+    struct stat info;
+
+    if ((0 > series->log_) || (0 != ::fstat(series->log_, &info))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open ")(path).Flush();
+        close(*series, false);
+
+        return nullptr;
+    }
+
+    char header[SPENT_HEADER_SIZE]{};
+    const auto size = static_cast<std::uint64_t>(info.st_size);
+
+    if (0 == size) {
+        series->legacy_ = legacy(id);
+        series->valid_to_ = entry.valid_to_;
+        const std::uint32_t flags = series->legacy_ ? SPENT_FLAG_LEGACY : 0;
+        std::memcpy(header, SPENT_LOG_MAGIC, SPENT_MAGIC_SIZE);
+        std::memcpy(header + 8, &flags, sizeof(flags));
+        std::memcpy(header + 16, &series->valid_to_, sizeof(time64_t));
+
+        if ((false == write_all(series->log_, 0, header, sizeof(header))) ||
+            (0 != ::fsync(series->log_))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create ")(path)
+                .Flush();
+            close(*series, false);
+            ::unlink(path.c_str());
+
+            return nullptr;
+        }
+    } else {
+        std::uint32_t flags{0};
+        const bool valid =
+            (SPENT_HEADER_SIZE <= size) &&
+            read_all(series->log_, 0, header, sizeof(header)) &&
+            (0 == std::memcmp(header, SPENT_LOG_MAGIC, SPENT_MAGIC_SIZE));
+
+        if (false == valid) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid log ")(path).Flush();
+            close(*series, false);
+
+            return nullptr;
+        }
+
+        std::memcpy(&flags, header + 8, sizeof(flags));
+        std::memcpy(&series->valid_to_, header + 16, sizeof(time64_t));
+        series->legacy_ = (0 != (flags & SPENT_FLAG_LEGACY));
+    }
+
+    const auto body = (SPENT_HEADER_SIZE < size) ? size - SPENT_HEADER_SIZE : 0;
+    series->records_ = body / key_size_;
+
+    // Drop the tail of an append which was interrupted
+    if (0 != (body % key_size_)) {
+        const auto whole = SPENT_HEADER_SIZE + (series->records_ * key_size_);
+
+        if (0 != ::ftruncate(series->log_, static_cast<off_t>(whole))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to repair ")(path)
+                .Flush();
+            close(*series, false);
+
+            return nullptr;
+        }
+    }
+
+    if ((false == open_index(*series)) || (false == build_bloom(*series))) {
+        close(*series, false);
+
+        return nullptr;
+    }
+
+    expires_[id] = series->valid_to_;
+
+    if (0 != series->valid_to_) {
+        next_retirement_ = std::min(
+            next_retirement_, series->valid_to_ + SPENT_RETIRE_DELAY);
+    }
+
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Loaded ")(series->records_)(
+        " spent tokens for series ")(id)
+        .Flush();
+    auto* output = series.get();
+    series_.emplace(id, std::move(series));
+
+    return output;
+}
+
+std::string SpentTokens::name(const Identifier& unit, const std::int32_t series)
+{
+    return unit.str() + "." + std::to_string(series);
+}
+
+bool SpentTokens::open_index(Series& series) const
+{
+    const auto path = folder_ + series.name_ + SPENT_INDEX_SUFFIX;
+    const auto fd = ::open(path.c_str(), O_RDWR);
+
+    if (0 > fd) { return build_index(series); }
+
+    char header[SPENT_HEADER_SIZE]{};
+    std::uint64_t slots{0};
+    std::uint64_t used{0};
+    std::uint64_t covered{0};
+    std::uint64_t clean{0};
+    bool valid = read_all(fd, 0, header, sizeof(header)) &&
+                 (0 == std::memcmp(
+                           header, SPENT_INDEX_MAGIC, SPENT_MAGIC_SIZE));
+
+    if (valid) {
+        std::memcpy(&slots, header + 8, sizeof(slots));
+        std::memcpy(&used, header + 16, sizeof(used));
+        std::memcpy(&covered, header + 24, sizeof(covered));
+        std::memcpy(&clean, header + 32, sizeof(clean));
+        valid = (1 == clean) && (covered == series.records_) &&
+                (0 != slots) && (0 == (slots & (slots - 1))) &&
+                ((2 * used) <= slots);
+    }
+
+    if (false == valid) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Rebuilding index for series ")(
+            series.name_)
+            .Flush();
+        ::close(fd);
+
+        return build_index(series);
+    }
+
+    series.index_ = fd;
+    series.slots_ = slots;
+    series.used_ = used;
+
+    // Until the index is closed cleanly again, it must not be trusted
+    return write_index_header(series, false) && (0 == ::fsync(fd));
+}
+
+bool SpentTokens::read_log(
+    const Series& series,
+    const std::function<void(const Key&)>& callback)
+{
+    std::vector<Key> batch(SPENT_READ_BATCH);
+    std::uint64_t done{0};
+
+    while (done < series.records_) {
+        const auto count = std::min<std::uint64_t>(
+            SPENT_READ_BATCH, series.records_ - done);
+        const auto offset = SPENT_HEADER_SIZE + (done * key_size_);
+
+        if (false ==
+            read_all(series.log_, offset, batch.data(), count * key_size_)) {
+            return false;
+        }
+
+        for (std::uint64_t i = 0; i < count; ++i) { callback(batch[i]); }
+
+        done += count;
+    }
+
+    return true;
+}
+
+void SpentTokens::retire(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const auto now = OTTimeGetCurrentTime();
+
+    if (now < next_retirement_) { return; }
+
+    auto next = std::numeric_limits<time64_t>::max();
+
+    for (auto it = expires_.begin(); it != expires_.end();) {
+        const auto& [id, validTo] = *it;
+
+        if (0 == validTo) {
+            ++it;
+
+            continue;
+        }
+
+        const auto due = validTo + SPENT_RETIRE_DELAY;
+
+        if (now < due) {
+            next = std::min(next, due);
+            ++it;
+
+            continue;
+        }
+
+        auto series = series_.find(id);
+
+        if (series_.end() != series) {
+            close(*series->second, false);
+            series_.erase(series);
+        }
+
+        const auto base = folder_ + id;
+        const auto marker = base + SPENT_RETIRED_SUFFIX;
+        const auto fd = ::open(marker.c_str(), O_WRONLY | O_CREAT, 0600);
+
+        if ((0 > fd) || (0 != ::fsync(fd))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to retire series ")(
+                id)
+                .Flush();
+
+            if (0 <= fd) { ::close(fd); }
+
+            next = std::min(next, now + SPENT_RETIRE_DELAY);
+            ++it;
+
+            continue;
+        }
+
+        ::close(fd);
+        ::unlink((base + SPENT_LOG_SUFFIX).c_str());
+        ::unlink((base + SPENT_INDEX_SUFFIX).c_str());
+        retired_.emplace(id);
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Retired series ")(id).Flush();
+        it = expires_.erase(it);
+    }
+
+    next_retirement_ = next;
+}
+
+std::uint64_t SpentTokens::round_slots(const std::uint64_t records)
+{
+    // Leave the index at most a quarter full, so that it grows by doubling
+    // well before probes get long
+    std::uint64_t output{SPENT_INDEX_MIN_SLOTS};
+
+    while (output < (4 * records)) { output *= 2; }
+
+    return output;
+}
+
+bool SpentTokens::Spend(const Batch& tokens)
+{
+    Lock lock(lock_);
+
+    if (false == init(lock)) { return false; }
+
+    retire(lock);
+    Group groups{};
+
+    if (any_spent(lock, tokens, groups)) { return false; }
+
+    std::vector<std::pair<Series*, std::uint64_t>> appended{};
+
+    for (const auto& [id, keys] : groups) {
+        auto& series = *series_.at(id);
+        std::vector<std::uint8_t> buffer{};
+        buffer.reserve(keys.size() * key_size_);
+
+        for (const auto& hash : keys) {
+            buffer.insert(buffer.end(), hash.begin(), hash.end());
+        }
+
+        const auto offset =
+            SPENT_HEADER_SIZE + (series.records_ * key_size_);
+        appended.emplace_back(&series, series.records_);
+
+        if (write_all(series.log_, offset, buffer.data(), buffer.size()) &&
+            (0 == ::fsync(series.log_))) {
+            series.records_ += keys.size();
+
+            continue;
+        }
+
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to record tokens for ")(
+            id)
+            .Flush();
+
+        // Either the whole batch is recorded or none of it is
+        for (const auto& [undo, records] : appended) {
+            const auto size = SPENT_HEADER_SIZE + (records * key_size_);
+            ::ftruncate(undo->log_, static_cast<off_t>(size));
+            ::fsync(undo->log_);
+            undo->records_ = records;
+        }
+
+        return false;
+    }
+
+    for (const auto& [id, keys] : groups) {
+        auto& series = *series_.at(id);
+        bool indexed{true};
+
+        if ((2 * (series.used_ + keys.size())) > series.slots_) {
+            indexed = build_index(series);
+        } else {
+            for (const auto& hash : keys) {
+                bool added{false};
+                indexed &= index_insert(
+                    series.index_, series.slots_, hash, added);
+
+                if (added) { ++series.used_; }
+            }
+        }
+
+        const auto capacity =
+            (series.bloom_.size() * 64) / SPENT_BLOOM_BITS_PER_TOKEN;
+        bool filtered{true};
+
+        if (series.records_ > capacity) {
+            filtered = build_bloom(series);
+        } else {
+            for (const auto& hash : keys) { bloom_insert(series, hash); }
+        }
+
+        if (indexed && filtered) { continue; }
+
+        // The tokens are in the log, which is all that matters. Unloading
+        // the series forces the index and filter to be rebuilt from it.
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to index series ")(id)
+            .Flush();
+        close(series, false);
+        series_.erase(id);
+    }
+
+    return true;
+}
+
+bool SpentTokens::write_index_header(const Series& series, const bool clean)
+    const
+{
+    char header[SPENT_HEADER_SIZE]{};
+    const std::uint64_t flag = clean ? 1 : 0;
+    std::memcpy(header, SPENT_INDEX_MAGIC, SPENT_MAGIC_SIZE);
+    std::memcpy(header + 8, &series.slots_, sizeof(series.slots_));
+    std::memcpy(header + 16, &series.used_, sizeof(series.used_));
+    std::memcpy(header + 24, &series.records_, sizeof(series.records_));
+    std::memcpy(header + 32, &flag, sizeof(flag));
+
+    return write_all(series.index_, 0, header, sizeof(header));
+}
+
+SpentTokens::~SpentTokens()
+{
+    Lock lock(lock_);
+
+    for (auto& [id, series] : series_) { close(*series, true); }
+
+    series_.clear();
+}
+}  // namespace opentxs::server
@@ -0,0 +1,126 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Internal.hpp"
+
+#include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/Identifier.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+namespace server
+{
+// Remembers which cash tokens the notary has accepted, in place of the one
+// file per token which Token::RecordTokenAsSpent writes under
+// OTFolders::Spent().
+//
+// Every mint series has an append-only log of token hashes, an on-disk open
+// addressing hash index over that log and an in-memory Bloom filter. A token
+// which misses the filter is known to be unspent without touching the disk,
+// and a hit is confirmed against the index. The log is authoritative: an
+// index which was not closed cleanly, or which does not match the log, is
+// rebuilt from it.
+//
+// A series which already had tokens in the per-token store when its log was
+// created keeps checking that store as well. Once a series is past the end
+// of its validity its log and index are deleted together and a marker is
+// left in their place, so that tokens from it are refused from then on.
+class SpentTokens
+{
+public:
+    struct Entry {
+        OTIdentifier unit_;
+        std::int32_t series_;
+        /** Valid-to date of the mint series */
+        time64_t valid_to_;
+        /** Digest of the spendable token */
+        OTIdentifier hash_;
+    };
+
+    using Batch = std::vector<Entry>;
+
+    /** Records the batch as spent. Nothing is recorded, and false is
+     *  returned, if any token in the batch was already spent, appears more
+     *  than once, belongs to a retired series, or could not be checked. */
+    bool Spend(const Batch& tokens);
+
+    explicit SpentTokens(Server& server);
+
+    ~SpentTokens();
+
+private:
+    static const std::size_t key_size_{32};
+
+    using Key = std::array<std::uint8_t, key_size_>;
+    using Group = std::map<std::string, std::set<Key>>;
+
+    struct Series {
+        std::string name_{};
+        int log_{-1};
+        int index_{-1};
+        bool legacy_{false};
+        time64_t valid_to_{0};
+        std::uint64_t records_{0};
+        std::uint64_t slots_{0};
+        std::uint64_t used_{0};
+        std::vector<std::uint64_t> bloom_{};
+    };
+
+    Server& server_;
+    std::mutex lock_;
+    bool ready_;
+    std::string folder_;
+    std::map<std::string, time64_t> expires_;
+    std::set<std::string> retired_;
+    std::map<std::string, std::unique_ptr<Series>> series_;
+    time64_t next_retirement_;
+
+    static bool bloom_check(const Series& series, const Key& key);
+    static void bloom_insert(Series& series, const Key& key);
+    static bool index_find(const Series& series, const Key& key, bool& found);
+    static bool index_insert(
+        const int fd,
+        const std::uint64_t slots,
+        const Key& key,
+        bool& added);
+    static Key key(const Identifier& hash);
+    static std::string name(const Identifier& unit, const std::int32_t series);
+    static bool read_log(
+        const Series& series,
+        const std::function<void(const Key&)>& callback);
+    static std::uint64_t round_slots(const std::uint64_t records);
+
+    bool any_spent(const Lock& lock, const Batch& tokens, Group& groups);
+    bool build_bloom(Series& series) const;
+    bool build_index(Series& series) const;
+    void close(Series& series, const bool clean) const;
+    bool init(const Lock& lock);
+    bool legacy(const std::string& name) const;
+    bool legacy_spent(const std::string& name, const Identifier& hash) const;
+    Series* load(const Lock& lock, const Entry& entry);
+    bool open_index(Series& series) const;
+    void retire(const Lock& lock);
+    bool write_index_header(const Series& series, const bool clean) const;
+
+    SpentTokens() = delete;
+    SpentTokens(const SpentTokens&) = delete;
+    SpentTokens(SpentTokens&&) = delete;
+    SpentTokens& operator=(const SpentTokens&) = delete;
+    SpentTokens& operator=(SpentTokens&&) = delete;
+};
+}  // namespace server
+}  // namespace opentxs
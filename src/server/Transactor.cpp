@@ -33,6 +33,7 @@ namespace opentxs::server
 
 Transactor::Transactor(Server& server)
     : server_(server)
+    , number_lock_()
     , transactionNumber_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
@@ -51,6 +52,17 @@ Transactor::Transactor(Server& server)
 bool Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber)
 {
+    Lock lock(number_lock_);
+
+    return issue_next_number(lock, lTransactionNumber);
+}
+
+bool Transactor::issue_next_number(
+    const Lock& lock,
+    TransactionNumber& lTransactionNumber)
+{
+    OT_ASSERT(lock.owns_lock());
+
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -74,7 +86,11 @@ bool Transactor::issueNextTransactionNumberToNym(
     ClientContext& context,
     TransactionNumber& lTransactionNumber)
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    // Requests for different nyms may be processed concurrently, so the
+    // number must not change between issuing it and recording it on the nym.
+    Lock lock(number_lock_);
+
+    if (!issue_next_number(lock, lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -83,7 +99,7 @@ bool Transactor::issueNextTransactionNumberToNym(
     // it is recorded in his Nym file before being sent to the client (where it
     // is also recorded in his Nym file.)  That way the server always knows
     // which numbers are valid for each Nym.
-    if (!context.IssueNumber(transactionNumber_)) {
+    if (!context.IssueNumber(lTransactionNumber)) {
         otErr << "Error adding transaction number to Nym file.\n";
         transactionNumber_--;
         // Save it back how it was, since we're not issuing this number after
@@ -93,11 +109,6 @@ bool Transactor::issueNextTransactionNumberToNym(
         return false;
     }
 
-    // SUCCESS?
-    // Now the server main file has saved the latest transaction number,
-    // NOW we set it onto the parameter and return true.
-    lTransactionNumber = transactionNumber_;
-
     return true;
 }
 
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace opentxs
@@ -70,6 +71,7 @@ private:
     typedef std::map<std::string, std::string> BasketsMap;
 
     Server& server_;
+    std::mutex number_lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
     // maps basketId with basketAccountId
@@ -81,6 +83,8 @@ private:
     // The list of voucher accounts (see GetVoucherAccount below for details)
     AccountList voucherAccounts_;
 
+    bool issue_next_number(const Lock& lock, TransactionNumber& txNumber);
+
     Transactor() = delete;
 };
 }  // namespace server
@@ -188,7 +188,10 @@ bool UserCommandProcessor::add_numbers_to_nymbox(
     bool success = true;
     success &= nymbox.VerifyContractID();
 
-    if (success) { success &= nymbox.VerifySignature(server_.GetServerNym()); }
+    if (success) {
+        success &=
+            server_.Ledgers().VerifySignature(nymbox, server_.GetServerNym());
+    }
 
     if (false == success) {
         otErr << OT_METHOD << __FUNCTION__ << ": Error veryfying nymbox."
@@ -233,7 +236,7 @@ bool UserCommandProcessor::add_numbers_to_nymbox(
         nymbox.ReleaseSignatures();
         nymbox.SignContract(server_.GetServerNym());
         nymbox.SaveContract();
-        savedNymbox = nymbox.SaveNymbox(nymboxHash);
+        savedNymbox = server_.Ledgers().SaveNymbox(nymbox, nymboxHash);
     } else {
         nymbox.CalculateNymboxHash(nymboxHash);
     }
@@ -274,7 +277,7 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
     OT_ASSERT(false != bool(nymbox));
 
     if (nymbox->LoadNymbox() &&
-        nymbox->VerifySignature(server_.GetServerNym())) {
+        server_.Ledgers().VerifySignature(*nymbox, server_.GetServerNym())) {
         bool bIsDirtyNymbox = false;
 
         for (auto& it : numlist_ack_reply) {
@@ -320,7 +323,7 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
             nymbox->ReleaseSignatures();
             nymbox->SignContract(server_.GetServerNym());
             nymbox->SaveContract();
-            nymbox->SaveNymbox(Identifier::Factory());
+            server_.Ledgers().SaveNymbox(*nymbox);
         }
     }
 
@@ -1836,7 +1839,7 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
     // ...or generate them otherwise...
 
     if (inboxLoaded) {
-        inboxLoaded = inbox->VerifyAccount(serverNym);
+        inboxLoaded = server_.Ledgers().VerifyAccount(*inbox, serverNym);
     } else {
         inboxLoaded = inbox->CreateLedger(
             nymID, accountID, serverID, ledgerType::inbox, true);
@@ -1846,13 +1849,12 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
         if (inboxLoaded) { inboxLoaded = inbox->SaveContract(); }
 
         if (inboxLoaded) {
-            inboxLoaded =
-                account.get().SaveInbox(*inbox, Identifier::Factory());
+            inboxLoaded = server_.Ledgers().SaveInbox(account.get(), *inbox);
         }
     }
 
     if (true == outboxLoaded) {
-        outboxLoaded = outbox->VerifyAccount(serverNym);
+        outboxLoaded = server_.Ledgers().VerifyAccount(*outbox, serverNym);
     } else {
         outboxLoaded = outbox->CreateLedger(
             nymID, accountID, serverID, ledgerType::outbox, true);
@@ -1862,8 +1864,7 @@ bool UserCommandProcessor::cmd_register_account(ReplyMessage& reply) const
         if (outboxLoaded) { outboxLoaded = outbox->SaveContract(); }
 
         if (outboxLoaded) {
-            outboxLoaded =
-                account.get().SaveOutbox(*outbox, Identifier::Factory());
+            outboxLoaded = server_.Ledgers().SaveOutbox(account.get(), *outbox);
         }
     }
 
@@ -2422,7 +2423,7 @@ void UserCommandProcessor::drop_reply_notice_to_nymbox(
     if (true == bSuccessLoadingNymbox) {
         bSuccessLoadingNymbox =
             (theNymbox->VerifyContractID() &&
-             theNymbox->VerifySignature(serverNym));
+             server_.Ledgers().VerifySignature(*theNymbox, serverNym));
     }
 
     if (!bSuccessLoadingNymbox) {
@@ -2489,7 +2490,7 @@ void UserCommandProcessor::drop_reply_notice_to_nymbox(
     theNymbox->SignContract(serverNym);
     theNymbox->SaveContract();
     auto NYMBOX_HASH = Identifier::Factory();
-    theNymbox->SaveNymbox(NYMBOX_HASH);
+    server_.Ledgers().SaveNymbox(*theNymbox, NYMBOX_HASH);
     replyNotice->SaveBoxReceipt(*theNymbox);
     context.SetLocalNymboxHash(NYMBOX_HASH);
 }
@@ -2543,6 +2544,33 @@ bool UserCommandProcessor::isAdmin(const Identifier& nymID)
     return (0 == adminNym.compare(String::Factory(nymID)->Get()));
 }
 
+bool UserCommandProcessor::RequiresExclusiveLock(const MessageType type)
+{
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::getTransactionNumbers:
+        case MessageType::checkNym:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint:
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+
+            return false;
+        }
+        default: {
+
+            return true;
+        }
+    }
+}
+
 std::unique_ptr<Ledger> UserCommandProcessor::load_inbox(
     const Identifier& nymID,
     const Identifier& accountID,
@@ -2900,7 +2928,7 @@ bool UserCommandProcessor::save_inbox(
 {
     if (false == save_box(nym, inbox)) { return false; }
 
-    if (false == inbox.SaveInbox(hash)) { return false; }
+    if (false == server_.Ledgers().SaveInbox(inbox, hash)) { return false; }
 
     return true;
 }
@@ -2912,7 +2940,7 @@ bool UserCommandProcessor::save_nymbox(
 {
     if (false == save_box(nym, nymbox)) { return false; }
 
-    if (false == nymbox.SaveNymbox(hash)) { return false; }
+    if (false == server_.Ledgers().SaveNymbox(nymbox, hash)) { return false; }
 
     return true;
 }
@@ -2924,7 +2952,7 @@ bool UserCommandProcessor::save_outbox(
 {
     if (false == save_box(nym, outbox)) { return false; }
 
-    if (false == outbox.SaveOutbox(hash)) { return false; }
+    if (false == server_.Ledgers().SaveOutbox(outbox, hash)) { return false; }
 
     return true;
 }
@@ -2943,14 +2971,14 @@ bool UserCommandProcessor::verify_box(
     }
 
     if (full) {
-        if (false == box.VerifyAccount(nym)) {
+        if (false == server_.Ledgers().VerifyAccount(box, nym)) {
             otErr << OT_METHOD << __FUNCTION__ << ": Unable to verify box for "
                   << String::Factory(ownerID) << std::endl;
 
             return false;
         }
     } else {
-        if (false == box.VerifySignature(nym)) {
+        if (false == server_.Ledgers().VerifySignature(box, nym)) {
             otErr << OT_METHOD << __FUNCTION__
                   << ": Unable to verify signature for "
                   << String::Factory(ownerID) << std::endl;
@@ -27,6 +27,11 @@ public:
         const Identifier& realNotaryID);
     static bool check_server_lock(const Identifier& nymID);
     static bool isAdmin(const Identifier& nymID);
+    /** Commands which only read shared notary state, and only modify the
+     *  context and nymbox of the requesting nym, may run concurrently with
+     *  commands from other nyms. Everything else, including cron, needs
+     *  exclusive access to the notary. */
+    static bool RequiresExclusiveLock(const MessageType type);
 
     void drop_reply_notice_to_nymbox(
         const api::Wallet& wallet,
@@ -10,6 +10,11 @@
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/core/Log.hpp"
 
+#include "StorageConfig.hpp"
+
+#include <chrono>
+#include <memory>
+
 #define OT_METHOD "opentxs::Plugin"
 
 namespace opentxs
@@ -26,13 +31,77 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , writer_lock_()
+    , writer_signal_()
+    , writer_queue_()
+    , writer_bytes_(0)
+    , writer_stop_(false)
+    , writer_()
+{
+}
+
+Plugin::CopyView::CopyView(const Plugin& parent)
+    : parent_(parent)
+    , values_()
+{
+}
+
+bool Plugin::CopyView::Load(
+    const std::string& key,
+    const bool checking,
+    std::string_view& value) const
+{
+    auto& copy = values_.emplace_back();
+
+    if (parent_.Load(key, checking, copy)) {
+        value = copy;
+
+        return true;
+    }
+
+    values_.pop_back();
+
+    return false;
+}
+
+void Plugin::enqueue(Write&& write) const
 {
+    Lock lock(writer_lock_);
+
+    if (writer_stop_) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Plugin is shutting down."
+              << std::endl;
+        write.promise_->set_value(false);
+
+        return;
+    }
+
+    // The writer can not be started by the constructor since it calls virtual
+    // functions of the driver
+    if (false == writer_.joinable()) {
+        writer_ = std::thread(&Plugin::writer, this);
+    }
+
+    writer_bytes_ += write.key_.size() + write.value_.size();
+    writer_queue_.emplace_back(std::move(write));
+    lock.unlock();
+    writer_signal_.notify_one();
 }
 
 bool Plugin::Load(
     const std::string& key,
     const bool checking,
     std::string& value) const
+{
+    return load(key, checking, [&](const bool bucket) -> bool {
+        return LoadFromBucket(key, value, bucket) && (0 < value.size());
+    });
+}
+
+bool Plugin::load(
+    const std::string& key,
+    const bool checking,
+    const BucketLoader& loader) const
 {
     if (key.empty()) {
         if (!checking) {
@@ -43,26 +112,13 @@ bool Plugin::Load(
         return false;
     }
 
-    bool valid = false;
     const bool bucket{current_bucket_};
-
-    if (LoadFromBucket(key, value, bucket)) { valid = 0 < value.size(); }
-
-    if (!valid) {
-        // try again in the other bucket
-        if (LoadFromBucket(key, value, !bucket)) {
-            valid = 0 < value.size();
-        } else {
-            // just in case...
-            if (LoadFromBucket(key, value, bucket)) {
-                valid = 0 < value.size();
-            }
-        }
-    }
+    // try again in the other bucket, then the original bucket just in case...
+    const bool valid = loader(bucket) || loader(!bucket) || loader(bucket);
 
     if (!valid && !checking) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": Specified object is not found.")(
-            " Hash: ")(key)(".")(" Size: ")(value.size())(".")
+            " Hash: ")(key)(".")
             .Flush();
     }
 
@@ -108,6 +164,21 @@ bool Plugin::Migrate(
     return true;
 }
 
+std::unique_ptr<Plugin::ReadView> Plugin::Read() const
+{
+    return std::make_unique<CopyView>(*this);
+}
+
+void Plugin::stop_writer() const
+{
+    Lock lock(writer_lock_);
+    writer_stop_ = true;
+    lock.unlock();
+    writer_signal_.notify_all();
+
+    if (writer_.joinable()) { writer_.join(); }
+}
+
 bool Plugin::Store(
     const bool isTransaction,
     const std::string& key,
@@ -116,7 +187,7 @@ bool Plugin::Store(
 {
     std::promise<bool> promise;
     auto future = promise.get_future();
-    store(isTransaction, key, value, bucket, &promise);
+    Store(isTransaction, key, value, bucket, promise);
 
     return future.get();
 }
@@ -128,9 +199,7 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
-    std::thread thread(
-        &Plugin::store, this, isTransaction, key, value, bucket, &promise);
-    thread.detach();
+    enqueue(Write{isTransaction, key, value, bucket, &promise});
 }
 
 bool Plugin::Store(
@@ -148,4 +217,65 @@ bool Plugin::Store(
 
     return false;
 }
+
+void Plugin::store_batch(const WriteBatch& batch) const
+{
+    for (const auto& write : batch) {
+        store(
+            write.isTransaction_,
+            write.key_,
+            write.value_,
+            write.bucket_,
+            write.promise_);
+    }
+}
+
+void Plugin::writer() const
+{
+    const auto window = std::chrono::microseconds(config_.write_batch_window_);
+    const auto budget = static_cast<std::size_t>(config_.write_batch_bytes_);
+    Lock lock(writer_lock_);
+
+    while (true) {
+        writer_signal_.wait(lock, [&]() -> bool {
+            return writer_stop_ || (false == writer_queue_.empty());
+        });
+
+        // Pending writes are always flushed before the thread exits
+        if (writer_queue_.empty()) { return; }
+
+        // Give concurrent writers a chance to join the batch
+        if ((0 < window.count()) && (false == writer_stop_)) {
+            writer_signal_.wait_for(lock, window, [&]() -> bool {
+                return writer_stop_ || (writer_bytes_ >= budget);
+            });
+        }
+
+        WriteBatch batch{};
+        std::size_t bytes{0};
+
+        while (false == writer_queue_.empty()) {
+            auto& next = writer_queue_.front();
+            const auto size = next.key_.size() + next.value_.size();
+
+            if ((false == batch.empty()) && ((bytes + size) > budget)) {
+                break;
+            }
+
+            bytes += size;
+            batch.emplace_back(std::move(next));
+            writer_queue_.pop_front();
+        }
+
+        writer_bytes_ -= bytes;
+        lock.unlock();
+        LogTrace(OT_METHOD)(__FUNCTION__)(": Writing ")(batch.size())(
+            " values")
+            .Flush();
+        store_batch(batch);
+        lock.lock();
+    }
+}
+
+Plugin::~Plugin() { stop_writer(); }
 }  // namespace opentxs
@@ -14,7 +14,14 @@
 #include "opentxs/Types.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace opentxs
 {
@@ -39,6 +46,7 @@ public:
         const std::string& key,
         std::string& value,
         const bool bucket) const override = 0;
+    std::unique_ptr<ReadView> Read() const override;
     bool Store(
         const bool isTransaction,
         const std::string& key,
@@ -65,9 +73,48 @@ public:
 
     virtual void Cleanup() = 0;
 
-    virtual ~Plugin() = default;
+    virtual ~Plugin();
 
 protected:
+    /** A write waiting in the queue of the writer thread */
+    struct Write {
+        bool isTransaction_{false};
+        std::string key_{};
+        std::string value_{};
+        bool bucket_{false};
+        std::promise<bool>* promise_{nullptr};
+    };
+    using WriteBatch = std::vector<Write>;
+    /** Attempts to load a key from the specified bucket */
+    using BucketLoader = std::function<bool(const bool bucket)>;
+
+    /** ReadView for drivers which can not expose their storage directly
+     *
+     *  Every loaded value is copied into the view.
+     */
+    class CopyView final : public ReadView
+    {
+    public:
+        bool Load(
+            const std::string& key,
+            const bool checking,
+            std::string_view& value) const override;
+
+        CopyView(const Plugin& parent);
+
+        ~CopyView() = default;
+
+    private:
+        const Plugin& parent_;
+        mutable std::list<std::string> values_;
+
+        CopyView() = delete;
+        CopyView(const CopyView&) = delete;
+        CopyView(CopyView&&) = delete;
+        CopyView& operator=(const CopyView&) = delete;
+        CopyView& operator=(CopyView&&) = delete;
+    };
+
     const StorageConfig& config_;
     const Random& random_;
 
@@ -79,17 +126,39 @@ protected:
         const Flag& bucket);
     Plugin() = delete;
 
+    /** Searches the current bucket, then the other bucket, for a key */
+    bool load(
+        const std::string& key,
+        const bool checking,
+        const BucketLoader& loader) const;
     virtual void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const = 0;
+    /** Writes a group of queued values
+     *
+     *  Drivers which support transactions should override this to commit the
+     *  entire batch at once. Every promise in the batch must be satisfied.
+     */
+    virtual void store_batch(const WriteBatch& batch) const;
+    /** Must be called by every driver before it is destroyed */
+    void stop_writer() const;
 
 private:
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    mutable std::mutex writer_lock_;
+    mutable std::condition_variable writer_signal_;
+    mutable std::deque<Write> writer_queue_;
+    mutable std::size_t writer_bytes_;
+    mutable bool writer_stop_;
+    mutable std::thread writer_;
+
+    void enqueue(Write&& write) const;
+    void writer() const;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
@@ -98,12 +167,12 @@ private:
 };
 
 template <class T>
-bool opentxs::api::storage::Driver::LoadProto(
+bool opentxs::api::storage::Driver::ReadView::LoadProto(
     const std::string& hash,
     std::shared_ptr<T>& serialized,
     const bool checking) const
 {
-    std::string raw;
+    std::string_view raw{};
     const bool loaded = Load(hash, checking, raw);
     bool valid = false;
 
@@ -132,6 +201,19 @@ bool opentxs::api::storage::Driver::LoadProto(
     return valid;
 }
 
+template <class T>
+bool opentxs::api::storage::Driver::LoadProto(
+    const std::string& hash,
+    std::shared_ptr<T>& serialized,
+    const bool checking) const
+{
+    const auto view = Read();
+
+    OT_ASSERT(view);
+
+    return view->LoadProto<T>(hash, serialized, checking);
+}
+
 template <class T>
 bool opentxs::api::storage::Driver::StoreProto(
     const T& data,
@@ -35,8 +35,17 @@ public:
     bool auto_publish_units_ = true;
     std::int64_t gc_interval_ =
         C::duration_cast<C::seconds>(C::hours(1)).count();
+    // Sweeps of the nym, server and unit definition trees for the DHT visit
+    // this many objects, then pause for map_slice_pause_ milliseconds. Zero
+    // objects disables pacing.
+    std::int64_t map_slice_objects_{100};
+    std::int64_t map_slice_pause_{250};
     std::string path_{};
     InsertCB dht_callback_{};
+    // Plugins wait this many microseconds for additional writes before
+    // committing a batch
+    std::int64_t write_batch_window_{0};
+    std::int64_t write_batch_bytes_{4 * 1024 * 1024};
 
 #if OT_STORAGE_LMDB
     std::string primary_plugin_ = OT_STORAGE_PRIMARY_PLUGIN_LMDB;
@@ -62,6 +71,13 @@ public:
     std::string sqlite3_control_table_ = "control";
     std::string sqlite3_root_key_ = "a";
     std::string sqlite3_db_file_ = "opentxs.sqlite3";
+    std::string sqlite3_journal_mode_ = "WAL";
+    // OFF, NORMAL, FULL, or EXTRA
+    std::string sqlite3_synchronous_ = "NORMAL";
+    // Maximum number of connections used for concurrent loads
+    std::int64_t sqlite3_read_connections_{4};
+    // Milliseconds
+    std::int64_t sqlite3_busy_timeout_{5000};
 #endif
 
 #ifdef OT_STORAGE_LMDB
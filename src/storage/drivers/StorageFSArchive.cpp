@@ -126,10 +126,7 @@ void StorageFSArchive::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSArchive::Cleanup_StorageFSArchive()
-{
-    // future cleanup actions go here
-}
+void StorageFSArchive::Cleanup_StorageFSArchive() { stop_writer(); }
 
 bool StorageFSArchive::EmptyBucket(const bool) const { return true; }
 
@@ -66,10 +66,7 @@ void StorageFSGC::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSGC::Cleanup_StorageFSGC()
-{
-    // future cleanup actions go here
-}
+void StorageFSGC::Cleanup_StorageFSGC() { stop_writer(); }
 
 bool StorageFSGC::EmptyBucket(const bool bucket) const
 {
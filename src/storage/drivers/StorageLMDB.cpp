@@ -19,7 +19,9 @@ extern "C" {
 #include <sys/stat.h>
 }
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "StorageLMDB.hpp"
@@ -45,6 +47,37 @@ opentxs::api::storage::Plugin* Factory::StorageLMDB(
 
 namespace opentxs::storage::implementation
 {
+StorageLMDB::View::View(const StorageLMDB& parent)
+    : parent_(parent)
+    , transaction_(nullptr)
+{
+    const bool status = 0 == mdb_txn_begin(
+                                 parent_.environment_,
+                                 nullptr,
+                                 MDB_RDONLY,
+                                 &transaction_);
+
+    OT_ASSERT(status);
+    OT_ASSERT(nullptr != transaction_);
+}
+
+bool StorageLMDB::View::Load(
+    const std::string& key,
+    const bool checking,
+    std::string_view& value) const
+{
+    return parent_.load(key, checking, [&](const bool bucket) -> bool {
+        return parent_.get_key(
+                   transaction_, key, parent_.get_folder(bucket), value) &&
+               (0 < value.size());
+    });
+}
+
+StorageLMDB::View::~View()
+{
+    if (nullptr != transaction_) { mdb_txn_abort(transaction_); }
+}
+
 StorageLMDB::StorageLMDB(
     const api::storage::Storage& storage,
     const StorageConfig& config,
@@ -63,6 +96,8 @@ void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
 void StorageLMDB::Cleanup_StorageLMDB()
 {
+    stop_writer();
+
     if (nullptr != environment_) {
         mdb_env_close(environment_);
         environment_ = nullptr;
@@ -105,19 +140,32 @@ std::string StorageLMDB::get_key(const std::string& input, const Table table)
     OT_ASSERT(status);
     OT_ASSERT(nullptr != transaction);
 
+    std::string_view value{};
+
+    if (get_key(transaction, input, table, value)) { output.assign(value); }
+
+    mdb_txn_abort(transaction);
+
+    return output;
+}
+
+bool StorageLMDB::get_key(
+    MDB_txn* transaction,
+    const std::string& input,
+    const Table table,
+    std::string_view& output) const
+{
     auto& database{get_database(table)};
     MDB_val key, value;
     key.mv_size = input.size();
     key.mv_data = const_cast<char*>(input.c_str());
-    status = 0 == mdb_get(transaction, database, &key, &value);
 
-    if (status) {
-        output.assign(static_cast<char*>(value.mv_data), value.mv_size);
-    }
+    if (0 != mdb_get(transaction, database, &key, &value)) { return false; }
 
-    mdb_txn_abort(transaction);
+    output = std::string_view{static_cast<const char*>(value.mv_data),
+                              value.mv_size};
 
-    return output;
+    return true;
 }
 
 MDB_dbi StorageLMDB::init_db(const std::string& table)
@@ -154,7 +202,9 @@ void StorageLMDB::init_environment(const std::string& folder)
 
     OT_ASSERT(set);
 
-    set = 0 == mdb_env_open(environment_, folder.c_str(), 0, 0664);
+    // Read views may be nested on one thread, so reader slots can not be
+    // bound to threads
+    set = 0 == mdb_env_open(environment_, folder.c_str(), MDB_NOTLS, 0664);
 
     OT_ASSERT(set);
 }
@@ -183,6 +233,11 @@ std::string StorageLMDB::LoadRoot() const
     return get_key(config_.lmdb_root_key_, Table::Control);
 }
 
+std::unique_ptr<StorageLMDB::ReadView> StorageLMDB::Read() const
+{
+    return std::make_unique<View>(*this);
+}
+
 void StorageLMDB::store(
     [[maybe_unused]] const bool isTransaction,
     const std::string& key,
@@ -194,6 +249,34 @@ void StorageLMDB::store(
     promise->set_value(output);
 }
 
+void StorageLMDB::store_batch(const WriteBatch& batch) const
+{
+    MDB_txn* transaction{nullptr};
+    bool status = 0 == mdb_txn_begin(environment_, nullptr, 0, &transaction);
+
+    OT_ASSERT(status);
+    OT_ASSERT(nullptr != transaction);
+
+    std::vector<bool> stored{};
+    stored.reserve(batch.size());
+
+    for (const auto& write : batch) {
+        auto& database{get_database(get_folder(write.bucket_))};
+        MDB_val key, value;
+        key.mv_size = write.key_.size();
+        key.mv_data = const_cast<char*>(write.key_.c_str());
+        value.mv_size = write.value_.size();
+        value.mv_data = const_cast<char*>(write.value_.c_str());
+        stored.push_back(0 == mdb_put(transaction, database, &key, &value, 0));
+    }
+
+    const bool committed = (0 == mdb_txn_commit(transaction));
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        batch.at(i).promise_->set_value(committed && stored.at(i));
+    }
+}
+
 bool StorageLMDB::store_key(
     const std::string& index,
     const Table table,
@@ -19,6 +19,7 @@ public:
         std::string& value,
         const bool bucket) const override;
     std::string LoadRoot() const override;
+    std::unique_ptr<ReadView> Read() const override;
     bool StoreRoot(const bool commit, const std::string& hash) const override;
 
     void Cleanup() override;
@@ -38,18 +39,48 @@ private:
         B = 2,
     };
 
+    /** Holds a read transaction open so values can point into the map */
+    class View final : public ReadView
+    {
+    public:
+        bool Load(
+            const std::string& key,
+            const bool checking,
+            std::string_view& value) const override;
+
+        View(const StorageLMDB& parent);
+
+        ~View();
+
+    private:
+        const StorageLMDB& parent_;
+        MDB_txn* transaction_;
+
+        View() = delete;
+        View(const View&) = delete;
+        View(View&&) = delete;
+        View& operator=(const View&) = delete;
+        View& operator=(View&&) = delete;
+    };
+
     mutable MDB_env* environment_;
     mutable Databases databases_;
 
     Table get_folder(const bool bucket) const;
     MDB_dbi& get_database(const Table table) const;
     std::string get_key(const std::string& key, const Table table) const;
+    bool get_key(
+        MDB_txn* transaction,
+        const std::string& key,
+        const Table table,
+        std::string_view& value) const;
     void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const override;
+    void store_batch(const WriteBatch& batch) const override;
     bool store_key(
         const std::string& key,
         const Table table,
@@ -130,12 +130,15 @@ void StorageMemDB::store(
 {
     OT_ASSERT(nullptr != promise);
 
+    eLock lock(shared_lock_);
+
     if (bucket) {
         a_[key] = value;
     } else {
         b_[key] = value;
     }
 
+    lock.unlock();
     promise->set_value(true);
 }
 
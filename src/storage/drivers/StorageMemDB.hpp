@@ -21,9 +21,9 @@ public:
     std::string LoadRoot() const override;
     bool StoreRoot(const bool commit, const std::string& hash) const override;
 
-    void Cleanup() override {}
+    void Cleanup() override { stop_writer(); }
 
-    ~StorageMemDB() = default;
+    ~StorageMemDB() { stop_writer(); }
 
 private:
     using ot_super = Plugin;
@@ -21,6 +21,7 @@
 #include "storage/StorageConfig.hpp"
 
 #include <limits>
+#include <list>
 #include <memory>
 #include <vector>
 
@@ -75,6 +76,36 @@ StorageMultiplex::StorageMultiplex(
     Init_StorageMultiplex(primary, migrate, previous);
 }
 
+StorageMultiplex::View::View(
+    const StorageMultiplex& parent,
+    std::unique_ptr<ReadView> primary)
+    : parent_(parent)
+    , primary_(std::move(primary))
+    , copies_()
+{
+    OT_ASSERT(primary_);
+}
+
+bool StorageMultiplex::View::Load(
+    const std::string& key,
+    const bool checking,
+    std::string_view& value) const
+{
+    if (primary_->Load(key, true, value)) { return true; }
+
+    auto& copy = copies_.emplace_back();
+
+    if (parent_.Load(key, checking, copy)) {
+        value = copy;
+
+        return true;
+    }
+
+    copies_.pop_back();
+
+    return false;
+}
+
 std::string StorageMultiplex::BestRoot(bool& primaryOutOfSync)
 {
     OT_ASSERT(primary_plugin_);
@@ -420,6 +451,13 @@ opentxs::api::storage::Driver& StorageMultiplex::Primary()
     return *primary_plugin_;
 }
 
+std::unique_ptr<StorageMultiplex::ReadView> StorageMultiplex::Read() const
+{
+    OT_ASSERT(primary_plugin_);
+
+    return std::make_unique<View>(*this, primary_plugin_->Read());
+}
+
 bool StorageMultiplex::Store(
     const bool isTransaction,
     const std::string& key,
@@ -428,8 +466,12 @@ bool StorageMultiplex::Store(
 {
     OT_ASSERT(primary_plugin_);
 
+    // Plugins hold pointers to these promises until the write completes, so
+    // the vector must never reallocate
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
+    promises.reserve(1 + backup_plugins_.size());
+    futures.reserve(1 + backup_plugins_.size());
     promises.push_back(std::promise<bool>());
     auto& primaryPromise = promises.back();
     futures.push_back(primaryPromise.get_future());
@@ -7,6 +7,8 @@
 
 #include "Internal.hpp"
 
+#include <list>
+
 namespace opentxs::storage::implementation
 {
 class StorageMultiplex : virtual public opentxs::api::storage::Multiplex
@@ -20,6 +22,7 @@ public:
     bool Load(const std::string& key, const bool checking, std::string& value)
         const override;
     std::string LoadRoot() const override;
+    std::unique_ptr<ReadView> Read() const override;
     bool Migrate(
         const std::string& key,
         const opentxs::api::storage::Driver& to) const override;
@@ -54,6 +57,33 @@ public:
 private:
     friend Factory;
 
+    /** Reads through the primary plugin and falls back to the backups */
+    class View final : public ReadView
+    {
+    public:
+        bool Load(
+            const std::string& key,
+            const bool checking,
+            std::string_view& value) const override;
+
+        View(
+            const StorageMultiplex& parent,
+            std::unique_ptr<ReadView> primary);
+
+        ~View() = default;
+
+    private:
+        const StorageMultiplex& parent_;
+        const std::unique_ptr<ReadView> primary_;
+        mutable std::list<std::string> copies_;
+
+        View() = delete;
+        View(const View&) = delete;
+        View(View&&) = delete;
+        View& operator=(const View&) = delete;
+        View& operator=(View&&) = delete;
+    };
+
     const api::storage::Storage& storage_;
     const Flag& primary_bucket_;
     const StorageConfig& config_;
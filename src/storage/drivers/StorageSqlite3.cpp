@@ -17,16 +17,21 @@ extern "C" {
 #include <sqlite3.h>
 }
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <tuple>
 #include <vector>
 
 #include "StorageSqlite3.hpp"
 
+#define OT_SQLITE_BUSY_RETRIES 3
+
 #define OT_METHOD "opentxs::StorageSqlite3::"
 
 namespace opentxs
@@ -56,48 +61,84 @@ StorageSqlite3::StorageSqlite3(
     , transaction_lock_()
     , transaction_bucket_(Flag::Factory(false))
     , pending_()
+    , write_lock_()
     , db_(nullptr)
+    , upsert_()
+    , reader_lock_()
+    , reader_available_()
+    , readers_()
+    , idle_readers_()
 {
     Init_StorageSqlite3();
 }
 
-std::string StorageSqlite3::bind_key(
-    const std::string& source,
-    const std::string& key,
-    const std::size_t start) const
+bool StorageSqlite3::begin(const Lock& lock) const
 {
-    sqlite3_stmt* statement{nullptr};
-    sqlite3_prepare_v2(db_, source.c_str(), -1, &statement, nullptr);
-    sqlite3_bind_text(statement, start, key.c_str(), key.size(), SQLITE_STATIC);
-    const auto output = expand_sql(statement);
-    sqlite3_finalize(statement);
+    OT_ASSERT(lock.owns_lock());
 
-    return output;
+    return (
+        SQLITE_OK ==
+        sqlite3_exec(db_, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr));
 }
 
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
-
-void StorageSqlite3::commit(std::stringstream& sql) const
+void StorageSqlite3::Cleanup_StorageSqlite3()
 {
-    sql << "COMMIT TRANSACTION;";
+    stop_writer();
+    Lock readLock(reader_lock_);
+
+    for (auto& reader : readers_) {
+        finalize(reader->select_);
+        sqlite3_close(reader->db_);
+    }
+
+    idle_readers_.clear();
+    readers_.clear();
+    readLock.unlock();
+    Lock writeLock(write_lock_);
+    finalize(upsert_);
+    sqlite3_close(db_);
+    db_ = nullptr;
 }
 
 bool StorageSqlite3::commit_transaction(const std::string& rootHash) const
 {
     Lock lock(transaction_lock_);
-    std::stringstream sql{};
-    start_transaction(sql);
-    set_data(sql);
-    set_root(rootHash, sql);
-    commit(sql);
+    const std::string tablename{GetTableName(transaction_bucket_.get())};
+    Lock writeLock(write_lock_);
+
+    if (false == begin(writeLock)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to start transaction"
+              << std::endl;
+
+        return false;
+    }
+
+    bool success{true};
+
+    for (const auto& it : pending_) {
+        const auto& key = it.first;
+        const auto& value = it.second;
+        success = upsert(writeLock, key, tablename, value);
+
+        if (false == success) { break; }
+    }
+
+    if (success) {
+        success = upsert(
+            writeLock,
+            config_.sqlite3_root_key_,
+            config_.sqlite3_control_table_,
+            rootHash);
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Committing ")(pending_.size())(
+        " values")
+        .Flush();
     pending_.clear();
-    LogVerbose(OT_METHOD)(__FUNCTION__)(sql.str()).Flush();
 
-    return (
-        SQLITE_OK ==
-        sqlite3_exec(db_, sql.str().c_str(), nullptr, nullptr, nullptr));
+    return end(writeLock, success) && success;
 }
 
 bool StorageSqlite3::Create(const std::string& tablename) const
@@ -115,13 +156,109 @@ bool StorageSqlite3::EmptyBucket(const bool bucket) const
     return Purge(GetTableName(bucket));
 }
 
-std::string StorageSqlite3::expand_sql(sqlite3_stmt* statement) const
+bool StorageSqlite3::end(const Lock& lock, const bool commit) const
 {
-    const std::string output{sqlite3_expanded_sql(statement)};
+    OT_ASSERT(lock.owns_lock());
+
+    if (commit) {
+        const auto committed = sqlite3_exec(
+            db_, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr);
+
+        if (SQLITE_OK == committed) { return true; }
+
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to commit transaction: " << sqlite3_errstr(committed)
+              << std::endl;
+    }
+
+    // A failed commit leaves the transaction open, and every later write on
+    // this connection would join it
+    const auto rolledBack = sqlite3_exec(
+        db_, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr);
+
+    if (SQLITE_OK != rolledBack) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to roll back transaction: "
+              << sqlite3_errstr(rolledBack) << std::endl;
+    }
+
+    return false;
+}
+
+void StorageSqlite3::finalize(std::map<std::string, sqlite3_stmt*>& statements)
+{
+    for (auto& it : statements) { sqlite3_finalize(it.second); }
+
+    statements.clear();
+}
+
+StorageSqlite3::Reader* StorageSqlite3::get_reader() const
+{
+    Lock lock(reader_lock_);
+    const auto limit = static_cast<std::size_t>(
+        std::max<std::int64_t>(1, config_.sqlite3_read_connections_));
+
+    if (idle_readers_.empty() && (readers_.size() < limit)) {
+        const std::string filename = folder_ + "/" + config_.sqlite3_db_file_;
+        std::unique_ptr<Reader> reader{new Reader};
+
+        OT_ASSERT(reader);
+
+        const auto opened = sqlite3_open_v2(
+            filename.c_str(),
+            &reader->db_,
+            SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+            nullptr);
+
+        if (SQLITE_OK == opened) {
+            sqlite3_busy_timeout(
+                reader->db_, static_cast<int>(config_.sqlite3_busy_timeout_));
+            idle_readers_.push_back(reader.get());
+            readers_.emplace_back(std::move(reader));
+        } else {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to open read connection" << std::endl;
+            sqlite3_close(reader->db_);
+
+            if (readers_.empty()) { return nullptr; }
+        }
+    }
+
+    reader_available_.wait(
+        lock, [&]() -> bool { return false == idle_readers_.empty(); });
+    auto* output = idle_readers_.back();
+    idle_readers_.pop_back();
 
     return output;
 }
 
+sqlite3_stmt* StorageSqlite3::get_statement(
+    sqlite3* db,
+    std::map<std::string, sqlite3_stmt*>& cache,
+    const std::string& tablename,
+    const std::string& sql) const
+{
+    auto it = cache.find(tablename);
+
+    if (cache.end() != it) { return it->second; }
+
+    sqlite3_stmt* statement{nullptr};
+    const auto prepared =
+        sqlite3_prepare_v2(db, sql.c_str(), -1, &statement, nullptr);
+
+    if (SQLITE_OK != prepared) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to prepare " << sql
+              << std::endl;
+        sqlite3_finalize(statement);
+
+        return nullptr;
+    }
+
+    cache.emplace(tablename, statement);
+
+    return statement;
+}
+
 std::string StorageSqlite3::GetTableName(const bool bucket) const
 {
     return bucket ? config_.sqlite3_secondary_bucket_
@@ -138,8 +275,14 @@ void StorageSqlite3::Init_StorageSqlite3()
             &db_,
             SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX,
             nullptr)) {
-        sqlite3_exec(
-            db_, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr);
+        const std::string journal =
+            "PRAGMA journal_mode=" + config_.sqlite3_journal_mode_ + ";";
+        const std::string synchronous =
+            "PRAGMA synchronous=" + config_.sqlite3_synchronous_ + ";";
+        sqlite3_exec(db_, journal.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_exec(db_, synchronous.c_str(), nullptr, nullptr, nullptr);
+        sqlite3_busy_timeout(
+            db_, static_cast<int>(config_.sqlite3_busy_timeout_));
         Create(config_.sqlite3_primary_bucket_);
         Create(config_.sqlite3_secondary_bucket_);
         Create(config_.sqlite3_control_table_);
@@ -175,6 +318,13 @@ std::string StorageSqlite3::LoadRoot() const
 bool StorageSqlite3::Purge(const std::string& tablename) const
 {
     const std::string sql = "DROP TABLE `" + tablename + "`;";
+    Lock lock(write_lock_);
+    auto it = upsert_.find(tablename);
+
+    if (upsert_.end() != it) {
+        sqlite3_finalize(it->second);
+        upsert_.erase(it);
+    }
 
     if (SQLITE_OK ==
         sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr)) {
@@ -184,20 +334,38 @@ bool StorageSqlite3::Purge(const std::string& tablename) const
     return false;
 }
 
+void StorageSqlite3::release_reader(Reader* reader) const
+{
+    Lock lock(reader_lock_);
+    idle_readers_.push_back(reader);
+    lock.unlock();
+    reader_available_.notify_one();
+}
+
 bool StorageSqlite3::Select(
     const std::string& key,
     const std::string& tablename,
     std::string& value) const
 {
-    sqlite3_stmt* statement{nullptr};
+    auto* reader = get_reader();
+
+    if (nullptr == reader) { return false; }
+
     const std::string query =
-        "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
-    const auto sql = bind_key(query, key, 1);
-    sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, 0);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(sql).Flush();
+        "SELECT v FROM `" + tablename + "` WHERE k = ?1;";
+    auto* statement =
+        get_statement(reader->db_, reader->select_, tablename, query);
+
+    if (nullptr == statement) {
+        release_reader(reader);
+
+        return false;
+    }
+
+    sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     auto result = sqlite3_step(statement);
     bool success = false;
-    std::size_t retry{3};
+    std::size_t retry{OT_SQLITE_BUSY_RETRIES};
 
     while (0 < retry) {
         switch (result) {
@@ -214,96 +382,27 @@ bool StorageSqlite3::Select(
             } break;
             case SQLITE_BUSY: {
                 otErr << OT_METHOD << __FUNCTION__ << ": Busy" << std::endl;
+                sqlite3_reset(statement);
                 result = sqlite3_step(statement);
                 --retry;
             } break;
             default: {
                 otErr << OT_METHOD << __FUNCTION__ << ": Unknown error ("
                       << result << ")" << std::endl;
+                sqlite3_reset(statement);
                 result = sqlite3_step(statement);
                 --retry;
             }
         }
     }
 
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
+    release_reader(reader);
 
     return success;
 }
 
-void StorageSqlite3::set_data(std::stringstream& sql) const
-{
-    sqlite3_stmt* data{nullptr};
-    std::stringstream dataSQL{};
-    const std::string tablename{GetTableName(transaction_bucket_.get())};
-    dataSQL << "INSERT OR REPLACE INTO '" << tablename << "' (k, v) VALUES ";
-    std::size_t counter{0};
-    const auto size = pending_.size();
-
-    for (std::size_t i = 0; i < size; ++i) {
-        dataSQL << "(?" << ++counter << ", ?";
-        dataSQL << ++counter << ")";
-
-        if (counter < (2 * size)) {
-            dataSQL << ", ";
-        } else {
-            dataSQL << "; ";
-        }
-    }
-
-    sqlite3_prepare_v2(db_, dataSQL.str().c_str(), -1, &data, 0);
-    counter = 0;
-
-    for (const auto& it : pending_) {
-        const auto& key = it.first;
-        const auto& value = it.second;
-        auto bound = sqlite3_bind_text(
-            data, ++counter, key.c_str(), key.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-
-        bound = sqlite3_bind_blob(
-            data, ++counter, value.c_str(), value.size(), SQLITE_STATIC);
-
-        OT_ASSERT(SQLITE_OK == bound);
-    }
-
-    sql << expand_sql(data) << " ";
-    sqlite3_finalize(data);
-}
-
-void StorageSqlite3::set_root(
-    const std::string& rootHash,
-    std::stringstream& sql) const
-{
-    sqlite3_stmt* root{nullptr};
-    std::stringstream rootSQL{};
-    rootSQL << "INSERT OR REPLACE INTO '" << config_.sqlite3_control_table_
-            << "'  (k, v) VALUES (?1, ?2); ";
-    sqlite3_prepare_v2(db_, rootSQL.str().c_str(), -1, &root, 0);
-    auto bound = sqlite3_bind_text(
-        root,
-        1,
-        config_.sqlite3_root_key_.c_str(),
-        config_.sqlite3_root_key_.size(),
-        SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    bound = sqlite3_bind_blob(
-        root, 2, rootHash.c_str(), rootHash.size(), SQLITE_STATIC);
-
-    OT_ASSERT(SQLITE_OK == bound)
-
-    sql << expand_sql(root) << " ";
-    sqlite3_finalize(root);
-}
-
-void StorageSqlite3::start_transaction(std::stringstream& sql) const
-{
-    sql << "BEGIN TRANSACTION; ";
-}
-
 void StorageSqlite3::store(
     const bool isTransaction,
     const std::string& key,
@@ -323,6 +422,53 @@ void StorageSqlite3::store(
     }
 }
 
+void StorageSqlite3::store_batch(const WriteBatch& batch) const
+{
+    std::vector<const Write*> direct{};
+
+    for (const auto& write : batch) {
+        if (write.isTransaction_) {
+            store(
+                true, write.key_, write.value_, write.bucket_, write.promise_);
+        } else {
+            direct.push_back(&write);
+        }
+    }
+
+    if (direct.empty()) { return; }
+
+    // Values not belonging to a storage transaction are written in a single
+    // sqlite transaction
+    Lock lock(write_lock_);
+    bool grouped{1 < direct.size()};
+
+    if (grouped && (false == begin(lock))) {
+        // Each value is then committed on its own, so its result below is
+        // still what reached the database
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to start transaction"
+              << std::endl;
+        grouped = false;
+    }
+
+    std::vector<bool> stored{};
+    stored.reserve(direct.size());
+
+    for (const auto* write : direct) {
+        stored.push_back(upsert(
+            lock, write->key_, GetTableName(write->bucket_), write->value_));
+    }
+
+    bool committed{true};
+
+    if (grouped) { committed = end(lock, true); }
+
+    lock.unlock();
+
+    for (std::size_t i = 0; i < direct.size(); ++i) {
+        direct.at(i)->promise_->set_value(committed && stored.at(i));
+    }
+}
+
 bool StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
 {
     if (commit) {
@@ -340,16 +486,30 @@ bool StorageSqlite3::Upsert(
     const std::string& tablename,
     const std::string& value) const
 {
-    sqlite3_stmt* statement;
+    Lock lock(write_lock_);
+
+    return upsert(lock, key, tablename, value);
+}
+
+bool StorageSqlite3::upsert(
+    const Lock& lock,
+    const std::string& key,
+    const std::string& tablename,
+    const std::string& value) const
+{
+    OT_ASSERT(lock.owns_lock());
+
     const std::string query =
         "insert or replace into `" + tablename + "` (k, v) values (?1, ?2);";
+    auto* statement = get_statement(db_, upsert_, tablename, query);
+
+    if (nullptr == statement) { return false; }
 
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(expand_sql(statement)).Flush();
     const auto result = sqlite3_step(statement);
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return (result == SQLITE_DONE);
 }
@@ -31,40 +31,62 @@ private:
 
     friend Factory;
 
+    /** A connection used only for loading values, with one cached select
+     *  statement per table */
+    struct Reader {
+        sqlite3* db_{nullptr};
+        std::map<std::string, sqlite3_stmt*> select_{};
+    };
+
     std::string folder_;
     mutable std::mutex transaction_lock_;
     mutable OTFlag transaction_bucket_;
     mutable std::vector<std::pair<const std::string, const std::string>>
         pending_;
+    // Protects db_ and upsert_
+    mutable std::mutex write_lock_;
     sqlite3* db_{nullptr};
+    mutable std::map<std::string, sqlite3_stmt*> upsert_;
+    mutable std::mutex reader_lock_;
+    mutable std::condition_variable reader_available_;
+    mutable std::vector<std::unique_ptr<Reader>> readers_;
+    mutable std::vector<Reader*> idle_readers_;
 
-    std::string bind_key(
-        const std::string& source,
-        const std::string& key,
-        const std::size_t start) const;
-    void commit(std::stringstream& sql) const;
+    static void finalize(std::map<std::string, sqlite3_stmt*>& statements);
+
+    bool begin(const Lock& lock) const;
     bool commit_transaction(const std::string& rootHash) const;
     bool Create(const std::string& tablename) const;
-    std::string expand_sql(sqlite3_stmt* statement) const;
+    bool end(const Lock& lock, const bool commit) const;
     std::string GetTableName(const bool bucket) const;
+    Reader* get_reader() const;
+    sqlite3_stmt* get_statement(
+        sqlite3* db,
+        std::map<std::string, sqlite3_stmt*>& cache,
+        const std::string& tablename,
+        const std::string& sql) const;
+    void release_reader(Reader* reader) const;
     bool Select(
         const std::string& key,
         const std::string& tablename,
         std::string& value) const;
     bool Purge(const std::string& tablename) const;
-    void set_data(std::stringstream& sql) const;
-    void set_root(const std::string& rootHash, std::stringstream& sql) const;
-    void start_transaction(std::stringstream& sql) const;
     void store(
         const bool isTransaction,
         const std::string& key,
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const override;
+    void store_batch(const WriteBatch& batch) const override;
     bool Upsert(
         const std::string& key,
         const std::string& tablename,
         const std::string& value) const;
+    bool upsert(
+        const Lock& lock,
+        const std::string& key,
+        const std::string& tablename,
+        const std::string& value) const;
 
     void Init_StorageSqlite3();
 
@@ -122,6 +122,8 @@ protected:
 
             if (Node::BLANK_HASH == hash) { continue; }
 
+            // Each load uses its own view, so nothing the sweep has already
+            // passed stays in memory or pins a read transaction
             if (driver_.LoadProto<T>(hash, serialized, false)) {
                 input(*serialized);
             }
@@ -11,6 +11,9 @@
 
 #include "storage/Plugin.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 #define CURRENT_VERSION 2
 #define TYPE_VERSION 2
 #define INDEX_VERSION 1
@@ -30,6 +33,8 @@ PaymentWorkflows::PaymentWorkflows(
     , workflow_state_map_()
     , type_workflow_map_()
     , state_workflow_map_()
+    , workflow_time_map_()
+    , account_time_map_()
 {
     if (check_hash(hash)) {
         init(hash);
@@ -60,6 +65,16 @@ bool PaymentWorkflows::Delete(const std::string& id)
 {
     Lock lock(write_lock_);
     delete_by_value(id);
+    const auto time = workflow_time_map_.find(id);
+
+    if (workflow_time_map_.end() != time) {
+        for (auto& [account, index] : account_time_map_) {
+            index.erase({time->second, id});
+        }
+
+        workflow_time_map_.erase(time);
+    }
+
     lock.unlock();
 
     return delete_item(id);
@@ -98,6 +113,29 @@ PaymentWorkflows::State PaymentWorkflows::GetState(
     return output;
 }
 
+void PaymentWorkflows::index_time(
+    const Lock& lock,
+    const std::string& workflowID,
+    const std::uint64_t time) const
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    const auto existing = workflow_time_map_.find(workflowID);
+    const bool reindex = (workflow_time_map_.end() != existing);
+
+    for (const auto& [account, workflows] : account_workflow_map_) {
+        if (0 == workflows.count(workflowID)) { continue; }
+
+        auto& index = account_time_map_[account];
+
+        if (reindex) { index.erase({existing->second, workflowID}); }
+
+        index.emplace(time, workflowID);
+    }
+
+    workflow_time_map_[workflowID] = time;
+}
+
 void PaymentWorkflows::init(const std::string& hash)
 {
     std::shared_ptr<proto::StoragePaymentWorkflows> serialized;
@@ -140,6 +178,29 @@ void PaymentWorkflows::init(const std::string& hash)
         const auto& state = it.state();
         add_state_index(lock, workflowID, type, state);
     }
+
+    for (const auto& [workflowID, metadata] : item_map_) {
+        const auto& alias = std::get<1>(metadata);
+
+        if (alias.empty()) { continue; }
+
+        try {
+            index_time(lock, workflowID, std::stoull(alias));
+        } catch (const std::exception&) {
+        }
+    }
+}
+
+std::uint64_t PaymentWorkflows::latest_event(
+    const proto::PaymentWorkflow& workflow)
+{
+    std::uint64_t output{0};
+
+    for (const auto& event : workflow.event()) {
+        output = std::max(output, static_cast<std::uint64_t>(event.time()));
+    }
+
+    return output;
 }
 
 PaymentWorkflows::Workflows PaymentWorkflows::ListByAccount(
@@ -153,6 +214,64 @@ PaymentWorkflows::Workflows PaymentWorkflows::ListByAccount(
     return it->second;
 }
 
+std::vector<std::string> PaymentWorkflows::ListByAccount(
+    const std::string& accountID,
+    const std::size_t start,
+    const std::size_t count) const
+{
+    const auto all = ListByAccount(accountID);
+    Lock lock(write_lock_);
+    std::vector<std::string> untimed{};
+
+    for (const auto& workflowID : all) {
+        if (0 == workflow_time_map_.count(workflowID)) {
+            untimed.emplace_back(workflowID);
+        }
+    }
+
+    lock.unlock();
+
+    for (const auto& workflowID : untimed) {
+        std::shared_ptr<proto::PaymentWorkflow> workflow{};
+
+        if (false == Load(workflowID, workflow, true)) { continue; }
+
+        const auto time = latest_event(*workflow);
+        lock.lock();
+        index_time(lock, workflowID, time);
+        auto it = item_map_.find(workflowID);
+
+        // Written to storage the next time the index is saved
+        if (item_map_.end() != it) {
+            std::get<1>(it->second) = std::to_string(time);
+        }
+
+        lock.unlock();
+    }
+
+    lock.lock();
+    std::vector<std::string> output{};
+    const auto index = account_time_map_.find(accountID);
+
+    if (account_time_map_.end() == index) { return output; }
+
+    std::size_t skipped{0};
+
+    for (auto it = index->second.crbegin(); it != index->second.crend(); ++it) {
+        if (output.size() >= count) { break; }
+
+        if (skipped < start) {
+            ++skipped;
+
+            continue;
+        }
+
+        output.emplace_back(it->second);
+    }
+
+    return output;
+}
+
 PaymentWorkflows::Workflows PaymentWorkflows::ListByUnit(
     const std::string& accountID) const
 {
@@ -338,6 +457,10 @@ bool PaymentWorkflows::Store(
         unit_workflow_map_[unit].emplace(id);
     }
 
+    const auto time = latest_event(data);
+    index_time(lock, id, time);
+    alias = std::to_string(time);
+
     return store_proto(lock, data, id, alias, plaintext);
 }
 }  // namespace opentxs::storage
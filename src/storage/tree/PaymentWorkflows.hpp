@@ -13,6 +13,13 @@
 
 #include "Node.hpp"
 
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace opentxs::storage
 {
 class PaymentWorkflows : public Node
@@ -24,6 +31,12 @@ public:
 
     State GetState(const std::string& workflowID) const;
     Workflows ListByAccount(const std::string& accountID) const;
+    /** Workflows ordered by the time of their most recent event, newest
+     *  first */
+    std::vector<std::string> ListByAccount(
+        const std::string& accountID,
+        const std::size_t start,
+        const std::size_t count) const;
     Workflows ListByState(
         proto::PaymentWorkflowType type,
         proto::PaymentWorkflowState state) const;
@@ -42,6 +55,8 @@ public:
 private:
     friend class Nym;
 
+    using TimeIndex = std::set<std::pair<std::uint64_t, std::string>>;
+
     Workflows archived_;
     std::map<std::string, std::string> item_workflow_map_;
     std::map<std::string, Workflows> account_workflow_map_;
@@ -49,7 +64,18 @@ private:
     std::map<std::string, State> workflow_state_map_;
     std::map<proto::PaymentWorkflowType, Workflows> type_workflow_map_;
     std::map<State, Workflows> state_workflow_map_;
+    // The time of each workflow's most recent event is kept in the alias
+    // field of its index entry. Workflows stored before that was done are
+    // timed when they are first listed by account.
+    mutable std::map<std::string, std::uint64_t> workflow_time_map_;
+    mutable std::map<std::string, TimeIndex> account_time_map_;
+
+    static std::uint64_t latest_event(const proto::PaymentWorkflow& workflow);
 
+    void index_time(
+        const Lock& lock,
+        const std::string& workflowID,
+        const std::uint64_t time) const;
     bool save(const Lock& lock) const override;
     proto::StoragePaymentWorkflows serialize() const;
 
@@ -14,6 +14,11 @@
 #include "storage/Plugin.hpp"
 #include "Mailbox.hpp"
 
+#include <iterator>
+
+#define THREAD_HEAD_VERSION 2
+#define THREAD_PAGE_SIZE 256
+
 #define OT_METHOD "opentxs::storage::Thread::"
 
 namespace opentxs
@@ -33,6 +38,9 @@ Thread::Thread(
     , index_(0)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , pages_()
+    , indexed_(false)
+    , locations_()
     , participants_()
 {
     if (check_hash(hash)) {
@@ -40,6 +48,7 @@ Thread::Thread(
     } else {
         version_ = 1;
         root_ = Node::BLANK_HASH;
+        indexed_ = true;
     }
 }
 
@@ -53,6 +62,9 @@ Thread::Thread(
     , id_(id)
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
+    , pages_()
+    , indexed_(true)
+    , locations_()
     , participants_(participants)
 {
     version_ = 1;
@@ -119,7 +131,7 @@ bool Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
+    proto::StorageThreadItem item{};
     item.set_version(version_);
     item.set_id(id);
 
@@ -136,11 +148,11 @@ bool Thread::Add(
 
     const bool valid = proto::Validate(item, VERBOSE);
 
-    if (!valid) {
-        items_.erase(id);
+    if (!valid) { return false; }
 
-        return false;
-    }
+    // Adding an item which already exists replaces it
+    extract(lock, id, nullptr);
+    insert(lock, item);
 
     return save(lock);
 }
@@ -152,17 +164,147 @@ std::string Thread::Alias() const
     return alias_;
 }
 
+bool Thread::Check(const std::string& id) const
+{
+    Lock lock(write_lock_);
+    index(lock);
+
+    return locations_.end() != locations_.find(id);
+}
+
+void Thread::erase_page(const Lock& lock, const std::size_t page)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    pages_.erase(pages_.begin() + page);
+    indexed_ = false;
+}
+
+bool Thread::extract(
+    const Lock& lock,
+    const std::string& id,
+    proto::StorageThreadItem* output)
+{
+    std::size_t position{0};
+    const auto* item = find(lock, id, position);
+
+    if (nullptr == item) { return false; }
+
+    if (nullptr != output) { *output = *item; }
+
+    auto& page = pages_.at(position);
+    page.items_.erase(get_key(*item));
+    page.dirty_ = true;
+    update_totals(page);
+    locations_.erase(id);
+
+    if (page.items_.empty() && (1 < pages_.size())) {
+        erase_page(lock, position);
+    }
+
+    return true;
+}
+
+proto::StorageThreadItem* Thread::find(
+    const Lock& lock,
+    const std::string& id,
+    std::size_t& page)
+{
+    index(lock);
+    const auto it = locations_.find(id);
+
+    if (locations_.end() == it) { return nullptr; }
+
+    page = it->second;
+
+    for (auto& item : pages_.at(page).items_) {
+        if (id == item.second.id()) { return &item.second; }
+    }
+
+    return nullptr;
+}
+
+Thread::SortKey Thread::get_key(const proto::StorageThreadItem& item)
+{
+    return SortKey{item.index(), item.time(), item.id()};
+}
+
+std::string Thread::ID() const { return id_; }
+
+void Thread::index(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (indexed_) { return; }
+
+    locations_.clear();
+
+    for (std::size_t i = 0; i < pages_.size(); ++i) {
+        const auto& page = load_page(lock, i);
+
+        for (const auto& it : page.items_) { locations_[it.second.id()] = i; }
+    }
+
+    indexed_ = true;
+}
+
 void Thread::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageThread> serialized;
-    driver_.LoadProto(hash, serialized);
+    std::string raw{};
 
-    if (false == bool(serialized)) {
+    if (false == driver_.Load(hash, false, raw)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to load thread index file." << std::endl;
+        OT_FAIL;
+    }
+
+    proto::StorageNymList head{};
+    const bool paged = head.ParseFromArray(raw.data(), raw.size()) &&
+                       proto::Validate(head, SILENT) && is_head(head);
+
+    if (paged) {
+        init_head(head);
+
+        return;
+    }
+
+    // Threads written before pages were introduced are a single object
+    proto::StorageThread serialized{};
+    serialized.ParseFromArray(raw.data(), raw.size());
+
+    if (false == proto::Validate(serialized, VERBOSE)) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Failed to load thread index file." << std::endl;
         OT_FAIL;
     }
 
+    init_legacy(serialized);
+    Lock lock(write_lock_);
+    upgrade(lock);
+}
+
+void Thread::init_head(const proto::StorageNymList& head)
+{
+    for (const auto& it : head.nym()) {
+        const auto& totals = it.alias();
+        const auto split = totals.find(':');
+        Page page{};
+        page.hash_ = it.hash();
+        page.count_ = std::stoull(totals.substr(0, split));
+        page.unread_ = std::stoull(totals.substr(split + 1));
+        pages_.emplace_back(std::move(page));
+    }
+
+    // The participants and thread version are present on every page
+    std::shared_ptr<proto::StorageThread> serialized{};
+    driver_.LoadProto(pages_.back().hash_, serialized);
+
+    if (false == bool(serialized)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load thread page."
+              << std::endl;
+        OT_FAIL;
+    }
+
     version_ = serialized->version();
 
     if (1 > version_) { version_ = 1; }
@@ -171,25 +313,114 @@ void Thread::init(const std::string& hash)
         participants_.emplace(participant);
     }
 
-    for (const auto& it : serialized->item()) {
+    auto& last = pages_.back();
+
+    for (const auto& item : serialized->item()) {
+        last.items_.emplace(get_key(item), item);
+    }
+
+    last.loaded_ = true;
+    Lock lock(write_lock_);
+
+    // The highest index is always on the last non-empty page
+    for (auto i = pages_.size(); i > 0; --i) {
+        const auto& page = load_page(lock, i - 1);
+
+        if (page.items_.empty()) { continue; }
+
+        index_ = std::get<0>(page.items_.rbegin()->first) + 1;
+
+        break;
+    }
+}
+
+void Thread::init_legacy(const proto::StorageThread& serialized)
+{
+    version_ = serialized.version();
+
+    if (1 > version_) { version_ = 1; }
+
+    for (const auto& participant : serialized.participant()) {
+        participants_.emplace(participant);
+    }
+
+    std::set<std::string> ids{};
+    SortedItems sorted{};
+
+    for (const auto& it : serialized.item()) {
         const auto& index = it.index();
-        items_.emplace(it.id(), it);
 
         if (index >= index_) { index_ = index + 1; }
+
+        if (it.id().empty()) { continue; }
+
+        if (ids.emplace(it.id()).second) { sorted.emplace(get_key(it), it); }
     }
 
-    Lock lock(write_lock_);
-    upgrade(lock);
+    for (auto& it : sorted) {
+        if (pages_.empty() ||
+            (THREAD_PAGE_SIZE <= pages_.back().items_.size())) {
+            pages_.emplace_back();
+            pages_.back().loaded_ = true;
+            pages_.back().dirty_ = true;
+        }
+
+        pages_.back().items_.emplace(it.first, std::move(it.second));
+    }
+
+    for (auto& page : pages_) { update_totals(page); }
 }
 
-bool Thread::Check(const std::string& id) const
+void Thread::insert(const Lock& lock, const proto::StorageThreadItem& item)
 {
-    Lock lock(write_lock_);
+    const auto key = get_key(item);
+    tail(lock);
+    auto position = pages_.size() - 1;
+
+    // New items almost always sort after every existing item
+    while (0 < position) {
+        const auto& page = load_page(lock, position);
+
+        if (page.items_.empty() || (page.items_.begin()->first < key)) {
+            break;
+        }
+
+        --position;
+    }
 
-    return items_.end() != items_.find(id);
+    const auto& page = load_page(lock, position);
+    const bool append =
+        page.items_.empty() || (page.items_.rbegin()->first < key);
+    const bool last = (position + 1 == pages_.size());
+
+    if (append && last && (THREAD_PAGE_SIZE <= page.items_.size())) {
+        pages_.emplace_back();
+        pages_.back().loaded_ = true;
+        ++position;
+    }
+
+    auto& target = pages_.at(position);
+    target.items_[key] = item;
+    target.dirty_ = true;
+    update_totals(target);
+
+    if (indexed_) { locations_[item.id()] = position; }
+
+    if (THREAD_PAGE_SIZE < target.items_.size()) { split_page(lock, position); }
 }
 
-std::string Thread::ID() const { return id_; }
+bool Thread::is_head(const proto::StorageNymList& head)
+{
+    if (0 == head.nym_size()) { return false; }
+
+    for (const auto& page : head.nym()) {
+        if (page.itemid() != page.hash()) { return false; }
+
+        if (std::string::npos == page.alias().find(':')) { return false; }
+    }
+
+    return true;
+}
 
 proto::StorageThread Thread::Items() const
 {
@@ -198,27 +429,100 @@ proto::StorageThread Thread::Items() const
     return serialize(lock);
 }
 
+proto::StorageThread Thread::Items(
+    const std::size_t start,
+    const std::size_t count) const
+{
+    Lock lock(write_lock_);
+    auto output = serialize_page(lock, Page{});
+    std::size_t total{0};
+
+    for (const auto& page : pages_) { total += page.count_; }
+
+    if (start >= total) { return output; }
+
+    const auto end = total - start;
+    const auto begin = (end > count) ? (end - count) : 0;
+    std::size_t offset{0};
+
+    for (std::size_t i = 0; i < pages_.size(); ++i) {
+        const auto first = offset;
+        offset += pages_.at(i).count_;
+
+        if (offset <= begin) { continue; }
+
+        if (first >= end) { break; }
+
+        const auto& page = load_page(lock, i);
+        auto position = first;
+
+        for (const auto& it : page.items_) {
+            if ((position >= begin) && (position < end)) {
+                *output.add_item() = it.second;
+            }
+
+            ++position;
+        }
+    }
+
+    return output;
+}
+
+Thread::Page& Thread::load_page(const Lock& lock, const std::size_t page) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& output = pages_.at(page);
+
+    if (output.loaded_) { return output; }
+
+    std::shared_ptr<proto::StorageThread> serialized{};
+    driver_.LoadProto(output.hash_, serialized);
+
+    if (false == bool(serialized)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load thread page."
+              << std::endl;
+        OT_FAIL;
+    }
+
+    for (const auto& item : serialized->item()) {
+        output.items_.emplace(get_key(item), item);
+    }
+
+    output.loaded_ = true;
+
+    return output;
+}
+
 bool Thread::Migrate(const opentxs::api::storage::Driver& to) const
 {
-    return Node::migrate(root_, to);
+    Lock lock(write_lock_);
+    bool output{true};
+
+    for (const auto& page : pages_) { output &= Node::migrate(page.hash_, to); }
+
+    output &= Node::migrate(root_, to);
+
+    return output;
 }
 
 bool Thread::Read(const std::string& id, const bool unread)
 {
     Lock lock(write_lock_);
+    std::size_t position{0};
+    auto* item = find(lock, id, position);
 
-    auto it = items_.find(id);
-
-    if (items_.end() == it) {
+    if (nullptr == item) {
         otErr << OT_METHOD << __FUNCTION__ << ": Item does not exist."
               << std::endl;
 
         return false;
     }
 
-    auto& item = it->second;
-
-    item.set_unread(unread);
+    item->set_unread(unread);
+    auto& page = pages_.at(position);
+    page.dirty_ = true;
+    update_totals(page);
 
     return save(lock);
 }
@@ -226,14 +530,11 @@ bool Thread::Read(const std::string& id, const bool unread)
 bool Thread::Remove(const std::string& id)
 {
     Lock lock(write_lock_);
+    proto::StorageThreadItem item{};
 
-    auto it = items_.find(id);
+    if (false == extract(lock, id, &item)) { return false; }
 
-    if (items_.end() == it) { return false; }
-
-    auto& item = it->second;
     StorageBox box = static_cast<StorageBox>(item.box());
-    items_.erase(it);
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -262,6 +563,11 @@ bool Thread::Rename(const std::string& newID)
         participants_.emplace(newID);
     }
 
+    // Every page contains the thread id and participants
+    index(lock);
+
+    for (auto& page : pages_) { page.dirty_ = true; }
+
     return save(lock);
 }
 
@@ -269,14 +575,59 @@ bool Thread::save(const Lock& lock) const
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
+    tail(lock);
+
+    for (auto& page : pages_) {
+        if (false == page.dirty_) { continue; }
+
+        const auto serialized = serialize_page(lock, page);
 
-    if (!proto::Validate(serialized, VERBOSE)) { return false; }
+        if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+        if (!driver_.StoreProto(serialized, page.hash_)) { return false; }
+
+        page.dirty_ = false;
+    }
+
+    const auto head = serialize_head(lock);
+
+    if (!proto::Validate(head, VERBOSE)) { return false; }
+
+    return driver_.StoreProto(head, root_);
 }
 
 proto::StorageThread Thread::serialize(const Lock& lock) const
+{
+    auto serialized = serialize_page(lock, Page{});
+
+    for (std::size_t i = 0; i < pages_.size(); ++i) {
+        const auto& page = load_page(lock, i);
+
+        for (const auto& it : page.items_) { *serialized.add_item() = it.second; }
+    }
+
+    return serialized;
+}
+
+proto::StorageNymList Thread::serialize_head(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    proto::StorageNymList serialized;
+    serialized.set_version(THREAD_HEAD_VERSION);
+
+    for (const auto& page : pages_) {
+        auto& item = *serialized.add_nym();
+        set_hash(THREAD_HEAD_VERSION, page.hash_, page.hash_, item);
+        item.set_alias(
+            std::to_string(page.count_) + ":" + std::to_string(page.unread_));
+    }
+
+    return serialized;
+}
+
+proto::StorageThread Thread::serialize_page(const Lock& lock, const Page& page)
+    const
 {
     OT_ASSERT(verify_write_lock(lock));
 
@@ -288,14 +639,7 @@ proto::StorageThread Thread::serialize(const Lock& lock) const
         if (!nym.empty()) { *serialized.add_participant() = nym; }
     }
 
-    auto sorted = sort(lock);
-
-    for (const auto& it : sorted) {
-        OT_ASSERT(nullptr != it.second);
-
-        const auto& item = *it.second;
-        *serialized.add_item() = item;
-    }
+    for (const auto& it : page.items_) { *serialized.add_item() = it.second; }
 
     return serialized;
 }
@@ -309,23 +653,44 @@ bool Thread::SetAlias(const std::string& alias)
     return true;
 }
 
-Thread::SortedItems Thread::sort(const Lock& lock) const
+std::size_t Thread::Size() const
 {
-    OT_ASSERT(verify_write_lock(lock));
+    Lock lock(write_lock_);
+    std::size_t output{0};
 
-    SortedItems output;
+    for (const auto& page : pages_) { output += page.count_; }
 
-    for (const auto& it : items_) {
-        const auto& id = it.first;
-        const auto& item = it.second;
+    return output;
+}
 
-        if (!id.empty()) {
-            SortKey key{item.index(), item.time(), id};
-            output.emplace(key, &item);
-        }
+void Thread::split_page(const Lock& lock, const std::size_t page)
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& lower = pages_.at(page);
+    Page upper{};
+    upper.loaded_ = true;
+    upper.dirty_ = true;
+    auto middle = lower.items_.begin();
+    std::advance(middle, lower.items_.size() / 2);
+    upper.items_.insert(middle, lower.items_.end());
+    lower.items_.erase(middle, lower.items_.end());
+    lower.dirty_ = true;
+    update_totals(lower);
+    update_totals(upper);
+    pages_.insert(pages_.begin() + page + 1, std::move(upper));
+    indexed_ = false;
+}
+
+Thread::Page& Thread::tail(const Lock& lock) const
+{
+    if (pages_.empty()) {
+        pages_.emplace_back();
+        pages_.back().loaded_ = true;
+        pages_.back().dirty_ = true;
     }
 
-    return output;
+    return load_page(lock, pages_.size() - 1);
 }
 
 std::size_t Thread::UnreadCount() const
@@ -333,36 +698,49 @@ std::size_t Thread::UnreadCount() const
     Lock lock(write_lock_);
     std::size_t output{0};
 
-    for (const auto& it : items_) {
-        const auto& item = it.second;
-
-        if (item.unread()) { ++output; }
-    }
+    for (const auto& page : pages_) { output += page.unread_; }
 
     return output;
 }
 
+void Thread::update_totals(Page& page)
+{
+    page.count_ = page.items_.size();
+    page.unread_ = 0;
+
+    for (const auto& it : page.items_) {
+        if (it.second.unread()) { ++page.unread_; }
+    }
+}
+
 void Thread::upgrade(const Lock& lock)
 {
     OT_ASSERT(verify_write_lock(lock));
 
     bool changed{false};
 
-    for (auto& it : items_) {
-        auto& item = it.second;
-        const auto box = static_cast<StorageBox>(item.box());
-
-        switch (box) {
-            case StorageBox::MAILOUTBOX:
-            case StorageBox::OUTGOINGBLOCKCHAIN: {
-                if (item.unread()) {
-                    item.set_unread(false);
-                    changed = true;
+    for (auto& page : pages_) {
+        if (false == page.loaded_) { continue; }
+
+        for (auto& it : page.items_) {
+            auto& item = it.second;
+            const auto box = static_cast<StorageBox>(item.box());
+
+            switch (box) {
+                case StorageBox::MAILOUTBOX:
+                case StorageBox::OUTGOINGBLOCKCHAIN: {
+                    if (item.unread()) {
+                        item.set_unread(false);
+                        page.dirty_ = true;
+                        changed = true;
+                    }
+                } break;
+                default: {
                 }
-            } break;
-            default: {
             }
         }
+
+        update_totals(page);
     }
 
     if (changed) { save(lock); }
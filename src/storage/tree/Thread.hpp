@@ -16,6 +16,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace opentxs
 {
@@ -30,23 +31,65 @@ class Thread : public Node
 private:
     friend class Threads;
     typedef std::tuple<std::size_t, std::int64_t, std::string> SortKey;
-    typedef std::map<SortKey, const proto::StorageThreadItem*> SortedItems;
+    typedef std::map<SortKey, proto::StorageThreadItem> SortedItems;
+
+    /** A contiguous range of thread items, stored as a separate object
+     *
+     *  The count and unread totals are recorded in the head so they are
+     *  available without loading the page.
+     */
+    struct Page {
+        std::string hash_{};
+        std::size_t count_{0};
+        std::size_t unread_{0};
+        bool loaded_{false};
+        bool dirty_{false};
+        SortedItems items_{};
+    };
 
     std::string id_;
     std::string alias_;
     std::size_t index_{0};
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    // Items in sort order, split into pages of at most THREAD_PAGE_SIZE items.
+    // Pages are loaded on demand.
+    mutable std::vector<Page> pages_;
+    // Maps item id to page number. Only valid when indexed_ is true.
+    mutable bool indexed_{false};
+    mutable std::map<std::string, std::size_t> locations_;
 
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
 
-    void init(const std::string& hash) override;
+    static SortKey get_key(const proto::StorageThreadItem& item);
+    static bool is_head(const proto::StorageNymList& head);
+    static void update_totals(Page& page);
+
+    void index(const Lock& lock) const;
+    Page& load_page(const Lock& lock, const std::size_t page) const;
+    Page& tail(const Lock& lock) const;
     bool save(const Lock& lock) const override;
     proto::StorageThread serialize(const Lock& lock) const;
-    SortedItems sort(const Lock& lock) const;
+    proto::StorageNymList serialize_head(const Lock& lock) const;
+    proto::StorageThread serialize_page(const Lock& lock, const Page& page)
+        const;
+
+    void erase_page(const Lock& lock, const std::size_t page);
+    bool extract(
+        const Lock& lock,
+        const std::string& id,
+        proto::StorageThreadItem* output);
+    void init(const std::string& hash) override;
+    void init_head(const proto::StorageNymList& head);
+    void init_legacy(const proto::StorageThread& serialized);
+    void insert(const Lock& lock, const proto::StorageThreadItem& item);
+    proto::StorageThreadItem* find(
+        const Lock& lock,
+        const std::string& id,
+        std::size_t& page);
+    void split_page(const Lock& lock, const std::size_t page);
     void upgrade(const Lock& lock);
 
     Thread(
@@ -73,6 +116,15 @@ public:
     bool Check(const std::string& id) const;
     std::string ID() const;
     proto::StorageThread Items() const;
+    /** Load a range of items without loading the entire thread
+     *
+     *  \param[in] start number of items to skip, counting back from the most
+     *                   recent item
+     *  \param[in] count maximum number of items to return
+     */
+    proto::StorageThread Items(const std::size_t start, const std::size_t count)
+        const;
+    std::size_t Size() const;
     bool Migrate(const opentxs::api::storage::Driver& to) const override;
     std::size_t UnreadCount() const;
 
@@ -43,6 +43,8 @@
 
 #include "AccountActivity.hpp"
 
+#define DEFAULT_WINDOW 50
+
 #define OT_METHOD "opentxs::ui::implementation::AccountActivity::"
 
 namespace opentxs
@@ -77,6 +79,7 @@ AccountActivity::AccountActivity(
     , balance_(0)
     , account_id_(accountID)
     , contract_(nullptr)
+    , window_(DEFAULT_WINDOW)
 {
     init();
     setup_listeners(listeners_);
@@ -117,239 +120,27 @@ std::string AccountActivity::DisplayBalance() const
     return {};
 }
 
-AccountActivity::EventRow AccountActivity::extract_event(
-    const proto::PaymentEventType eventType,
-    const proto::PaymentWorkflow& workflow)
+void AccountActivity::load_window()
 {
-    bool success{false};
-    bool found{false};
-    EventRow output{};
-    auto& [time, event_p] = output;
-
-    for (const auto& event : workflow.event()) {
-        const auto eventTime =
-            std::chrono::system_clock::from_time_t(event.time());
-
-        if (eventType != event.type()) { continue; }
-
-        if (eventTime > time) {
-            if (success) {
-                if (event.success()) {
-                    time = eventTime;
-                    event_p = &event;
-                    found = true;
-                }
-            } else {
-                time = eventTime;
-                event_p = &event;
-                success = event.success();
-                found = true;
-            }
-        } else {
-            if (false == success) {
-                if (event.success()) {
-                    // This is a weird case. It probably shouldn't happen
-                    time = eventTime;
-                    event_p = &event;
-                    success = true;
-                    found = true;
-                }
-            }
-        }
-    }
+    // Workflows are read newest first until the window is full. A workflow
+    // may produce more than one row, so the excess is trimmed afterwards.
+    const auto count = window_.load();
+    std::set<AccountActivityRowID> active{};
+    std::size_t start{0};
 
-    if (false == found) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Workflow ")(workflow.id())(
-            ", type ")(workflow.type())(", state ")(workflow.state())(
-            " does not contain an event of type ")(eventType)
-            .Flush();
+    while (active.size() < count) {
+        const auto workflows = api_.Workflow().WorkflowsByAccount(
+            nym_id_, account_id_, start, count);
 
-        OT_FAIL;
-    }
+        if (workflows.empty()) { break; }
 
-    return output;
-}
+        for (const auto& id : workflows) { process_workflow(id, active); }
 
-std::vector<AccountActivity::RowKey> AccountActivity::extract_rows(
-    const proto::PaymentWorkflow& workflow)
-{
-    std::vector<AccountActivity::RowKey> output;
-
-    switch (workflow.type()) {
-        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGCHEQUE: {
-            switch (workflow.state()) {
-                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
-                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
-                case proto::PAYMENTWORKFLOWSTATE_EXPIRED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CREATE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_CANCELLED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CREATE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CANCEL,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CANCEL, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
-                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CREATE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CREATE, workflow));
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACCEPT,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACCEPT, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ERROR:
-                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
-                default: {
-                    LogOutput(OT_METHOD)(__FUNCTION__)(
-                        ": Invalid workflow state (")(workflow.state())(")")
-                        .Flush();
-                }
-            }
-        } break;
-        case proto::PAYMENTWORKFLOWTYPE_INCOMINGCHEQUE: {
-            switch (workflow.state()) {
-                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
-                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
-                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CONVEY,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ERROR:
-                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
-                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
-                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
-                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
-                default: {
-                    LogOutput(OT_METHOD)(__FUNCTION__)(
-                        ": Invalid workflow state (")(workflow.state())(")")
-                        .Flush();
-                }
-            }
-        } break;
-        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGTRANSFER: {
-            switch (workflow.state()) {
-                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
-                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_COMPLETE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_COMPLETE, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
-                case proto::PAYMENTWORKFLOWSTATE_ABORTED: {
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ERROR:
-                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
-                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
-                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
-                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
-                default: {
-                    LogOutput(OT_METHOD)(__FUNCTION__)(
-                        ": Invalid workflow state (")(workflow.state())(")")
-                        .Flush();
-                }
-            }
-        } break;
-        case proto::PAYMENTWORKFLOWTYPE_INCOMINGTRANSFER: {
-            switch (workflow.state()) {
-                case proto::PAYMENTWORKFLOWSTATE_CONVEYED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CONVEY,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_CONVEY,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_CONVEY, workflow));
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACCEPT,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACCEPT, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ERROR:
-                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
-                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
-                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED:
-                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
-                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
-                case proto::PAYMENTWORKFLOWSTATE_ABORTED:
-                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
-                default: {
-                    LogOutput(OT_METHOD)(__FUNCTION__)(
-                        ": Invalid workflow state (")(workflow.state())(")")
-                        .Flush();
-                }
-            }
-        } break;
-        case proto::PAYMENTWORKFLOWTYPE_INTERNALTRANSFER: {
-            switch (workflow.state()) {
-                case proto::PAYMENTWORKFLOWSTATE_ACKNOWLEDGED:
-                case proto::PAYMENTWORKFLOWSTATE_CONVEYED:
-                case proto::PAYMENTWORKFLOWSTATE_ACCEPTED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_COMPLETED: {
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_ACKNOWLEDGE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_ACKNOWLEDGE, workflow));
-                    output.emplace_back(
-                        proto::PAYMENTEVENTTYPE_COMPLETE,
-                        extract_event(
-                            proto::PAYMENTEVENTTYPE_COMPLETE, workflow));
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_INITIATED:
-                case proto::PAYMENTWORKFLOWSTATE_ABORTED: {
-                } break;
-                case proto::PAYMENTWORKFLOWSTATE_ERROR:
-                case proto::PAYMENTWORKFLOWSTATE_UNSENT:
-                case proto::PAYMENTWORKFLOWSTATE_CANCELLED:
-                case proto::PAYMENTWORKFLOWSTATE_EXPIRED:
-                default: {
-                    LogOutput(OT_METHOD)(__FUNCTION__)(
-                        ": Invalid workflow state (")(workflow.state())(")")
-                        .Flush();
-                }
-            }
-        } break;
-        case proto::PAYMENTWORKFLOWTYPE_ERROR:
-        case proto::PAYMENTWORKFLOWTYPE_OUTGOINGINVOICE:
-        case proto::PAYMENTWORKFLOWTYPE_INCOMINGINVOICE:
-        default: {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Unsupported workflow type (")(
-                workflow.type())(")")
-                .Flush();
-        }
+        start += workflows.size();
     }
 
-    return output;
+    delete_inactive(active);
+    trim(count);
 }
 
 void AccountActivity::process_balance(
@@ -379,7 +170,7 @@ void AccountActivity::process_workflow(
 
     OT_ASSERT(workflow)
 
-    const auto rows = extract_rows(*workflow);
+    const auto rows = api::client::Workflow::ExtractActivity(*workflow);
 
     for (const auto& [type, row] : rows) {
         const auto& [time, event_p] = row;
@@ -395,14 +186,37 @@ void AccountActivity::process_workflow(const network::zeromq::Message& message)
 {
     wait_for_startup();
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(0 < message.Body().size());
 
     const std::string id(*message.Body().begin());
     const auto accountID = Identifier::Factory(id);
 
     OT_ASSERT(false == accountID->empty())
 
-    if (account_id_ == accountID) { startup(); }
+    if (account_id_ != accountID) { return; }
+
+    if (2 > message.Body().size()) {
+        startup();
+
+        return;
+    }
+
+    // Only the rows for the workflow which changed need to be updated
+    const auto workflowID =
+        Identifier::Factory(std::string(message.Body().at(1)));
+    std::set<AccountActivityRowID> active{};
+    process_workflow(workflowID, active);
+    delete_inactive(active, [&](const AccountActivityRowID& row) -> bool {
+        return row.first == workflowID;
+    });
+    trim(window_.load());
+}
+
+void AccountActivity::SetWindow(const std::size_t count) const
+{
+    window_.store(count);
+    wait_for_startup();
+    const_cast<AccountActivity&>(*this).load_window();
 }
 
 void AccountActivity::startup()
@@ -418,13 +232,7 @@ void AccountActivity::startup()
     }
 
     account.Release();
-    const auto workflows =
-        api_.Workflow().WorkflowsByAccount(nym_id_, account_id_);
-    std::set<AccountActivityRowID> active{};
-
-    for (const auto& id : workflows) { process_workflow(id, active); }
-
-    delete_inactive(active);
+    load_window();
     startup_complete_->On();
 }
 }  // namespace opentxs::ui::implementation
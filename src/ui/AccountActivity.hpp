@@ -40,32 +40,25 @@ public:
     const Identifier& AccountID() const override { return account_id_.get(); }
     Amount Balance() const override { return balance_.load(); }
     std::string DisplayBalance() const override;
+    void SetWindow(const std::size_t count) const override;
 
     ~AccountActivity() = default;
 
 private:
     friend opentxs::Factory;
 
-    using EventRow =
-        std::pair<AccountActivitySortKey, const proto::PaymentEvent*>;
-    using RowKey = std::pair<proto::PaymentEventType, EventRow>;
-
     const ListenerDefinitions listeners_;
     mutable std::atomic<Amount> balance_{0};
     const OTIdentifier account_id_;
     std::shared_ptr<const UnitDefinition> contract_{nullptr};
-
-    static EventRow extract_event(
-        const proto::PaymentEventType event,
-        const proto::PaymentWorkflow& workflow);
-    static std::vector<RowKey> extract_rows(
-        const proto::PaymentWorkflow& workflow);
+    mutable std::atomic<std::size_t> window_;
 
     void construct_row(
         const AccountActivityRowID& id,
         const AccountActivitySortKey& index,
         const CustomData& custom) const override;
 
+    void load_window();
     void process_balance(const network::zeromq::Message& message);
     void process_workflow(
         const Identifier& workflowID,
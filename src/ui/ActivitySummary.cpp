@@ -163,7 +163,7 @@ void ActivitySummary::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(0 < message.Body().size());
 
     const std::string id(*message.Body().begin());
     const auto threadID = Identifier::Factory(id);
@@ -9,6 +9,7 @@
 #include "opentxs/api/client/Contacts.hpp"
 #include "opentxs/api/client/Manager.hpp"
 #include "opentxs/api/client/Sync.hpp"
+#include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/contact/Contact.hpp"
 #include "opentxs/contact/ContactData.hpp"
 #include "opentxs/core/Flag.hpp"
@@ -30,6 +31,7 @@
 #include "InternalUI.hpp"
 #include "List.hpp"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -42,6 +44,9 @@
 template class std::
     tuple<opentxs::OTIdentifier, opentxs::StorageBox, opentxs::OTIdentifier>;
 
+#define DEFAULT_WINDOW 50
+#define RECENT_ITEMS 32
+
 #define OT_METHOD "opentxs::ui::implementation::ActivityThread::"
 
 namespace opentxs
@@ -75,6 +80,7 @@ ActivityThread::ActivityThread(
     , draft_tasks_()
     , contact_(nullptr)
     , contact_thread_(nullptr)
+    , window_(DEFAULT_WINDOW)
 {
     init();
     setup_listeners(listeners_);
@@ -264,6 +270,19 @@ void ActivityThread::load_thread(const proto::StorageThread& thread)
     startup_complete_->On();
 }
 
+std::shared_ptr<proto::StorageThread> ActivityThread::load_window() const
+{
+    const auto count = window_.load();
+    api_.Activity().PreloadThread(nym_id_, threadID_, 0, count);
+    std::shared_ptr<proto::StorageThread> output{};
+    const auto loaded = api_.Storage().Load(
+        nym_id_->str(), threadID_->str(), 0, count, output);
+
+    if (false == loaded) { return {}; }
+
+    return output;
+}
+
 void ActivityThread::new_thread()
 {
     participants_.emplace(threadID_);
@@ -305,12 +324,39 @@ ActivityThreadRowID ActivityThread::process_item(
     return id;
 }
 
+bool ActivityThread::process_new_item(const std::string& itemID)
+{
+    // New items are nearly always the most recent ones, so only the newest
+    // page of the thread needs to be read to find them.
+    std::shared_ptr<proto::StorageThread> recent{};
+    const auto loaded = api_.Storage().Load(
+        nym_id_->str(), threadID_->str(), 0, RECENT_ITEMS, recent);
+
+    if (false == loaded) { return false; }
+
+    OT_ASSERT(recent)
+
+    for (const auto& item : recent->item()) {
+        if (item.id() == itemID) {
+            process_item(item);
+
+            return true;
+        }
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Item ")(itemID)(
+        " is not among the most recent items.")
+        .Flush();
+
+    return false;
+}
+
 void ActivityThread::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
     check_drafts();
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(0 < message.Body().size());
 
     const std::string id(*message.Body().begin());
     const auto threadID = Identifier::Factory(id);
@@ -319,18 +365,36 @@ void ActivityThread::process_thread(const network::zeromq::Message& message)
 
     if (threadID_ != threadID) { return; }
 
-    const auto thread = api_.Activity().Thread(nym_id_, threadID_);
+    if (1 < message.Body().size()) {
+        const std::string itemID(message.Body().at(1));
+
+        if (process_new_item(itemID)) {
+            trim(window_.load());
+
+            return;
+        }
+    }
+
+    const auto thread = load_window();
 
     OT_ASSERT(thread)
 
+    reload(*thread);
+}
+
+void ActivityThread::reload(const proto::StorageThread& thread)
+{
     std::set<ActivityThreadRowID> active{};
 
-    for (const auto& item : thread->item()) {
+    for (const auto& item : thread.item()) {
         const auto id = process_item(item);
         active.emplace(id);
     }
 
-    delete_inactive(active);
+    // Pending sends are removed by check_drafts once they are delivered
+    delete_inactive(active, [](const ActivityThreadRowID& id) -> bool {
+        return StorageBox::DRAFT != std::get<1>(id);
+    });
 }
 
 bool ActivityThread::same(
@@ -403,9 +467,23 @@ bool ActivityThread::SetDraft(const std::string& draft) const
     return true;
 }
 
+void ActivityThread::SetWindow(const std::size_t count) const
+{
+    window_.store(count);
+    wait_for_startup();
+    const auto thread = load_window();
+
+    if (false == bool(thread)) { return; }
+
+    const_cast<ActivityThread&>(*this).reload(*thread);
+    trim(count);
+}
+
 void ActivityThread::startup()
 {
-    const auto thread = api_.Activity().Thread(nym_id_, threadID_);
+    // Only the most recent items are loaded, so startup time does not depend
+    // on the length of the thread
+    const auto thread = load_window();
 
     if (thread) {
         load_thread(*thread);
@@ -73,6 +73,7 @@ public:
         const override;
     bool SendDraft() const override;
     bool SetDraft(const std::string& draft) const override;
+    void SetWindow(const std::size_t count) const override;
     std::string ThreadID() const override;
 
     ~ActivityThread();
@@ -89,6 +90,7 @@ private:
     mutable std::set<ActivityThreadRowID> draft_tasks_;
     std::shared_ptr<const opentxs::Contact> contact_;
     std::unique_ptr<std::thread> contact_thread_{nullptr};
+    mutable std::atomic<std::size_t> window_;
 
     bool check_draft(const ActivityThreadRowID& id) const;
     void check_drafts() const;
@@ -97,12 +99,15 @@ private:
         const ActivityThreadRowID& id,
         const ActivityThreadSortKey& index,
         const CustomData& custom) const override;
+    std::shared_ptr<proto::StorageThread> load_window() const;
 
     void init_contact();
     void load_thread(const proto::StorageThread& thread);
     void new_thread();
     ActivityThreadRowID process_item(const proto::StorageThreadItem& item);
+    bool process_new_item(const std::string& itemID);
     void process_thread(const network::zeromq::Message& message);
+    void reload(const proto::StorageThread& thread);
     void startup();
 
     ActivityThread(
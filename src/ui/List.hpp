@@ -164,6 +164,31 @@ protected:
 
         UpdateNotify();
     }
+    /** Removes the rows accepted by select which are not in active. Rows
+     *  which are not selected are left alone, so a single changed object can
+     *  be applied without rebuilding the list. */
+    template <typename Select>
+    void delete_inactive(
+        const std::set<RowID>& active,
+        const Select& select) const
+    {
+        Lock lock(lock_);
+        std::vector<RowID> deleteIDs{};
+
+        for (const auto& it : names_) {
+            const auto& id = it.first;
+
+            if (select(id) && (0 == active.count(id))) {
+                deleteIDs.emplace_back(id);
+            }
+        }
+
+        if (deleteIDs.empty()) { return; }
+
+        for (const auto& id : deleteIDs) { delete_item(lock, id); }
+
+        UpdateNotify();
+    }
     void delete_item(const Lock& lock, const RowID& id) const
     {
         OT_ASSERT(verify_lock(lock))
@@ -361,6 +386,31 @@ protected:
     {
         return (lhs == rhs);
     }
+    /** Removes rows from the low end of the sort order until no more than
+     *  limit remain. For time ordered lists this drops the oldest rows. */
+    void trim(const std::size_t limit) const
+    {
+        Lock lock(lock_);
+
+        if (names_.size() <= limit) { return; }
+
+        auto excess = names_.size() - limit;
+        std::vector<RowID> deleteIDs{};
+
+        for (auto outer = items_.cbegin(); 0 < excess; ++outer) {
+            OT_ASSERT(items_.cend() != outer)
+
+            for (auto inner = outer->second.cbegin();
+                 (outer->second.cend() != inner) && (0 < excess);
+                 ++inner, --excess) {
+                deleteIDs.emplace_back(inner->first);
+            }
+        }
+
+        for (const auto& id : deleteIDs) { delete_item(lock, id); }
+
+        UpdateNotify();
+    }
     void valid_iterators() const
     {
         OT_ASSERT(outer_end() != outer_)
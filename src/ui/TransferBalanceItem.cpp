@@ -283,7 +283,7 @@ std::string TransferBalanceItem::UUID() const
 {
     if (transfer_) {
 
-        return uuid(
+        return api::client::Workflow::UUID(
             transfer_->GetPurportedNotaryID(), transfer_->GetTransactionNum());
     }
 
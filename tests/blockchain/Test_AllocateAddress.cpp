@@ -667,4 +667,57 @@ TEST_F(Test_AllocateAddress, testBip44_SeedC)
             .c_str(),
         "LMoZuWNnoTEJ1FjxQ4NXTcNbMK3croGpaF");
 }
+
+TEST_F(Test_AllocateAddress, testAllocateAddresses)
+{
+    const auto Dave = client_.Exec().CreateNymHD(
+        proto::CITEMTYPE_INDIVIDUAL, "Dave", SeedB_, 1);
+    const auto nymID = Identifier::Factory(Dave);
+    const auto AccountID = client_.Blockchain().NewAccount(
+        nymID,
+        BlockchainAccountType::BIP32,
+        static_cast<proto::ContactItemType>(proto::CITEMTYPE_BTC));
+
+    EXPECT_TRUE(client_.Blockchain()
+                    .AllocateAddresses(nymID, AccountID, 0, EXTERNAL_CHAIN)
+                    .empty());
+
+    const auto Addresses = client_.Blockchain().AllocateAddresses(
+        nymID, AccountID, 1000, EXTERNAL_CHAIN);
+
+    ASSERT_EQ(1000u, Addresses.size());
+
+    std::set<std::string> unique{};
+
+    for (std::uint32_t i = 0; i < Addresses.size(); ++i) {
+        const auto& address = Addresses.at(i);
+
+        EXPECT_EQ(i, address.index());
+        EXPECT_FALSE(address.address().empty());
+
+        unique.emplace(address.address());
+    }
+
+    EXPECT_EQ(Addresses.size(), unique.size());
+
+    const auto Account = client_.Blockchain().Account(nymID, AccountID);
+
+    ASSERT_TRUE(Account);
+    EXPECT_EQ(1000u, Account->externalindex());
+    EXPECT_EQ(0u, Account->internalindex());
+
+    const auto Loaded = client_.Blockchain().LoadAddress(
+        nymID, AccountID, 517, EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(Loaded);
+    EXPECT_STREQ(
+        Addresses.at(517).address().c_str(), Loaded->address().c_str());
+
+    const auto Next = client_.Blockchain().AllocateAddress(
+        nymID, AccountID, "Deposit", EXTERNAL_CHAIN);
+
+    ASSERT_TRUE(Next);
+    EXPECT_EQ(1000u, Next->index());
+    EXPECT_EQ(0u, unique.count(Next->address()));
+}
 }  // namespace
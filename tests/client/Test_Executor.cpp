@@ -0,0 +1,297 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "api/Executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_Executor : public ::testing::Test
+{
+public:
+    using Executor = opentxs::api::implementation::Executor;
+
+    // Holds every run of a task until released
+    class Gate
+    {
+    public:
+        std::atomic<int> entered_{0};
+
+        void Enter()
+        {
+            ++entered_;
+            Lock lock(lock_);
+            cv_.wait(lock, [&]() -> bool { return open_; });
+        }
+
+        void Open()
+        {
+            Lock lock(lock_);
+            open_ = true;
+            lock.unlock();
+            cv_.notify_all();
+        }
+
+    private:
+        std::mutex lock_{};
+        std::condition_variable cv_{};
+        bool open_{false};
+    };
+
+    static bool wait_for(const std::atomic<int>& value, const int target)
+    {
+        const auto end =
+            std::chrono::steady_clock::now() + std::chrono::seconds(15);
+
+        while (value.load() < target) {
+            if (std::chrono::steady_clock::now() > end) { return false; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    static void settle()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+};
+
+TEST_F(Test_Executor, wake_while_running_runs_once_more)
+{
+    Gate gate{};
+    Executor executor(4);
+    std::atomic<int> finished{0};
+    const auto id = executor.Add([&]() -> void {
+        gate.Enter();
+        ++finished;
+    });
+
+    ASSERT_NE(-1, id);
+    ASSERT_TRUE(executor.Wake(id));
+    ASSERT_TRUE(wait_for(gate.entered_, 1));
+
+    // Several wakes during a run collapse into a single further run, which
+    // never overlaps the current one despite the idle workers
+    EXPECT_TRUE(executor.Wake(id));
+    EXPECT_TRUE(executor.Wake(id));
+    EXPECT_TRUE(executor.Wake(id));
+    settle();
+
+    EXPECT_EQ(1, gate.entered_.load());
+
+    gate.Open();
+
+    ASSERT_TRUE(wait_for(finished, 2));
+
+    settle();
+
+    EXPECT_EQ(2, gate.entered_.load());
+    EXPECT_EQ(2, finished.load());
+}
+
+TEST_F(Test_Executor, schedule_while_running)
+{
+    Gate gate{};
+    Executor executor(2);
+    std::atomic<int> finished{0};
+    const auto id = executor.Add([&]() -> void {
+        gate.Enter();
+        ++finished;
+    });
+
+    ASSERT_TRUE(executor.Wake(id));
+    ASSERT_TRUE(wait_for(gate.entered_, 1));
+
+    // The deadline passes while the first run is still going
+    EXPECT_TRUE(executor.Schedule(id, std::chrono::milliseconds(10)));
+    settle();
+
+    EXPECT_EQ(1, gate.entered_.load());
+
+    gate.Open();
+
+    ASSERT_TRUE(wait_for(finished, 2));
+
+    settle();
+
+    EXPECT_EQ(2, finished.load());
+}
+
+TEST_F(Test_Executor, task_reschedules_itself)
+{
+    Executor executor(2);
+    std::atomic<int> runs{0};
+    int id{-1};
+    id = executor.Add([&]() -> void {
+        if (5 > ++runs) {
+            executor.Schedule(id, std::chrono::milliseconds(5));
+        }
+    });
+
+    ASSERT_TRUE(executor.Wake(id));
+    ASSERT_TRUE(wait_for(runs, 5));
+
+    settle();
+
+    EXPECT_EQ(5, runs.load());
+}
+
+TEST_F(Test_Executor, earlier_deadline_wins)
+{
+    Executor executor(1);
+    std::atomic<int> runs{0};
+    const auto id = executor.Add([&]() -> void { ++runs; });
+
+    ASSERT_TRUE(executor.Schedule(id, std::chrono::milliseconds(50)));
+    ASSERT_TRUE(executor.Schedule(id, std::chrono::hours(1)));
+    ASSERT_TRUE(wait_for(runs, 1));
+
+    settle();
+
+    EXPECT_EQ(1, runs.load());
+}
+
+TEST_F(Test_Executor, stop_with_queued_tasks)
+{
+    Gate gate{};
+    Executor executor(1);
+    std::atomic<int> queuedRuns{0};
+    const auto blocker = executor.Add([&]() -> void { gate.Enter(); });
+    const auto first = executor.Add([&]() -> void { ++queuedRuns; });
+    const auto second = executor.Add([&]() -> void { ++queuedRuns; });
+
+    ASSERT_TRUE(executor.Wake(blocker));
+    ASSERT_TRUE(wait_for(gate.entered_, 1));
+    ASSERT_TRUE(executor.Wake(first));
+    ASSERT_TRUE(executor.Schedule(second, std::chrono::milliseconds(1)));
+
+    auto stopped = std::async(std::launch::async, [&]() -> void {
+        executor.Stop();
+    });
+
+    // Stop waits for the running task
+    EXPECT_EQ(
+        std::future_status::timeout,
+        stopped.wait_for(std::chrono::milliseconds(200)));
+
+    gate.Open();
+
+    ASSERT_EQ(
+        std::future_status::ready,
+        stopped.wait_for(std::chrono::seconds(15)));
+
+    // Queued tasks are dropped rather than run
+    EXPECT_EQ(0, queuedRuns.load());
+    EXPECT_FALSE(executor.Wake(first));
+    EXPECT_FALSE(executor.Schedule(second, std::chrono::milliseconds(1)));
+    EXPECT_EQ(-1, executor.Add([]() -> void {}));
+
+    executor.Remove(first);
+    executor.Remove(second);
+    executor.Remove(blocker);
+}
+
+TEST_F(Test_Executor, remove_waits_for_running_task)
+{
+    Gate gate{};
+    Executor executor(2);
+    std::atomic<int> finished{0};
+    const auto id = executor.Add([&]() -> void {
+        gate.Enter();
+        ++finished;
+    });
+
+    ASSERT_TRUE(executor.Wake(id));
+    ASSERT_TRUE(wait_for(gate.entered_, 1));
+
+    auto removed = std::async(std::launch::async, [&]() -> void {
+        executor.Remove(id);
+    });
+
+    EXPECT_EQ(
+        std::future_status::timeout,
+        removed.wait_for(std::chrono::milliseconds(200)));
+
+    gate.Open();
+    removed.get();
+
+    EXPECT_EQ(1, finished.load());
+    EXPECT_FALSE(executor.Wake(id));
+}
+
+TEST_F(Test_Executor, grow_when_workers_block)
+{
+    Gate gate{};
+    Executor executor(2);
+    std::atomic<int> released{0};
+    const auto first = executor.Add([&]() -> void { gate.Enter(); });
+    const auto second = executor.Add([&]() -> void { gate.Enter(); });
+    const auto opener = executor.Add([&]() -> void {
+        gate.Open();
+        ++released;
+    });
+    const std::chrono::milliseconds stall{50};
+
+    ASSERT_TRUE(executor.Wake(first));
+    ASSERT_TRUE(executor.Wake(second));
+    ASSERT_TRUE(wait_for(gate.entered_, 2));
+
+    // Nothing is queued, so a busy pool is left alone
+    std::this_thread::sleep_for(2 * stall);
+
+    EXPECT_FALSE(executor.Grow(stall));
+
+    // Both workers are waiting on a task stuck behind them
+    ASSERT_TRUE(executor.Wake(opener));
+
+    EXPECT_FALSE(executor.Grow(stall));
+
+    std::this_thread::sleep_for(2 * stall);
+
+    EXPECT_TRUE(executor.Grow(stall));
+    EXPECT_TRUE(wait_for(released, 1));
+    EXPECT_FALSE(executor.Grow(stall));
+}
+
+// Sync runs the state machines for each notary on their own executor
+TEST_F(Test_Executor, separate_executors_do_not_share_workers)
+{
+    Gate gate{};
+    Executor stalled(1);
+    Executor other(1);
+    std::atomic<int> runs{0};
+    const auto blocked = stalled.Add([&]() -> void { gate.Enter(); });
+    const auto waiting = stalled.Add([&]() -> void { ++runs; });
+    const auto id = other.Add([&]() -> void { ++runs; });
+
+    ASSERT_TRUE(stalled.Wake(blocked));
+    ASSERT_TRUE(wait_for(gate.entered_, 1));
+    ASSERT_TRUE(stalled.Wake(waiting));
+    ASSERT_TRUE(other.Wake(id));
+
+    EXPECT_TRUE(wait_for(runs, 1));
+
+    settle();
+
+    EXPECT_EQ(1, runs.load());
+
+    gate.Open();
+
+    EXPECT_TRUE(wait_for(runs, 2));
+}
+}  // namespace
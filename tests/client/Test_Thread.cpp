@@ -0,0 +1,124 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+// Enough items to span several pages
+static const std::size_t item_count_{600};
+
+class Test_Thread : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+    const std::string nym_id_;
+    const std::string thread_id_;
+    std::vector<std::string> items_;
+
+    Test_Thread()
+        : client_(opentxs::OT::App().StartClient({}, 0))
+        , nym_id_(client_.Exec().CreateNymHD(
+              proto::CITEMTYPE_INDIVIDUAL,
+              "threadNym",
+              "",
+              -1))
+        , thread_id_(Identifier::Random()->str())
+        , items_()
+    {
+    }
+
+    void populate()
+    {
+        const auto& storage = client_.Storage();
+
+        ASSERT_TRUE(storage.CreateThread(nym_id_, thread_id_, {thread_id_}));
+
+        for (std::size_t i = 0; i < item_count_; ++i) {
+            const auto id = Identifier::Random()->str();
+            items_.emplace_back(id);
+
+            ASSERT_TRUE(storage.Store(
+                nym_id_,
+                thread_id_,
+                id,
+                std::time(nullptr),
+                "",
+                "",
+                StorageBox::INCOMINGBLOCKCHAIN));
+        }
+    }
+};
+
+TEST_F(Test_Thread, append_and_load)
+{
+    populate();
+    std::shared_ptr<proto::StorageThread> thread{};
+
+    ASSERT_TRUE(client_.Storage().Load(nym_id_, thread_id_, thread));
+    ASSERT_EQ(item_count_, static_cast<std::size_t>(thread->item_size()));
+
+    for (std::size_t i = 0; i < item_count_; ++i) {
+        EXPECT_EQ(items_.at(i), thread->item(i).id());
+    }
+
+    EXPECT_EQ(item_count_, client_.Storage().UnreadCount(nym_id_, thread_id_));
+}
+
+TEST_F(Test_Thread, load_range)
+{
+    populate();
+    std::shared_ptr<proto::StorageThread> thread{};
+    const std::size_t start{250};
+    const std::size_t count{100};
+
+    ASSERT_TRUE(
+        client_.Storage().Load(nym_id_, thread_id_, start, count, thread));
+    ASSERT_EQ(count, static_cast<std::size_t>(thread->item_size()));
+
+    const auto first = item_count_ - start - count;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(items_.at(first + i), thread->item(i).id());
+    }
+
+    ASSERT_TRUE(client_.Storage().Load(
+        nym_id_, thread_id_, item_count_, count, thread));
+    EXPECT_EQ(0, thread->item_size());
+}
+
+TEST_F(Test_Thread, move_and_mark_read)
+{
+    populate();
+    const auto& storage = client_.Storage();
+    const auto& removed = items_.at(300);
+    const auto other = Identifier::Random()->str();
+
+    ASSERT_TRUE(storage.CreateThread(nym_id_, other, {other}));
+    ASSERT_TRUE(
+        storage.SetReadState(nym_id_, thread_id_, items_.at(10), false));
+    ASSERT_TRUE(storage.MoveThreadItem(nym_id_, thread_id_, other, removed));
+
+    std::shared_ptr<proto::StorageThread> thread{};
+
+    ASSERT_TRUE(storage.Load(nym_id_, thread_id_, thread));
+    ASSERT_EQ(
+        item_count_ - 1, static_cast<std::size_t>(thread->item_size()));
+    EXPECT_EQ(item_count_ - 2, storage.UnreadCount(nym_id_, thread_id_));
+
+    for (const auto& item : thread->item()) { EXPECT_NE(removed, item.id()); }
+
+    ASSERT_TRUE(storage.Load(nym_id_, other, thread));
+    ASSERT_EQ(1, thread->item_size());
+    EXPECT_EQ(removed, thread->item(0).id());
+}
+}  // namespace
@@ -0,0 +1,154 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+// Reproduces the comparison Identifier used before it became binary, which
+// base58 encoded both operands on every call.
+struct EncodedLess {
+    static std::string encode(const Identifier& id)
+    {
+        const auto type = id.Type();
+        auto data = Data::Factory(&type, sizeof(type));
+        data->Concatenate(id.data(), id.size());
+
+        return OT::App().Crypto().Encode().IdentifierEncode(data);
+    }
+
+    bool operator()(const OTIdentifier& lhs, const OTIdentifier& rhs) const
+    {
+        return encode(lhs) < encode(rhs);
+    }
+};
+
+std::vector<OTIdentifier> random_ids(const std::size_t count)
+{
+    std::vector<OTIdentifier> output{};
+
+    for (std::size_t i = 0; i < count; ++i) {
+        output.emplace_back(Identifier::Random());
+    }
+
+    return output;
+}
+
+template <typename Map>
+std::chrono::microseconds time_lookups(
+    const Map& map,
+    const std::vector<OTIdentifier>& ids)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t found{0};
+
+    for (const auto& id : ids) {
+        if (map.end() != map.find(id)) { ++found; }
+    }
+
+    const auto finish = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(found, ids.size());
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        finish - start);
+}
+}  // namespace
+
+TEST(Identifier, compare_equal_after_round_trip)
+{
+    const auto one = Identifier::Random();
+    const auto other = Identifier::Factory(one->str());
+
+    ASSERT_TRUE(one.get() == other.get());
+    ASSERT_FALSE(one.get() != other.get());
+    ASSERT_FALSE(one.get() < other.get());
+    ASSERT_FALSE(one.get() > other.get());
+    ASSERT_TRUE(one.get() <= other.get());
+    ASSERT_TRUE(one.get() >= other.get());
+}
+
+TEST(Identifier, compare_different)
+{
+    const auto one = Identifier::Random();
+    const auto other = Identifier::Random();
+
+    ASSERT_TRUE(one.get() != other.get());
+    ASSERT_TRUE((one.get() < other.get()) != (other.get() < one.get()));
+}
+
+TEST(Identifier, compare_empty)
+{
+    const auto empty = Identifier::Factory();
+    const auto otherEmpty = Identifier::Factory(std::string{});
+    const auto id = Identifier::Random();
+
+    ASSERT_TRUE(empty.get() == otherEmpty.get());
+    ASSERT_TRUE(empty.get() < id.get());
+    ASSERT_FALSE(id.get() < empty.get());
+}
+
+TEST(Identifier, hash_consistent_with_equality)
+{
+    const auto one = Identifier::Random();
+    const auto other = Identifier::Factory(one->str());
+    std::hash<OTIdentifier> hash{};
+
+    ASSERT_EQ(hash(one), hash(other));
+    ASSERT_EQ(hash(Identifier::Factory()), hash(Identifier::Factory()));
+}
+
+TEST(Identifier, memoized_string_tracks_changes)
+{
+    auto id = Identifier::Random();
+    const auto before = id->str();
+
+    ASSERT_EQ(before, id->str());
+
+    id->CalculateDigest(Data::Factory("abcd", 4));
+    const auto after = id->str();
+
+    ASSERT_NE(before, after);
+    ASSERT_TRUE(Identifier::Factory(after).get() == id.get());
+}
+
+TEST(Identifier, lookup_benchmark)
+{
+    const std::size_t count{10000};
+    const auto ids = random_ids(count);
+    std::map<OTIdentifier, std::size_t, EncodedLess> encoded{};
+    std::map<OTIdentifier, std::size_t> ordered{};
+    std::unordered_map<OTIdentifier, std::size_t> unordered{};
+
+    for (std::size_t i = 0; i < count; ++i) {
+        encoded.emplace(ids.at(i), i);
+        ordered.emplace(ids.at(i), i);
+        unordered.emplace(ids.at(i), i);
+    }
+
+    const auto encodedTime = time_lookups(encoded, ids);
+    const auto orderedTime = time_lookups(ordered, ids);
+    const auto unorderedTime = time_lookups(unordered, ids);
+
+    std::cout << count << " lookups:\n"
+              << "  std::map, encoded compare: " << encodedTime.count()
+              << " us\n"
+              << "  std::map, binary compare:  " << orderedTime.count()
+              << " us\n"
+              << "  std::unordered_map:        " << unorderedTime.count()
+              << " us" << std::endl;
+
+    EXPECT_LE(orderedTime, encodedTime);
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/trade/OTMarket.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+static const std::int64_t offers_{100000};
+static const std::int64_t levels_{1000};
+
+class Test_Market : public ::testing::Test
+{
+public:
+    const api::client::Manager& client_;
+    const OTIdentifier notary_;
+    const OTIdentifier unit_;
+    const OTIdentifier currency_;
+    std::unique_ptr<OTMarket> market_;
+
+    Test_Market()
+        : client_(OT::App().StartClient({}, 0))
+        , notary_(Identifier::Random())
+        , unit_(Identifier::Random())
+        , currency_(Identifier::Random())
+        , market_(client_.Factory().Market(notary_, unit_, currency_, 1))
+    {
+    }
+
+    bool add(
+        const bool selling,
+        const std::int64_t price,
+        const std::int64_t transaction)
+    {
+        auto offer = client_.Factory().Offer(notary_, unit_, currency_, 1);
+
+        if (false == bool(offer)) { return false; }
+
+        if (false == offer->MakeOffer(selling, price, 10, 1, transaction)) {
+            return false;
+        }
+
+        // The market takes ownership of offers which were added
+        if (false == market_->AddOffer(nullptr, *offer, false)) {
+            return false;
+        }
+
+        offer.release();
+
+        return true;
+    }
+};
+
+std::chrono::milliseconds since(
+    const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+}
+}  // namespace
+
+TEST_F(Test_Market, best_price_and_fifo_cancel)
+{
+    ASSERT_TRUE(market_);
+    ASSERT_TRUE(add(false, 100, 1));
+    ASSERT_TRUE(add(false, 101, 2));
+    ASSERT_TRUE(add(false, 101, 3));
+    ASSERT_TRUE(add(true, 105, 4));
+    ASSERT_TRUE(add(true, 104, 5));
+    ASSERT_TRUE(add(true, 0, 6));
+    ASSERT_FALSE(add(true, 104, 5));
+
+    EXPECT_EQ(3u, market_->GetBidCount());
+    EXPECT_EQ(3u, market_->GetAskCount());
+    EXPECT_EQ(101, market_->GetHighestBidPrice());
+    EXPECT_EQ(104, market_->GetLowestAskPrice());
+
+    EXPECT_TRUE(market_->RemoveOffer(2, false));
+    EXPECT_EQ(101, market_->GetHighestBidPrice());
+    EXPECT_TRUE(market_->RemoveOffer(3, false));
+    EXPECT_EQ(100, market_->GetHighestBidPrice());
+    EXPECT_TRUE(market_->RemoveOffer(5, false));
+    EXPECT_EQ(105, market_->GetLowestAskPrice());
+    EXPECT_FALSE(market_->RemoveOffer(5, false));
+
+    EXPECT_EQ(1u, market_->GetBidCount());
+    EXPECT_EQ(2u, market_->GetAskCount());
+    EXPECT_TRUE(nullptr == market_->GetOffer(3));
+    EXPECT_TRUE(nullptr != market_->GetOffer(6));
+}
+
+TEST_F(Test_Market, order_book_benchmark)
+{
+    ASSERT_TRUE(market_);
+
+    std::vector<std::int64_t> transactions{};
+    transactions.reserve(offers_);
+    auto start = std::chrono::steady_clock::now();
+
+    // Bids are priced from 1 to levels_, asks from levels_ + 1 to 2 * levels_
+    for (std::int64_t i = 1; i <= offers_; ++i) {
+        const bool selling = (0 == i % 2);
+        const auto price = (selling ? levels_ : 0) + 1 + (i % levels_);
+
+        ASSERT_TRUE(add(selling, price, i));
+
+        transactions.emplace_back(i);
+    }
+
+    const auto added = since(start);
+
+    EXPECT_EQ(offers_ / 2, std::int64_t(market_->GetBidCount()));
+    EXPECT_EQ(offers_ / 2, std::int64_t(market_->GetAskCount()));
+    EXPECT_EQ(levels_, market_->GetHighestBidPrice());
+    EXPECT_EQ(levels_ + 1, market_->GetLowestAskPrice());
+
+    start = std::chrono::steady_clock::now();
+    auto output = Armored::Factory();
+    std::int32_t count{0};
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(market_->GetOfferList(output, 0, count));
+        ASSERT_LT(0, count);
+    }
+
+    const auto queried = since(start);
+    std::shuffle(
+        transactions.begin(), transactions.end(), std::mt19937_64{offers_});
+    start = std::chrono::steady_clock::now();
+
+    for (const auto& transaction : transactions) {
+        ASSERT_TRUE(market_->RemoveOffer(transaction, false));
+    }
+
+    const auto removed = since(start);
+
+    EXPECT_EQ(0u, market_->GetBidCount());
+    EXPECT_EQ(0u, market_->GetAskCount());
+    EXPECT_EQ(0, market_->GetHighestBidPrice());
+    EXPECT_EQ(0, market_->GetLowestAskPrice());
+
+    std::cout << offers_ << " resting offers on " << 2 * levels_
+              << " price levels:\n"
+              << "  add:                 " << added.count() << " ms\n"
+              << "  1000 depth queries:  " << queried.count() << " ms\n"
+              << "  cancel (random):     " << removed.count() << " ms"
+              << std::endl;
+}
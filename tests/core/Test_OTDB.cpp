@@ -0,0 +1,146 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace opentxs;
+
+#if OT_STORAGE_LMDB
+namespace
+{
+// Every test gets a new folder, so that nothing committed by an earlier run
+// is still there
+std::string temporary_folder()
+{
+    const char* tmp = std::getenv("TMPDIR");
+    std::string pattern =
+        std::string{(nullptr == tmp) ? "/tmp" : tmp} + "/test_otdb_XXXXXX";
+    const auto* created = ::mkdtemp(&pattern[0]);
+
+    OT_ASSERT(nullptr != created);
+
+    return pattern + "/";
+}
+
+void remove_tree(const std::string& path)
+{
+    auto* dir = ::opendir(path.c_str());
+
+    if (nullptr != dir) {
+        while (auto* entry = ::readdir(dir)) {
+            const std::string name{entry->d_name};
+
+            if (("." == name) || (".." == name)) { continue; }
+
+            const auto child = path + name;
+            struct stat info;
+
+            if (0 != ::lstat(child.c_str(), &info)) { continue; }
+
+            if (S_ISDIR(info.st_mode)) {
+                remove_tree(child + "/");
+            } else {
+                ::unlink(child.c_str());
+            }
+        }
+
+        ::closedir(dir);
+    }
+
+    ::rmdir(path.c_str());
+}
+
+class Test_OTDB : public ::testing::Test
+{
+public:
+    const std::string folder_;
+    std::unique_ptr<OTDB::Storage> storage_;
+
+    Test_OTDB()
+        : folder_(temporary_folder())
+        , storage_(OTDB::CreateStorageContext(OTDB::STORE_LMDB))
+    {
+    }
+
+    void TearDown() override
+    {
+        // Close the environment before deleting its files
+        storage_.reset();
+        remove_tree(folder_);
+    }
+};
+
+TEST_F(Test_OTDB, store_query_erase)
+{
+    const auto& folder = folder_;
+    auto& storage = storage_;
+
+    ASSERT_TRUE(storage);
+    EXPECT_EQ(OTDB::STORE_LMDB, storage->GetType());
+    EXPECT_FALSE(storage->Exists(folder, "nyms", "alice", "", ""));
+    ASSERT_TRUE(
+        storage->StorePlainString("contents", folder, "nyms", "alice", "", ""));
+    EXPECT_TRUE(storage->Exists(folder, "nyms", "alice", "", ""));
+    EXPECT_EQ(
+        "contents", storage->QueryPlainString(folder, "nyms", "alice", "", ""));
+    ASSERT_TRUE(storage->EraseValueByKey(folder, "nyms", "alice", "", ""));
+    EXPECT_FALSE(storage->Exists(folder, "nyms", "alice", "", ""));
+}
+
+TEST_F(Test_OTDB, batches)
+{
+    const auto& folder = folder_;
+    auto& storage = storage_;
+
+    ASSERT_TRUE(storage);
+    ASSERT_TRUE(storage->BeginBatch(folder));
+    ASSERT_TRUE(storage->StorePlainString("one", folder, "box", "1st", "", ""));
+    EXPECT_EQ("one", storage->QueryPlainString(folder, "box", "1st", "", ""));
+    storage->AbortBatch(folder);
+    EXPECT_FALSE(storage->Exists(folder, "box", "1st", "", ""));
+
+    ASSERT_TRUE(storage->BeginBatch(folder));
+    ASSERT_TRUE(storage->BeginBatch(folder));
+    ASSERT_TRUE(storage->StorePlainString("one", folder, "box", "1st", "", ""));
+    ASSERT_TRUE(storage->CommitBatch(folder));
+    ASSERT_TRUE(storage->StorePlainString("two", folder, "box", "2nd", "", ""));
+    ASSERT_TRUE(storage->CommitBatch(folder));
+    EXPECT_EQ("one", storage->QueryPlainString(folder, "box", "1st", "", ""));
+    EXPECT_EQ("two", storage->QueryPlainString(folder, "box", "2nd", "", ""));
+}
+
+TEST_F(Test_OTDB, imports_existing_tree)
+{
+    const auto& folder = folder_;
+    const auto nyms = folder + OTFolders::Nym().Get() + "/";
+    bool created{false};
+    OTPaths::BuildFolderPath(String::Factory(nyms.c_str()), created);
+    std::ofstream(nyms + "legacy_nym") << "legacy";
+    std::ofstream(folder + "wallet.xml") << "wallet";
+
+    // The folder is imported when the storage context first opens it
+    auto& storage = storage_;
+
+    ASSERT_TRUE(storage);
+    EXPECT_EQ(
+        "legacy",
+        storage->QueryPlainString(
+            folder, OTFolders::Nym().Get(), "legacy_nym", "", ""));
+    EXPECT_EQ(
+        "wallet", storage->QueryPlainString(folder, ".", "wallet.xml", "", ""));
+}
+}  // namespace
+#endif  // OT_STORAGE_LMDB
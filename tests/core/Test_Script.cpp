@@ -0,0 +1,99 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/script/OTScript.hpp"
+#include "opentxs/core/script/OTVariable.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace opentxs;
+
+#if OT_SCRIPT_CHAI
+namespace
+{
+static const std::size_t clauses_{10000};
+
+bool run_clause(
+    const std::string& code,
+    OTVariable& counter,
+    OTVariable& returnValue)
+{
+    auto script = OTScriptFactory("chai", code);
+
+    if (false == bool(script)) { return false; }
+
+    counter.RegisterForExecution(*script);
+    script->SetDisplayFilename("Test_Script");
+
+    return script->ExecuteScript(&returnValue);
+}
+
+TEST(Test_Script, updates_bound_variables)
+{
+    OTVariable counter("counter", std::int32_t{1});
+    OTVariable output("output", std::int32_t{0});
+
+    ASSERT_TRUE(run_clause("counter = counter + 1; counter", counter, output));
+    EXPECT_EQ(2, counter.CopyValueInteger());
+    EXPECT_EQ(2, output.CopyValueInteger());
+
+    // Same clause again, from the compiled cache.
+    ASSERT_TRUE(run_clause("counter = counter + 1; counter", counter, output));
+    EXPECT_EQ(3, counter.CopyValueInteger());
+    EXPECT_EQ(3, output.CopyValueInteger());
+}
+
+TEST(Test_Script, leases_start_clean)
+{
+    OTVariable counter("counter", std::int32_t{0});
+    OTVariable output("output", false);
+
+    ASSERT_TRUE(run_clause(
+        "def leaked_function() { return true; } true", counter, output));
+    EXPECT_TRUE(output.CopyValueBool());
+
+    EXPECT_FALSE(run_clause("leaked_function()", counter, output));
+}
+
+TEST(Test_Script, clause_benchmark)
+{
+    const std::string code{"if (counter < 1000000) { counter = counter + 1; } "
+                           "counter > 0"};
+    OTVariable counter("counter", std::int32_t{0});
+    OTVariable output("output", false);
+
+    auto start = std::chrono::steady_clock::now();
+
+    ASSERT_TRUE(run_clause(code, counter, output));
+
+    const auto first = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < clauses_; ++i) {
+        ASSERT_TRUE(run_clause(code, counter, output));
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    const std::size_t micros = static_cast<std::size_t>(elapsed.count());
+    const auto perSecond = (0 < micros) ? (clauses_ * 1000000 / micros) : 0;
+
+    std::cout << "First clause: " << first.count() << " us\n"
+              << clauses_ << " clauses: " << micros << " us ("
+              << perSecond << " clauses per second)" << std::endl;
+
+    EXPECT_EQ(
+        static_cast<std::int32_t>(clauses_ + 1), counter.CopyValueInteger());
+    EXPECT_TRUE(output.CopyValueBool());
+}
+}  // namespace
+#endif  // OT_SCRIPT_CHAI
@@ -0,0 +1,255 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "core/crypto/CredentialCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#if OT_CRYPTO_WITH_BIP39 && OT_CRYPTO_SUPPORTED_KEY_HD
+using namespace opentxs;
+
+namespace
+{
+using CredentialCache = opentxs::implementation::CredentialCache;
+
+class Test_CredentialCache : public ::testing::Test
+{
+public:
+    const opentxs::api::client::Manager& client_;
+    const std::string fingerprint_;
+    std::string folder_;
+
+    Test_CredentialCache()
+        : client_(OT::App().StartClient({}, 0))
+        , fingerprint_(client_.Exec().Wallet_ImportSeed(
+              "spike nominee miss inquiry fee nothing belt list other "
+              "daughter leave valley twelve gossip paper",
+              ""))
+        , folder_()
+    {
+    }
+
+    void SetUp() override
+    {
+        const char* tmp = std::getenv("TMPDIR");
+        std::string pattern = std::string{(nullptr == tmp) ? "/tmp" : tmp} +
+                              "/test_credential_cache_XXXXXX";
+        const auto* created = ::mkdtemp(&pattern[0]);
+
+        ASSERT_NE(nullptr, created);
+
+        folder_ = pattern + "/";
+    }
+
+    // Once the folder is gone, entries the cache appends to files in it
+    // are dropped
+    void TearDown() override
+    {
+        for (const auto& file : {"first", "second"}) {
+            ::unlink((folder_ + file).c_str());
+        }
+
+        ::rmdir(folder_.c_str());
+    }
+
+    // The cache is shared by the whole process, so every test creates its
+    // sets on its own nym index
+    std::unique_ptr<CredentialSet> private_set(
+        const std::uint32_t nym,
+        NymParameters& parameters) const
+    {
+        std::string fingerprint{fingerprint_};
+        std::uint32_t notUsed{0};
+        const auto seed = client_.Seeds().Seed(fingerprint, notUsed);
+
+        OT_ASSERT(seed);
+
+        parameters.SetEntropy(*seed);
+        parameters.SetSeed(fingerprint);
+        parameters.SetNym(nym);
+
+        return std::make_unique<CredentialSet>(
+            client_, parameters, NYM_CREATE_VERSION);
+    }
+
+    static std::shared_ptr<proto::CredentialSet> serialize(
+        const CredentialSet& set)
+    {
+        return set.Serialize(CREDENTIAL_INDEX_MODE_FULL_CREDS);
+    }
+
+    std::unique_ptr<CredentialSet> public_set(
+        const proto::CredentialSet& serialized) const
+    {
+        return std::make_unique<CredentialSet>(
+            client_, proto::KEYMODE_PUBLIC, serialized);
+    }
+
+    static OTIdentifier hash(const proto::CredentialSet& serialized)
+    {
+        auto output = Identifier::Factory();
+        output->CalculateDigest(proto::ProtoAsData(serialized));
+
+        return output;
+    }
+
+    static void tamper(proto::Credential& credential)
+    {
+        for (auto& signature : *credential.mutable_signature()) {
+            auto bytes = signature.signature();
+
+            ASSERT_FALSE(bytes.empty());
+
+            auto& byte = bytes[bytes.size() / 2];
+            byte = static_cast<char>(byte ^ 0x01);
+            signature.set_signature(bytes);
+        }
+    }
+
+    static std::string read(const std::string& path)
+    {
+        std::ifstream file(path);
+
+        return std::string(
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(Test_CredentialCache, unchanged_public_set_hits)
+{
+    NymParameters parameters(proto::CREDTYPE_HD);
+    const auto source = private_set(100, parameters);
+
+    ASSERT_TRUE(source);
+
+    const auto serialized = serialize(*source);
+    const auto id = hash(*serialized);
+
+    EXPECT_FALSE(CredentialCache::Check(id));
+    EXPECT_TRUE(public_set(*serialized)->VerifyInternally());
+    EXPECT_TRUE(CredentialCache::Check(id));
+
+    // A separately loaded copy of the same set is found by content
+    const auto copy = public_set(*serialized);
+
+    EXPECT_EQ(id->str(), hash(*serialize(*copy))->str());
+    EXPECT_TRUE(copy->VerifyInternally());
+}
+
+TEST_F(Test_CredentialCache, added_child_misses)
+{
+    NymParameters parameters(proto::CREDTYPE_HD);
+    const auto source = private_set(101, parameters);
+
+    ASSERT_TRUE(source);
+
+    const auto original = serialize(*source);
+
+    ASSERT_TRUE(public_set(*original)->VerifyInternally());
+    ASSERT_TRUE(CredentialCache::Check(hash(*original)));
+
+    ASSERT_FALSE(source->AddChildKeyCredential(parameters).empty());
+
+    const auto revised = serialize(*source);
+    const auto id = hash(*revised);
+
+    EXPECT_EQ(
+        original->activechildren_size() + 1, revised->activechildren_size());
+    EXPECT_NE(hash(*original)->str(), id->str());
+    EXPECT_FALSE(CredentialCache::Check(id));
+    EXPECT_TRUE(public_set(*revised)->VerifyInternally());
+    EXPECT_TRUE(CredentialCache::Check(id));
+}
+
+TEST_F(Test_CredentialCache, tampered_signature_never_cached)
+{
+    NymParameters parameters(proto::CREDTYPE_HD);
+    const auto source = private_set(102, parameters);
+
+    ASSERT_TRUE(source);
+
+    const auto serialized = serialize(*source);
+
+    ASSERT_TRUE(public_set(*serialized)->VerifyInternally());
+    ASSERT_TRUE(CredentialCache::Check(hash(*serialized)));
+    ASSERT_LT(0, serialized->activechildren_size());
+
+    proto::CredentialSet badMaster(*serialized);
+    tamper(*badMaster.mutable_mastercredential());
+    proto::CredentialSet badChild(*serialized);
+    tamper(*badChild.mutable_activechildren(0));
+
+    for (const auto& bad : {badMaster, badChild}) {
+        const auto id = hash(bad);
+
+        EXPECT_FALSE(CredentialCache::Check(id));
+        EXPECT_FALSE(public_set(bad)->VerifyInternally());
+        EXPECT_FALSE(CredentialCache::Check(id));
+        // A second attempt is verified in full again
+        EXPECT_FALSE(public_set(bad)->VerifyInternally());
+    }
+}
+
+TEST_F(Test_CredentialCache, private_set_takes_full_path)
+{
+    NymParameters parameters(proto::CREDTYPE_HD);
+    const auto source = private_set(103, parameters);
+
+    ASSERT_TRUE(source);
+
+    const auto id = hash(*serialize(*source));
+
+    EXPECT_TRUE(source->VerifyInternally());
+    EXPECT_FALSE(CredentialCache::Check(id));
+    EXPECT_TRUE(source->VerifyInternally());
+    EXPECT_FALSE(CredentialCache::Check(id));
+}
+
+TEST_F(Test_CredentialCache, persisted_file_reloaded)
+{
+    const auto first = folder_ + "first";
+    const auto second = folder_ + "second";
+    const auto stored = Identifier::Random();
+
+    {
+        std::ofstream file(first);
+        file << stored->str() << '\n';
+    }
+
+    EXPECT_FALSE(CredentialCache::Check(stored));
+
+    CredentialCache::Persist(first);
+    CredentialCache::Persist(second);
+
+    EXPECT_TRUE(CredentialCache::Check(stored));
+
+    // New entries are appended to every persisted file
+    NymParameters parameters(proto::CREDTYPE_HD);
+    const auto source = private_set(104, parameters);
+
+    ASSERT_TRUE(source);
+
+    const auto serialized = serialize(*source);
+    const auto id = hash(*serialized);
+
+    ASSERT_TRUE(public_set(*serialized)->VerifyInternally());
+
+    const auto line = id->str() + "\n";
+
+    EXPECT_EQ(stored->str() + "\n" + line, read(first));
+    EXPECT_EQ(line, read(second));
+}
+}  // namespace
+#endif  // OT_CRYPTO_WITH_BIP39 && OT_CRYPTO_SUPPORTED_KEY_HD
@@ -0,0 +1,157 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#endif
+
+using namespace opentxs;
+
+namespace zmq = opentxs::network::zeromq;
+
+namespace
+{
+std::size_t thread_count()
+{
+    std::size_t output{0};
+#ifdef __linux__
+    auto* dir = ::opendir("/proc/self/task");
+
+    if (nullptr == dir) { return output; }
+
+    while (auto* entry = ::readdir(dir)) {
+        if ('.' != entry->d_name[0]) { ++output; }
+    }
+
+    ::closedir(dir);
+#endif
+
+    return output;
+}
+
+class Test_Reactor : public ::testing::Test
+{
+public:
+    static OTZMQContext context_;
+
+    const std::size_t socketCount_{64};
+    // More than the reactor starts with
+    const std::size_t blockingCount_{40};
+    const std::string endpoint_{"inproc://opentxs/test/reactor_test/"};
+};
+
+OTZMQContext Test_Reactor::context_{zmq::Context::Factory()};
+}  // namespace
+
+TEST_F(Test_Reactor, thread_count_independent_of_sockets)
+{
+    std::atomic<std::size_t> received{0};
+    auto callback = zmq::ListenCallback::Factory(
+        [&received](zmq::Message&) -> void { ++received; });
+    std::vector<OTZMQPullSocket> pullSockets{};
+    std::vector<OTZMQPushSocket> pushSockets{};
+    const auto before = thread_count();
+
+    for (std::size_t i = 0; i < socketCount_; ++i) {
+        const auto endpoint = endpoint_ + std::to_string(i);
+        pullSockets.emplace_back(zmq::PullSocket::Factory(
+            context_, zmq::Socket::Direction::Bind, callback));
+
+        ASSERT_TRUE(pullSockets.back()->Start(endpoint));
+
+        pushSockets.emplace_back(zmq::PushSocket::Factory(
+            context_, zmq::Socket::Direction::Connect));
+
+        ASSERT_TRUE(pushSockets.back()->Start(endpoint));
+    }
+
+    const auto after = thread_count();
+
+    EXPECT_EQ(before, after);
+
+    for (auto& socket : pushSockets) { ASSERT_TRUE(socket->Push("test")); }
+
+    auto end = std::time(nullptr) + 15;
+
+    while ((received.load() < socketCount_) && (std::time(nullptr) < end)) {
+        Log::Sleep(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(socketCount_, received.load());
+}
+
+TEST_F(Test_Reactor, reply_served_while_callbacks_block)
+{
+    const std::string replyEndpoint{endpoint_ + "reply"};
+    auto replyCallback = zmq::ReplyCallback::Factory(
+        [](const zmq::Message& input) -> OTZMQMessage {
+            auto reply = zmq::Message::ReplyFactory(input);
+            reply->AddFrame(std::string(*input.Body().begin()));
+
+            return reply;
+        });
+    auto replySocket = zmq::ReplySocket::Factory(
+        context_, zmq::Socket::Direction::Bind, replyCallback);
+
+    ASSERT_TRUE(replySocket->Start(replyEndpoint));
+
+    // Every callback waits for the reply socket, which is serviced by the
+    // same reactor
+    std::atomic<std::size_t> replied{0};
+    auto callback = zmq::ListenCallback::Factory(
+        [&replied, replyEndpoint](zmq::Message& input) -> void {
+            auto request = zmq::RequestSocket::Factory(context_);
+            request->SetTimeouts(
+                std::chrono::milliseconds(0),
+                std::chrono::milliseconds(-1),
+                std::chrono::milliseconds(30000));
+
+            if (false == request->Start(replyEndpoint)) { return; }
+
+            const std::string payload = *input.Body().begin();
+            const auto [result, reply] = request->SendRequest(payload);
+
+            if (SendResult::VALID_REPLY != result) { return; }
+            if (payload != std::string(*reply->Body().begin())) { return; }
+
+            ++replied;
+        });
+    std::vector<OTZMQPullSocket> pullSockets{};
+    std::vector<OTZMQPushSocket> pushSockets{};
+
+    for (std::size_t i = 0; i < blockingCount_; ++i) {
+        const auto endpoint = endpoint_ + "blocking/" + std::to_string(i);
+        pullSockets.emplace_back(zmq::PullSocket::Factory(
+            context_, zmq::Socket::Direction::Bind, callback));
+
+        ASSERT_TRUE(pullSockets.back()->Start(endpoint));
+
+        pushSockets.emplace_back(zmq::PushSocket::Factory(
+            context_, zmq::Socket::Direction::Connect));
+
+        ASSERT_TRUE(pushSockets.back()->Start(endpoint));
+    }
+
+    for (std::size_t i = 0; i < blockingCount_; ++i) {
+        ASSERT_TRUE(pushSockets.at(i)->Push(std::to_string(i)));
+    }
+
+    auto end = std::time(nullptr) + 30;
+
+    while ((replied.load() < blockingCount_) && (std::time(nullptr) < end)) {
+        Log::Sleep(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(blockingCount_, replied.load());
+}
@@ -4,11 +4,16 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "opentxs/opentxs.hpp"
+#include "network/WireFormat.hpp"
 #include "server/Server.hpp"
 #include "server/Transactor.hpp"
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <map>
+
 using namespace opentxs;
 
 #define CHEQUE_AMOUNT 144488
@@ -31,6 +36,8 @@ using namespace opentxs;
 #define UNIT_DEFINITION_TLA "USA"
 #define UNIT_DEFINITION_POWER 2
 #define UNIT_DEFINITION_FRACTIONAL_UNIT_NAME "cents"
+#define WIRE_ARMORED -2
+#define WIRE_BENCHMARK_ROUNDS 100
 
 namespace
 {
@@ -54,6 +61,8 @@ public:
     static std::string outgoing_transfer_workflow_id_;
     static std::string incoming_transfer_workflow_id_;
     static std::string internal_transfer_workflow_id_;
+    static std::shared_ptr<Message> nymbox_reply_;
+    static std::shared_ptr<Message> notarize_reply_;
 
     const opentxs::api::client::Manager& client_1_;
     const opentxs::api::client::Manager& client_2_;
@@ -69,6 +78,67 @@ public:
         if (false == init_) { init(); }
     }
 
+    // Compares encode and decode time and frame size of the armored format
+    // with binary framing at several compression levels
+    void benchmark_wire(const std::string& name, const Message& message) const
+    {
+        using WireFormat = opentxs::network::implementation::WireFormat;
+        using Clock = std::chrono::steady_clock;
+
+        auto raw = String::Factory();
+        message.SaveContractRaw(raw);
+
+        ASSERT_TRUE(raw->Exists());
+
+        std::map<std::int32_t, std::size_t> sizes{};
+
+        for (const std::int32_t level : {WIRE_ARMORED, 0, 1, 6, 9}) {
+            std::string frame{};
+            auto decoded = String::Factory();
+            const auto encodeStart = Clock::now();
+
+            for (int i = 0; i < WIRE_BENCHMARK_ROUNDS; ++i) {
+                const bool encoded =
+                    (WIRE_ARMORED == level)
+                        ? WireFormat::EncodeArmored(raw, frame)
+                        : WireFormat::EncodeBinary(raw, level, frame);
+
+                ASSERT_TRUE(encoded);
+            }
+
+            const auto decodeStart = Clock::now();
+
+            for (int i = 0; i < WIRE_BENCHMARK_ROUNDS; ++i) {
+                ASSERT_TRUE(WireFormat::Decode(frame, decoded));
+            }
+
+            const auto decodeEnd = Clock::now();
+
+            EXPECT_STREQ(raw->Get(), decoded->Get());
+
+            const auto encodeTime =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    decodeStart - encodeStart) /
+                WIRE_BENCHMARK_ROUNDS;
+            const auto decodeTime =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    decodeEnd - decodeStart) /
+                WIRE_BENCHMARK_ROUNDS;
+            const std::string format =
+                (WIRE_ARMORED == level)
+                    ? std::string("armored")
+                    : std::string("binary level ") + std::to_string(level);
+            std::cout << name << " (" << raw->GetLength() << " bytes) "
+                      << format << ": " << frame.size() << " bytes, encode "
+                      << encodeTime.count() << " us, decode "
+                      << decodeTime.count() << " us" << std::endl;
+            sizes[level] = frame.size();
+        }
+
+        EXPECT_EQ(raw->GetLength() + 7, sizes.at(0));
+        EXPECT_LT(sizes.at(1), sizes.at(WIRE_ARMORED));
+    }
+
     void break_consensus()
     {
         TransactionNumber newNumber{0};
@@ -286,6 +356,8 @@ std::string Test_Basic::bob_account_2_id_{""};
 std::string Test_Basic::outgoing_transfer_workflow_id_{};
 std::string Test_Basic::incoming_transfer_workflow_id_{};
 std::string Test_Basic::internal_transfer_workflow_id_{};
+std::shared_ptr<Message> Test_Basic::nymbox_reply_{nullptr};
+std::shared_ptr<Message> Test_Basic::notarize_reply_{nullptr};
 
 TEST_F(Test_Basic, getRequestNumber_not_registered)
 {
@@ -1416,6 +1488,7 @@ TEST_F(Test_Basic, getNymbox_receive_cheque)
         NYMBOX_SAME,
         NO_TRANSACTION,
         1);
+    nymbox_reply_ = message;
 
     std::unique_ptr<Ledger> nymbox{client_2_.OTAPI().LoadNymbox(
         serverContext.It().Server(), serverContext.It().Nym()->ID())};
@@ -2006,6 +2079,7 @@ TEST_F(Test_Basic, sendTransfer)
         NYMBOX_UPDATED,
         TRANSACTION,
         0);
+    notarize_reply_ = message;
 
     const auto serverAccount = server_.Wallet().Account(senderAccountID);
 
@@ -3414,4 +3488,13 @@ TEST_F(Test_Basic, getNymbox_after_processInbox_internal_transferReceipt)
         NO_TRANSACTION,
         0);
 }
+
+TEST_F(Test_Basic, wire_format)
+{
+    ASSERT_TRUE(nymbox_reply_);
+    ASSERT_TRUE(notarize_reply_);
+
+    benchmark_wire("getNymbox", *nymbox_reply_);
+    benchmark_wire("notarizeTransaction", *notarize_reply_);
+}
 }  // namespace
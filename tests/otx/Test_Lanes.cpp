@@ -0,0 +1,173 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "server/Lanes.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace opentxs;
+
+#define LANE_COUNT 8
+
+namespace
+{
+class Test_Lanes : public ::testing::Test
+{
+public:
+    using Lanes = opentxs::server::Lanes;
+
+    Lanes lanes_;
+
+    Test_Lanes()
+        : lanes_(LANE_COUNT)
+    {
+    }
+
+    // Returns a nym which is not run by any of the given lanes
+    OTIdentifier nym_outside(const std::vector<std::size_t>& used) const
+    {
+        while (true) {
+            auto output = Identifier::Random();
+            const auto lane = lanes_.Lane(output);
+            bool free{true};
+
+            for (const auto& taken : used) { free &= (taken != lane); }
+
+            if (free) { return output; }
+        }
+    }
+
+    static bool wait_for(const std::atomic<int>& value, const int target)
+    {
+        const auto end =
+            std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+        while (value.load() < target) {
+            if (std::chrono::steady_clock::now() > end) { return false; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+};
+
+TEST_F(Test_Lanes, same_nym_runs_in_order)
+{
+    const auto alice = nym_outside({});
+    const auto bob = nym_outside({lanes_.Lane(alice)});
+    const auto carol = Identifier::Random();
+    const std::vector<const Identifier*> nyms{&alice.get(), &bob.get(),
+                                              &carol.get()};
+    const std::size_t count{300};
+    std::mutex lock{};
+    std::map<std::string, std::vector<std::size_t>> processed{};
+    std::atomic<int> finished{0};
+
+    // Requests queued before the workers start are kept, and run first
+    lanes_.Push(alice, [&]() -> void {
+        Lock mapLock(lock);
+        processed[alice->str()].push_back(0);
+        ++finished;
+    });
+    lanes_.Start();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& nym = *nyms.at(i % nyms.size());
+        lanes_.Push(nym, [&, i, id = nym.str()]() -> void {
+            // Earlier requests run longer, so workers competing for one queue
+            // would finish them out of order
+            std::this_thread::sleep_for(
+                std::chrono::microseconds(100 * ((count - i) % 7)));
+            Lock mapLock(lock);
+            processed[id].push_back(i + 1);
+            ++finished;
+        });
+    }
+
+    ASSERT_TRUE(wait_for(finished, static_cast<int>(count) + 1));
+
+    Lock mapLock(lock);
+
+    EXPECT_EQ(count / 3 + 1, processed[alice->str()].size());
+
+    for (const auto* nym : nyms) {
+        const auto& order = processed[nym->str()];
+
+        EXPECT_LE(count / 3, order.size());
+
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            EXPECT_LT(order.at(i - 1), order.at(i));
+        }
+    }
+}
+
+TEST_F(Test_Lanes, other_nyms_run_concurrently)
+{
+    const auto alice = nym_outside({});
+    const auto bob = nym_outside({lanes_.Lane(alice)});
+    std::promise<void> bobRan{};
+    auto bobFinished = bobRan.get_future();
+    std::atomic<int> finished{0};
+    lanes_.Start();
+
+    // Alice's request can only finish once Bob's has run
+    lanes_.Push(alice, [&]() -> void {
+        if (std::future_status::ready ==
+            bobFinished.wait_for(std::chrono::seconds(30))) {
+            ++finished;
+        }
+    });
+    lanes_.Push(bob, [&]() -> void { bobRan.set_value(); });
+
+    EXPECT_TRUE(wait_for(finished, 1));
+}
+
+TEST_F(Test_Lanes, stop_drops_queued_requests)
+{
+    const auto alice = Identifier::Random();
+    std::promise<void> release{};
+    auto released = release.get_future().share();
+    std::atomic<int> started{0};
+    std::atomic<int> finished{0};
+    lanes_.Start();
+    lanes_.Push(alice, [&]() -> void {
+        ++started;
+        released.wait();
+        ++finished;
+    });
+    lanes_.Push(alice, [&]() -> void { ++finished; });
+
+    ASSERT_TRUE(wait_for(started, 1));
+
+    auto stopped =
+        std::async(std::launch::async, [&]() -> void { lanes_.Stop(); });
+
+    // The running request is allowed to finish
+    EXPECT_EQ(
+        std::future_status::timeout,
+        stopped.wait_for(std::chrono::milliseconds(200)));
+
+    release.set_value();
+    stopped.get();
+
+    EXPECT_EQ(1, finished.load());
+
+    lanes_.Push(alice, [&]() -> void { ++finished; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_EQ(1, finished.load());
+}
+}  // namespace
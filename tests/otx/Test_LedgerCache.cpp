@@ -0,0 +1,242 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "server/LedgerCache.hpp"
+#include "server/Server.hpp"
+#include "server/ServerSettings.hpp"
+#include "server/Transactor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_LedgerCache : public ::testing::Test
+{
+public:
+    using LedgerCache = opentxs::server::LedgerCache;
+    using ServerSettings = opentxs::server::ServerSettings;
+
+    const opentxs::api::server::Manager& server_;
+    const std::int64_t budget_;
+
+    Test_LedgerCache()
+        : server_(OT::App().StartServer({}, 0, true))
+        , budget_(ServerSettings::GetLedgerCacheBytes())
+    {
+    }
+
+    void TearDown() override { ServerSettings::SetLedgerCacheBytes(budget_); }
+
+    const Nym& server_nym() const { return server_.Server().GetServerNym(); }
+
+    // A signed, empty nymbox which has not been saved
+    std::unique_ptr<Ledger> create_nymbox(const Identifier& nymID) const
+    {
+        auto nymbox{server_.Factory().Ledger(nymID, nymID, server_.ID())};
+
+        OT_ASSERT(nymbox);
+
+        const bool created = nymbox->CreateLedger(
+            nymID, nymID, server_.ID(), ledgerType::nymbox, true);
+
+        OT_ASSERT(created);
+
+        sign(*nymbox);
+
+        return nymbox;
+    }
+
+    // Adds a receipt, which changes the contents of the box
+    void add_receipt(Ledger& nymbox) const
+    {
+        TransactionNumber number{0};
+
+        ASSERT_TRUE(
+            server_.Server().GetTransactor().issueNextTransactionNumber(
+                number));
+
+        std::shared_ptr<OTTransaction> receipt{
+            server_.Factory()
+                .Transaction(
+                    nymbox,
+                    transactionType::blank,
+                    originType::not_applicable,
+                    number)
+                .release()};
+
+        ASSERT_TRUE(receipt);
+
+        receipt->SignContract(server_nym());
+        receipt->SaveContract();
+        receipt->SaveBoxReceipt(nymbox);
+
+        ASSERT_TRUE(nymbox.AddTransaction(receipt));
+
+        nymbox.ReleaseSignatures();
+        sign(nymbox);
+    }
+
+    std::unique_ptr<Ledger> load_nymbox(const Identifier& nymID) const
+    {
+        auto nymbox{server_.Factory().Ledger(nymID, nymID, server_.ID())};
+
+        OT_ASSERT(nymbox);
+
+        const bool loaded = nymbox->LoadNymbox();
+
+        OT_ASSERT(loaded);
+
+        return nymbox;
+    }
+
+    void sign(Ledger& box) const
+    {
+        const bool isSigned = box.SignContract(server_nym());
+
+        OT_ASSERT(isSigned);
+
+        const bool saved = box.SaveContract();
+
+        OT_ASSERT(saved);
+    }
+};
+
+TEST_F(Test_LedgerCache, hit_and_miss)
+{
+    LedgerCache cache(server_.Server());
+    const auto nymID = Identifier::Random();
+    auto nymbox = create_nymbox(nymID);
+
+    // Saved without the cache, so the first verification is a miss
+    ASSERT_TRUE(nymbox->SaveNymbox());
+
+    auto loaded = load_nymbox(nymID);
+
+    EXPECT_TRUE(cache.VerifySignature(*loaded, server_nym()));
+
+    auto metrics = cache.GetMetrics();
+
+    EXPECT_EQ(0u, metrics.hits_);
+    EXPECT_EQ(1u, metrics.misses_);
+    EXPECT_EQ(1u, metrics.entries_);
+    EXPECT_LT(0u, metrics.bytes_);
+
+    // The same contents are remembered once verified
+    loaded = load_nymbox(nymID);
+
+    EXPECT_TRUE(cache.VerifySignature(*loaded, server_nym()));
+
+    metrics = cache.GetMetrics();
+
+    EXPECT_EQ(1u, metrics.hits_);
+    EXPECT_EQ(1u, metrics.misses_);
+    EXPECT_EQ(1u, metrics.entries_);
+
+    // Boxes saved through the cache hit on their first load
+    const auto otherID = Identifier::Random();
+    auto other = create_nymbox(otherID);
+
+    ASSERT_TRUE(cache.SaveNymbox(*other));
+
+    loaded = load_nymbox(otherID);
+
+    EXPECT_TRUE(cache.VerifySignature(*loaded, server_nym()));
+
+    metrics = cache.GetMetrics();
+
+    EXPECT_EQ(2u, metrics.hits_);
+    EXPECT_EQ(1u, metrics.misses_);
+    EXPECT_EQ(2u, metrics.entries_);
+    EXPECT_EQ(0u, metrics.evictions_);
+}
+
+TEST_F(Test_LedgerCache, save_replaces_entry)
+{
+    LedgerCache cache(server_.Server());
+    const auto nymID = Identifier::Random();
+    auto nymbox = create_nymbox(nymID);
+
+    ASSERT_TRUE(cache.SaveNymbox(*nymbox));
+
+    const auto stale = load_nymbox(nymID);
+    const auto bytes = cache.GetMetrics().bytes_;
+
+    ASSERT_TRUE(cache.VerifySignature(*stale, server_nym()));
+    ASSERT_EQ(1u, cache.GetMetrics().hits_);
+
+    add_receipt(*nymbox);
+
+    ASSERT_TRUE(cache.SaveNymbox(*nymbox));
+
+    // The box has one entry, which now holds the new contents
+    auto metrics = cache.GetMetrics();
+
+    EXPECT_EQ(1u, metrics.entries_);
+    EXPECT_EQ(bytes, metrics.bytes_);
+
+    const auto current = load_nymbox(nymID);
+
+    EXPECT_NE(stale->GetTransactionCount(), current->GetTransactionCount());
+    EXPECT_TRUE(cache.VerifySignature(*current, server_nym()));
+    EXPECT_EQ(2u, cache.GetMetrics().hits_);
+
+    // The previous version no longer matches, so it is verified in full
+    EXPECT_TRUE(cache.VerifySignature(*stale, server_nym()));
+
+    metrics = cache.GetMetrics();
+
+    EXPECT_EQ(2u, metrics.hits_);
+    EXPECT_EQ(1u, metrics.misses_);
+}
+
+TEST_F(Test_LedgerCache, evict_least_recently_used)
+{
+    LedgerCache cache(server_.Server());
+    const auto firstID = Identifier::Random();
+    const auto secondID = Identifier::Random();
+    const auto thirdID = Identifier::Random();
+    auto first = create_nymbox(firstID);
+    auto second = create_nymbox(secondID);
+    auto third = create_nymbox(thirdID);
+
+    ASSERT_TRUE(cache.SaveNymbox(*first));
+
+    // Every entry has the same size, and the budget holds two of them
+    const auto entry = cache.GetMetrics().bytes_;
+    ServerSettings::SetLedgerCacheBytes(static_cast<std::int64_t>(2 * entry));
+
+    ASSERT_TRUE(cache.SaveNymbox(*second));
+
+    // A hit makes the first box the most recently used
+    ASSERT_TRUE(cache.VerifySignature(*load_nymbox(firstID), server_nym()));
+    ASSERT_TRUE(cache.SaveNymbox(*third));
+
+    auto metrics = cache.GetMetrics();
+
+    EXPECT_EQ(1u, metrics.evictions_);
+    EXPECT_EQ(2u, metrics.entries_);
+    EXPECT_EQ(2 * entry, metrics.bytes_);
+
+    EXPECT_TRUE(cache.VerifySignature(*load_nymbox(firstID), server_nym()));
+    EXPECT_TRUE(cache.VerifySignature(*load_nymbox(thirdID), server_nym()));
+    EXPECT_EQ(3u, cache.GetMetrics().hits_);
+    EXPECT_EQ(0u, cache.GetMetrics().misses_);
+
+    EXPECT_TRUE(cache.VerifySignature(*load_nymbox(secondID), server_nym()));
+
+    metrics = cache.GetMetrics();
+
+    EXPECT_EQ(1u, metrics.misses_);
+    // Remembering the second box again pushes out the first
+    EXPECT_EQ(2u, metrics.evictions_);
+    EXPECT_EQ(2 * entry, metrics.bytes_);
+}
+}  // namespace
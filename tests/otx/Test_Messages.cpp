@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+
 using namespace opentxs;
 
 #define REPLY_VERSION 1
@@ -212,4 +214,32 @@ TEST_F(Test_Messages, pushReply)
     EXPECT_EQ(payload, aliceCopy->Push()->item());
     EXPECT_TRUE(aliceCopy->Validate());
 }
+
+TEST_F(Test_Messages, rejectedRequestFailsQuickly)
+{
+    auto& connection = client_.ZMQ().Server(server_id_.str());
+    auto context =
+        client_.Wallet().mutable_ServerContext(alice_nym_id_, server_id_);
+    auto message{client_.Factory().Message()};
+
+    ASSERT_TRUE(message);
+
+    // The notary can not parse the request, so the reply is a bare rejection
+    EXPECT_FALSE(
+        message->LoadContractFromString(String::Factory("not a message")));
+
+    message->m_strNymID = String::Factory(alice_nym_id_);
+    message->m_strRequestNum->Set("1");
+    auto future = connection.SendAsync(context.It(), *message);
+
+    // Pending requests only expire after the send and receive timeouts
+    ASSERT_EQ(
+        std::future_status::ready,
+        future.wait_for(client_.ZMQ().ReceiveTimeout()));
+
+    const auto [result, reply] = future.get();
+
+    EXPECT_EQ(SendResult::INVALID_REPLY, result);
+    EXPECT_FALSE(reply);
+}
 }  // namespace
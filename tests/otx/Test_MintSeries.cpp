@@ -0,0 +1,81 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "api/Core.hpp"
+#include "api/server/Manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+
+using namespace opentxs;
+
+#define SERIES_LIMIT 10000
+
+namespace
+{
+class Test_MintSeries : public ::testing::Test
+{
+public:
+    using Manager = opentxs::api::server::implementation::Manager;
+
+    std::set<std::int32_t> probed_{};
+
+    // Series 0 through last exist, and every probe is recorded
+    std::int32_t last_series(const std::int32_t last)
+    {
+        probed_.clear();
+
+        return Manager::LastSeries(
+            [&](const std::int32_t series) -> bool {
+                EXPECT_LE(0, series);
+                EXPECT_GT(SERIES_LIMIT, series);
+                probed_.emplace(series);
+
+                return series <= last;
+            },
+            SERIES_LIMIT);
+    }
+};
+
+TEST_F(Test_MintSeries, no_series)
+{
+    EXPECT_EQ(-1, last_series(-1));
+    EXPECT_EQ(std::set<std::int32_t>{0}, probed_);
+}
+
+TEST_F(Test_MintSeries, one_series)
+{
+    EXPECT_EQ(0, last_series(0));
+    EXPECT_EQ((std::set<std::int32_t>{0, 1}), probed_);
+}
+
+TEST_F(Test_MintSeries, past_first_doubling)
+{
+    EXPECT_EQ(1, last_series(1));
+    EXPECT_EQ(2, last_series(2));
+    EXPECT_EQ(5, last_series(5));
+    EXPECT_EQ((std::set<std::int32_t>{0, 1, 2, 4, 8, 6, 5}), probed_);
+
+    for (std::int32_t last = 3; last < 300; ++last) {
+        EXPECT_EQ(last, last_series(last));
+    }
+}
+
+TEST_F(Test_MintSeries, probes_are_logarithmic)
+{
+    EXPECT_EQ(4321, last_series(4321));
+    // 0, 1, 2, ..., 8192 while galloping and at most 12 while bisecting
+    EXPECT_GE(27u, probed_.size());
+}
+
+TEST_F(Test_MintSeries, stops_at_limit)
+{
+    EXPECT_EQ(SERIES_LIMIT - 1, last_series(SERIES_LIMIT + 5));
+    EXPECT_EQ(0u, probed_.count(SERIES_LIMIT));
+}
+}  // namespace
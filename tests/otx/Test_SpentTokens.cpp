@@ -0,0 +1,292 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+#include "server/Server.hpp"
+#include "server/SpentTokens.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using namespace opentxs;
+
+#define HEADER_SIZE 64
+#define INDEX_CLEAN_OFFSET 32
+#define INDEX_SLOTS_OFFSET 8
+#define KEY_SIZE 32
+#define RETIRE_DELAY 86400
+#define VALID_SECONDS 2592000
+
+namespace
+{
+class Test_SpentTokens : public ::testing::Test
+{
+public:
+    using SpentTokens = opentxs::server::SpentTokens;
+
+    static const opentxs::ArgList args_;
+
+    const opentxs::api::server::Manager& server_;
+    const OTIdentifier unit_;
+    const time64_t valid_to_;
+    std::unique_ptr<SpentTokens> spent_;
+
+    Test_SpentTokens()
+        : server_(OT::App().StartServer(args_, 0, true))
+        , unit_(Identifier::Random())
+        , valid_to_(OTTimeGetCurrentTime() + VALID_SECONDS)
+        , spent_(new SpentTokens(server_.Server()))
+    {
+    }
+
+    SpentTokens::Batch batch(
+        const std::int32_t series,
+        const std::size_t count,
+        const time64_t validTo) const
+    {
+        SpentTokens::Batch output{};
+
+        for (std::size_t i = 0; i < count; ++i) {
+            output.push_back({unit_, series, validTo, Identifier::Random()});
+        }
+
+        return output;
+    }
+
+    SpentTokens::Batch batch(const std::int32_t series, const std::size_t count)
+        const
+    {
+        return batch(series, count, valid_to_);
+    }
+
+    std::string name(const std::int32_t series) const
+    {
+        return unit_->str() + "." + std::to_string(series);
+    }
+
+    std::string path(const std::int32_t series, const std::string& suffix)
+        const
+    {
+        auto folder = String::Factory();
+        const bool haveFolder = OTPaths::AppendFolder(
+            folder,
+            String::Factory(server_.DataFolder()),
+            String::Factory("spent_tokens"));
+
+        OT_ASSERT(haveFolder);
+
+        return std::string(folder->Get()) + name(series) + suffix;
+    }
+
+    // Closes the current instance cleanly and loads everything from disk
+    void reopen()
+    {
+        spent_.reset();
+        spent_.reset(new SpentTokens(server_.Server()));
+    }
+
+    static bool exists(const std::string& file)
+    {
+        struct stat info;
+
+        return 0 == ::stat(file.c_str(), &info);
+    }
+
+    static std::uint64_t log_size(const std::uint64_t records)
+    {
+        return HEADER_SIZE + (records * KEY_SIZE);
+    }
+
+    static std::uint64_t size(const std::string& file)
+    {
+        struct stat info;
+
+        if (0 != ::stat(file.c_str(), &info)) { return 0; }
+
+        return static_cast<std::uint64_t>(info.st_size);
+    }
+};
+
+const opentxs::ArgList Test_SpentTokens::args_{
+    {{OPENTXS_ARG_STORAGE_PLUGIN, {"mem"}}}};
+
+TEST_F(Test_SpentTokens, spend_then_reject_repeat)
+{
+    const auto tokens = batch(0, 10);
+
+    EXPECT_TRUE(spent_->Spend(tokens));
+    EXPECT_FALSE(spent_->Spend(tokens));
+    EXPECT_FALSE(spent_->Spend({tokens.at(3)}));
+
+    // A batch with one spent token is refused as a whole
+    auto mixed = batch(0, 2);
+    mixed.push_back(tokens.at(7));
+
+    EXPECT_FALSE(spent_->Spend(mixed));
+
+    mixed.pop_back();
+
+    EXPECT_TRUE(spent_->Spend(mixed));
+
+    reopen();
+
+    EXPECT_FALSE(spent_->Spend({tokens.at(5)}));
+    EXPECT_FALSE(spent_->Spend({mixed.at(1)}));
+    EXPECT_TRUE(spent_->Spend(batch(0, 1)));
+}
+
+TEST_F(Test_SpentTokens, reject_duplicate_in_batch)
+{
+    auto tokens = batch(1, 3);
+    tokens.push_back(tokens.at(1));
+
+    EXPECT_FALSE(spent_->Spend(tokens));
+
+    // Nothing from the refused batch was recorded
+    tokens.pop_back();
+
+    EXPECT_TRUE(spent_->Spend(tokens));
+    EXPECT_EQ(log_size(3), size(path(1, ".log")));
+}
+
+TEST_F(Test_SpentTokens, recover_truncated_append)
+{
+    const auto tokens = batch(2, 4);
+
+    ASSERT_TRUE(spent_->Spend(tokens));
+
+    spent_.reset();
+    const auto log = path(2, ".log");
+    const auto fd = ::open(log.c_str(), O_WRONLY | O_APPEND);
+
+    ASSERT_LE(0, fd);
+
+    const char partial[KEY_SIZE / 2]{'x'};
+
+    EXPECT_EQ(
+        static_cast<ssize_t>(sizeof(partial)),
+        ::write(fd, partial, sizeof(partial)));
+
+    ::close(fd);
+    spent_.reset(new SpentTokens(server_.Server()));
+
+    EXPECT_FALSE(spent_->Spend({tokens.at(0)}));
+    EXPECT_FALSE(spent_->Spend({tokens.at(3)}));
+    EXPECT_EQ(log_size(4), size(log));
+
+    const auto next = batch(2, 1);
+
+    EXPECT_TRUE(spent_->Spend(next));
+    EXPECT_EQ(log_size(5), size(log));
+
+    reopen();
+
+    EXPECT_FALSE(spent_->Spend(next));
+    EXPECT_FALSE(spent_->Spend({tokens.at(2)}));
+}
+
+TEST_F(Test_SpentTokens, rebuild_deleted_index)
+{
+    const auto tokens = batch(3, 8);
+
+    ASSERT_TRUE(spent_->Spend(tokens));
+
+    spent_.reset();
+    const auto index = path(3, ".idx");
+
+    ASSERT_EQ(0, ::unlink(index.c_str()));
+
+    spent_.reset(new SpentTokens(server_.Server()));
+
+    for (const auto& token : tokens) { EXPECT_FALSE(spent_->Spend({token})); }
+
+    EXPECT_TRUE(exists(index));
+    EXPECT_TRUE(spent_->Spend(batch(3, 1)));
+}
+
+TEST_F(Test_SpentTokens, rebuild_dirty_index)
+{
+    const auto tokens = batch(4, 8);
+
+    ASSERT_TRUE(spent_->Spend(tokens));
+
+    spent_.reset();
+    const auto index = path(4, ".idx");
+    const auto fd = ::open(index.c_str(), O_RDWR);
+
+    ASSERT_LE(0, fd);
+
+    // Empty every slot, so a trusted index would report nothing as spent,
+    // and mark the index as not closed cleanly
+    std::uint64_t slots{0};
+
+    ASSERT_EQ(
+        static_cast<ssize_t>(sizeof(slots)),
+        ::pread(fd, &slots, sizeof(slots), INDEX_SLOTS_OFFSET));
+    ASSERT_EQ(0, ::ftruncate(fd, HEADER_SIZE));
+    ASSERT_EQ(0, ::ftruncate(fd, HEADER_SIZE + (slots * KEY_SIZE)));
+
+    const std::uint64_t dirty{0};
+
+    ASSERT_EQ(
+        static_cast<ssize_t>(sizeof(dirty)),
+        ::pwrite(fd, &dirty, sizeof(dirty), INDEX_CLEAN_OFFSET));
+
+    ::close(fd);
+    spent_.reset(new SpentTokens(server_.Server()));
+
+    for (const auto& token : tokens) { EXPECT_FALSE(spent_->Spend({token})); }
+
+    EXPECT_TRUE(spent_->Spend(batch(4, 1)));
+}
+
+TEST_F(Test_SpentTokens, refuse_retired_series)
+{
+    const auto expired = OTTimeGetCurrentTime() - (2 * RETIRE_DELAY);
+    const auto tokens = batch(5, 2, expired);
+
+    ASSERT_TRUE(spent_->Spend(tokens));
+    EXPECT_FALSE(spent_->Spend(batch(5, 1, expired)));
+    EXPECT_FALSE(exists(path(5, ".log")));
+    EXPECT_FALSE(exists(path(5, ".idx")));
+    EXPECT_TRUE(exists(path(5, ".retired")));
+
+    reopen();
+
+    EXPECT_FALSE(spent_->Spend(batch(5, 1, expired)));
+    EXPECT_FALSE(exists(path(5, ".log")));
+}
+
+TEST_F(Test_SpentTokens, check_legacy_store)
+{
+    const auto tokens = batch(6, 2);
+    const auto& spent = tokens.at(0).hash_;
+    const bool stored = OTDB::StorePlainString(
+        "token",
+        server_.DataFolder(),
+        OTFolders::Spent().Get(),
+        name(6),
+        spent->str(),
+        "");
+
+    ASSERT_TRUE(stored);
+    ASSERT_FALSE(exists(path(6, ".log")));
+    EXPECT_FALSE(spent_->Spend({tokens.at(0)}));
+    EXPECT_TRUE(spent_->Spend({tokens.at(1)}));
+
+    reopen();
+
+    EXPECT_FALSE(spent_->Spend({tokens.at(0)}));
+    EXPECT_FALSE(spent_->Spend({tokens.at(1)}));
+    EXPECT_TRUE(spent_->Spend(batch(6, 1)));
+}
+}  // namespace
@@ -1161,25 +1161,10 @@ TEST_F(Test_Rpc, Get_Account_Activity)
     auto command = init(proto::RPCCOMMAND_GETACCOUNTACTIVITY);
     command.set_session(0);
     command.add_identifier(nym3_account2_id_);
+    // Workflows are read directly, so the history is available without
+    // waiting for an AccountActivity widget to load
     auto response = ot_.RPC(command);
 
-    ASSERT_TRUE(proto::Validate(response, VERBOSE));
-    EXPECT_EQ(RESPONSE_VERSION, response.version());
-
-    ASSERT_EQ(1, response.status_size());
-    EXPECT_EQ(proto::RPCRESPONSE_NONE, response.status(0).code());
-    EXPECT_EQ(RESPONSE_VERSION, response.version());
-    EXPECT_STREQ(command.cookie().c_str(), response.cookie().c_str());
-    EXPECT_EQ(command.type(), response.type());
-    EXPECT_EQ(0, response.accountevent_size());
-
-    Log::Sleep(std::chrono::seconds(1));
-
-    command = init(proto::RPCCOMMAND_GETACCOUNTACTIVITY);
-    command.set_session(0);
-    command.add_identifier(nym3_account2_id_);
-    response = ot_.RPC(command);
-
     ASSERT_TRUE(proto::Validate(response, VERBOSE));
 
     ASSERT_EQ(1, response.status_size());
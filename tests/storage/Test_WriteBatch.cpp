@@ -0,0 +1,108 @@
+// Copyright (c) 2018 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+static const std::size_t writers_{4};
+static const std::size_t mutations_per_writer_{250};
+
+class Test_WriteBatch : public ::testing::Test
+{
+public:
+    // Each plugin uses a separate client instance, and therefore a separate
+    // data folder
+    void benchmark(const std::string& plugin, const int instance)
+    {
+        const ArgList args{{OPENTXS_ARG_STORAGE_PLUGIN, {plugin}}};
+        const auto& client = OT::App().StartClient(args, instance);
+        const auto& storage = client.Storage();
+        const auto nymID = client.Exec().CreateNymHD(
+            proto::CITEMTYPE_INDIVIDUAL, plugin, "", -1);
+
+        ASSERT_FALSE(nymID.empty());
+
+        std::vector<std::string> threads{};
+
+        for (std::size_t i = 0; i < writers_; ++i) {
+            threads.emplace_back(Identifier::Random()->str());
+
+            ASSERT_TRUE(
+                storage.CreateThread(nymID, threads.back(), {threads.back()}));
+        }
+
+        std::atomic<std::size_t> failed{0};
+        std::vector<std::thread> workers{};
+        const auto start = std::chrono::steady_clock::now();
+
+        for (const auto& threadID : threads) {
+            workers.emplace_back([&, threadID]() {
+                for (std::size_t i = 0; i < mutations_per_writer_; ++i) {
+                    const bool stored = storage.Store(
+                        nymID,
+                        threadID,
+                        Identifier::Random()->str(),
+                        std::time(nullptr),
+                        "",
+                        "",
+                        StorageBox::INCOMINGBLOCKCHAIN);
+
+                    if (false == stored) { ++failed; }
+                }
+            });
+        }
+
+        for (auto& worker : workers) { worker.join(); }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+        const auto total = writers_ * mutations_per_writer_;
+
+        EXPECT_EQ(0u, failed.load());
+
+        for (const auto& threadID : threads) {
+            std::shared_ptr<proto::StorageThread> thread{};
+
+            ASSERT_TRUE(storage.Load(nymID, threadID, thread));
+            EXPECT_EQ(
+                mutations_per_writer_,
+                static_cast<std::size_t>(thread->item_size()));
+        }
+
+        std::cout << plugin << ": " << total << " mutations in "
+                  << elapsed.count() << " ms ("
+                  << (1000 * total) / std::max<std::int64_t>(1, elapsed.count())
+                  << " per second)" << std::endl;
+    }
+};
+
+TEST_F(Test_WriteBatch, mem) { benchmark("mem", 1); }
+
+#if OT_STORAGE_LMDB
+TEST_F(Test_WriteBatch, lmdb) { benchmark("lmdb", 2); }
+#endif
+
+#if OT_STORAGE_SQLITE
+TEST_F(Test_WriteBatch, sqlite) { benchmark("sqlite", 3); }
+#endif
+
+#if OT_STORAGE_FS
+TEST_F(Test_WriteBatch, fs) { benchmark("fs", 4); }
+#endif
+}  // namespace